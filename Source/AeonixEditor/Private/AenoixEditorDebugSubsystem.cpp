@@ -87,7 +87,7 @@ void UAenoixEditorDebugSubsystem::OnPathFindComplete(EAeonixPathFindStatus Statu
 {
 	FScopeLock Lock(&PathMutex);
 
-	if (Status == EAeonixPathFindStatus::Complete)
+	if (Status == EAeonixPathFindStatus::Complete || Status == EAeonixPathFindStatus::Partial)
 	{
 		CurrentDebugPath.SetIsReady(true);
 		// Cache the successfully calculated path
@@ -96,7 +96,7 @@ void UAenoixEditorDebugSubsystem::OnPathFindComplete(EAeonixPathFindStatus Statu
 		bIsPathPending = false;
 		// Flag that we need to redraw the new path
 		bNeedsRedraw = true;
-		UE_LOG(LogAeonixEditor, Log, TEXT("Pathfinding COMPLETE - path ready to draw with %d waypoints"), CurrentDebugPath.GetPathPoints().Num());
+		UE_LOG(LogAeonixEditor, Log, TEXT("Pathfinding %s - path ready to draw with %d waypoints"), CurrentDebugPath.IsPartial() ? TEXT("PARTIAL") : TEXT("COMPLETE"), CurrentDebugPath.GetPathPoints().Num());
 	}
 	else if (Status == EAeonixPathFindStatus::Failed)
 	{
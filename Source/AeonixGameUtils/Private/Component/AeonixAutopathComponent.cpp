@@ -226,7 +226,8 @@ void UAeonixAutopathComponent::OnPathFindComplete(EAeonixPathFindStatus Status)
 {
 	bPathRequestPending = false;
 
-	bool bSuccess = (Status == EAeonixPathFindStatus::Complete);
+	// A partial path is still somewhere to go, moving along it re-requests from wherever we get to
+	bool bSuccess = (Status == EAeonixPathFindStatus::Complete || Status == EAeonixPathFindStatus::Partial);
 
 	if (bSuccess)
 	{
@@ -3,6 +3,9 @@
 #include "Component/AeonixAutopathTargetComponent.h"
 #include "Subsystem/AeonixSubsystem.h"
 #include "Component/AeonixNavAgentComponent.h"
+#include "Actor/AeonixBoundingVolume.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Util/AeonixMediator.h"
 #include "AeonixNavigation.h"
 
 #include "GameFramework/Actor.h"
@@ -13,6 +16,12 @@ void UAeonixAutopathSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	// Regens change the octree under the flow field, so it has to be rebuilt
+	if (UAeonixSubsystem* NavSubsystem = Collection.InitializeDependency<UAeonixSubsystem>())
+	{
+		NavSubsystem->GetOnNavigationRegenCompleted().AddUObject(this, &UAeonixAutopathSubsystem::OnNavigationRegenCompleted);
+	}
+
 	UE_LOG(LogAeonixNavigation, Verbose, TEXT("AeonixAutopathSubsystem: Initialized"));
 }
 
@@ -23,6 +32,12 @@ void UAeonixAutopathSubsystem::Deinitialize()
 	SourceLastPositionMap.Empty();
 	TargetLastPosition = FVector::ZeroVector;
 	bTargetPositionInitialized = false;
+	InvalidateTargetFlowFields();
+
+	if (UAeonixSubsystem* NavSubsystem = GetWorld()->GetSubsystem<UAeonixSubsystem>())
+	{
+		NavSubsystem->GetOnNavigationRegenCompleted().RemoveAll(this);
+	}
 
 	UE_LOG(LogAeonixNavigation, Verbose, TEXT("AeonixAutopathSubsystem: Deinitialized"));
 
@@ -123,6 +138,7 @@ void UAeonixAutopathSubsystem::UnregisterAutopathTarget(UAeonixAutopathTargetCom
 		RegisteredTarget = nullptr;
 		TargetLastPosition = FVector::ZeroVector;
 		bTargetPositionInitialized = false;
+		InvalidateTargetFlowFields();
 		UE_LOG(LogAeonixNavigation, Verbose, TEXT("AeonixAutopathSubsystem: Unregistered target %s"), *Component->GetName());
 	}
 }
@@ -171,6 +187,23 @@ void UAeonixAutopathSubsystem::ProcessAutopathSources()
 		}
 	}
 
+	// A regen dropped the field, every source needs a fresh path
+	if (bFlowFieldInvalidated)
+	{
+		bFlowFieldInvalidated = false;
+		bTargetMoved = true;
+	}
+
+	if (!RegisteredTarget->bUseFlowField)
+	{
+		InvalidateTargetFlowFields();
+	}
+	else if (bTargetMoved)
+	{
+		UpdateTargetFlowField(CurrentTargetPos);
+	}
+	FlowFieldBudgetRemaining = RegisteredTarget->FlowFieldExpansionBudget;
+
 	// Process each source (iterate backwards for safe removal)
 	for (int32 i = RegisteredSources.Num() - 1; i >= 0; i--)
 	{
@@ -299,6 +332,12 @@ void UAeonixAutopathSubsystem::RequestAsyncPathfinding(UAeonixAutopathComponent*
 	// Get target position with offset from nav agent
 	FVector TargetPos = RegisteredTarget->GetOwner()->GetActorLocation() + NavAgent->EndPointOffset;
 
+	// Read straight from the shared flow field where possible, it's already been searched for the other sources
+	if (RegisteredTarget->bUseFlowField && TryFlowFieldPath(Source, NavAgent, TargetPos))
+	{
+		return;
+	}
+
 	// Mark as pending on component
 	Source->SetPathRequestPending(true);
 
@@ -314,3 +353,130 @@ void UAeonixAutopathSubsystem::RequestAsyncPathfinding(UAeonixAutopathComponent*
 
 	UE_LOG(LogAeonixNavigation, Verbose, TEXT("AeonixAutopathSubsystem: Requested async pathfind for %s"), *Source->GetName());
 }
+
+void UAeonixAutopathSubsystem::UpdateTargetFlowField(const FVector& TargetPos)
+{
+	UAeonixSubsystem* NavSubsystem = GetWorld()->GetSubsystem<UAeonixSubsystem>();
+	const AAeonixBoundingVolume* NavVolume = NavSubsystem ? NavSubsystem->GetVolumeForPosition(TargetPos) : nullptr;
+
+	AeonixLink TargetLink;
+	if (!NavVolume || !AeonixMediator::GetLinkFromPosition(TargetPos, *NavVolume, TargetLink))
+	{
+		InvalidateTargetFlowFields();
+		return;
+	}
+
+	// Moving within the same voxel leaves the trees as they are, only the end points of the paths change
+	const uint32 GenerationId = NavVolume->GetNavData().GetGenerationId();
+	if (FlowFieldVolume.Get() == NavVolume && FlowFieldTargetLink == TargetLink && FlowFieldGenerationId == GenerationId)
+	{
+		return;
+	}
+
+	// New fields are only searched as far as the sources need, as they ask for paths
+	TargetFlowFields.Reset();
+	FlowFieldVolume = NavVolume;
+	FlowFieldTargetLink = TargetLink;
+	FlowFieldTargetPos = TargetPos;
+	FlowFieldGenerationId = GenerationId;
+
+	UE_LOG(LogAeonixNavigation, Verbose, TEXT("AeonixAutopathSubsystem: Target crossed into a new voxel, flow fields reset"));
+}
+
+void UAeonixAutopathSubsystem::InvalidateTargetFlowFields()
+{
+	TargetFlowFields.Reset();
+	FlowFieldVolume.Reset();
+	FlowFieldTargetLink = AeonixLink::GetInvalidLink();
+}
+
+FAeonixFlowField& UAeonixAutopathSubsystem::FindOrAddTargetFlowField(const FAeonixPathFinderSettings& Settings)
+{
+	const uint32 SettingsHash = GetTypeHash(Settings);
+	for (FTargetFlowField& TargetField : TargetFlowFields)
+	{
+		if (TargetField.SettingsHash == SettingsHash && TargetField.Settings == Settings)
+		{
+			return TargetField.Field;
+		}
+	}
+
+	FTargetFlowField& TargetField = TargetFlowFields.AddDefaulted_GetRef();
+	TargetField.Settings = Settings;
+	TargetField.SettingsHash = SettingsHash;
+	TargetField.Field.Reset(FlowFieldTargetLink, FlowFieldTargetPos, FlowFieldGenerationId);
+	return TargetField.Field;
+}
+
+bool UAeonixAutopathSubsystem::TryFlowFieldPath(UAeonixAutopathComponent* Source, UAeonixNavAgentComponent* NavAgent, const FVector& TargetPos)
+{
+	UAeonixSubsystem* NavSubsystem = GetWorld()->GetSubsystem<UAeonixSubsystem>();
+	const AAeonixBoundingVolume* NavVolume = NavSubsystem ? NavSubsystem->GetVolumeForAgent(NavAgent) : nullptr;
+
+	if (!NavVolume || NavVolume != FlowFieldVolume.Get() || !FlowFieldTargetLink.IsValid())
+	{
+		return false;
+	}
+
+	if (NavVolume->GetNavData().GetGenerationId() != FlowFieldGenerationId)
+	{
+		InvalidateTargetFlowFields();
+		return false;
+	}
+
+	// End point offsets can put an agent's goal in a different voxel to the one the field is rooted at
+	const FVector StartPos = NavAgent->GetPathfindingStartPosition();
+	const FVector EndPos = NavAgent->GetPathfindingEndPosition(TargetPos);
+	AeonixLink StartLink;
+	AeonixLink EndLink;
+	if (!AeonixMediator::GetLinkFromPosition(StartPos, *NavVolume, StartLink)
+		|| !AeonixMediator::GetLinkFromPosition(EndPos, *NavVolume, EndLink)
+		|| !(EndLink == FlowFieldTargetLink))
+	{
+		return false;
+	}
+
+	// Neighbours and edge costs depend on the settings, so sources only share a field with those searching the same way
+	FAeonixFlowField& TargetFlowField = FindOrAddTargetFlowField(NavAgent->PathfinderSettings);
+
+	// This runs on the game thread, so once the frame's budget is spent only sources the field already reaches are served from it
+	if (FlowFieldBudgetRemaining <= 0 && !TargetFlowField.IsSettled(StartLink))
+	{
+		return false;
+	}
+
+	FAeonixNavigationPath& Path = Source->GetNavigationPath();
+	Path.ResetForRepath();
+
+	bool bPathFound;
+	{
+		FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+
+		TargetFlowField.SetTargetPosition(EndPos);
+		AeonixPathFinder PathFinder(NavVolume->GetNavData(), NavAgent->PathfinderSettings);
+		bPathFound = PathFinder.FindPathFromFlowField(TargetFlowField, StartLink, StartPos, Path, FlowFieldBudgetRemaining);
+		FlowFieldBudgetRemaining -= PathFinder.GetLastIterationCount();
+	}
+
+	// Not settled within this frame's budget or the iteration limit, or unreachable, the regular async search can have a go
+	if (!bPathFound)
+	{
+		return false;
+	}
+
+	Path.SetIsReady(true);
+	Source->OnPathFindComplete(EAeonixPathFindStatus::Complete);
+
+	UE_LOG(LogAeonixNavigation, Verbose, TEXT("AeonixAutopathSubsystem: Flow field path for %s with %d points (%d links settled)"),
+		*Source->GetName(), Path.GetNumPoints(), TargetFlowField.GetNumSettled());
+	return true;
+}
+
+void UAeonixAutopathSubsystem::OnNavigationRegenCompleted(AAeonixBoundingVolume* Volume)
+{
+	if (FlowFieldVolume.IsValid() && FlowFieldVolume.Get() == Volume)
+	{
+		InvalidateTargetFlowFields();
+		bFlowFieldInvalidated = true;
+	}
+}
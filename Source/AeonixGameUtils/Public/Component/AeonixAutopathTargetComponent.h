@@ -28,6 +28,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aeonix|Autopath")
 	bool bEnableAutopath = true;
 
+	/** Share a single flow field towards this target between all sources, instead of running a search per source. Sources it can't serve fall back to their own search */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aeonix|Autopath")
+	bool bUseFlowField = false;
+
+	/** Most links the shared flow field may settle on the game thread each frame. Sources it doesn't reach within this use their own async search, and the field picks up where it stopped on later frames */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aeonix|Autopath", meta = (ClampMin = "0", EditCondition = "bUseFlowField"))
+	int32 FlowFieldExpansionBudget = 1000;
+
 protected:
 	virtual void OnRegister() override;
 	virtual void OnUnregister() override;
@@ -1,12 +1,16 @@
 #pragma once
 
 #include "Data/AeonixTypes.h"
+#include "Pathfinding/AeonixFlowField.h"
+#include "Pathfinding/AeonixPathFinder.h"
 #include "Subsystems/WorldSubsystem.h"
 
 #include "AeonixAutopathSubsystem.generated.h"
 
+class AAeonixBoundingVolume;
 class UAeonixAutopathComponent;
 class UAeonixAutopathTargetComponent;
+class UAeonixNavAgentComponent;
 
 /**
  * Subsystem that manages autopath components, tracking movement and triggering pathfinding.
@@ -56,6 +60,41 @@ private:
 	FVector TargetLastPosition = FVector::ZeroVector;
 	bool bTargetPositionInitialized = false;
 
+	/** Flow field towards the registered target for one set of pathfinder settings, as they decide which links it reaches and at what cost */
+	struct FTargetFlowField
+	{
+		FAeonixPathFinderSettings Settings;
+		uint32 SettingsHash = 0;
+		FAeonixFlowField Field;
+	};
+
+	/** One field per distinct settings among the sources, all rooted at the same target voxel in FlowFieldVolume */
+	TArray<FTargetFlowField> TargetFlowFields;
+	TWeakObjectPtr<const AAeonixBoundingVolume> FlowFieldVolume;
+	AeonixLink FlowFieldTargetLink = AeonixLink::GetInvalidLink();
+	FVector FlowFieldTargetPos = FVector::ZeroVector;
+	uint32 FlowFieldGenerationId = 0;
+
+	/** Set when the field was dropped by a regen, so every source repaths */
+	bool bFlowFieldInvalidated = false;
+
+	/** Links the flow field may still settle this frame, reset from the target's budget every tick */
+	int32 FlowFieldBudgetRemaining = 0;
+
+	/** Keeps the flow fields rooted at the target's current voxel, only dropping them when it crosses into another one */
+	void UpdateTargetFlowField(const FVector& TargetPos);
+
+	/** Drops every flow field, they're created again as sources ask for paths */
+	void InvalidateTargetFlowFields();
+
+	/** The field for sources with these settings, created on first use */
+	FAeonixFlowField& FindOrAddTargetFlowField(const FAeonixPathFinderSettings& Settings);
+
+	/** Fills the source's path from the flow field, returns false if the field can't serve this source */
+	bool TryFlowFieldPath(UAeonixAutopathComponent* Source, UAeonixNavAgentComponent* NavAgent, const FVector& TargetPos);
+
+	void OnNavigationRegenCompleted(AAeonixBoundingVolume* Volume);
+
 	/** Process all autopath sources and trigger pathfinding as needed */
 	void ProcessAutopathSources();
 
@@ -185,6 +185,12 @@ void AAeonixBoundingVolume::RegenerateDynamicSubregions()
 	if (UAeonixSubsystem* Subsystem = GetWorld()->GetSubsystem<UAeonixSubsystem>())
 	{
 		Subsystem->GetLoadMetrics().UpdateRegenTime(ElapsedMs);
+
+		// Bump region versions so in-flight and cached paths through these regions are treated as stale
+		for (const auto& RegionPair : GenerationParameters.DynamicRegionBoxes)
+		{
+			Subsystem->IncrementRegionVersion(RegionPair.Key);
+		}
 	}
 
 	// Draw debug boxes showing which regions were regenerated
@@ -357,6 +363,9 @@ void AAeonixBoundingVolume::RegenerateDynamicSubregion(const FGuid& RegionId)
 	if (UAeonixSubsystem* Subsystem = GetWorld()->GetSubsystem<UAeonixSubsystem>())
 	{
 		Subsystem->GetLoadMetrics().UpdateRegenTime(ElapsedMs);
+
+		// Bump the region version so in-flight and cached paths through it are treated as stale
+		Subsystem->IncrementRegionVersion(RegionId);
 	}
 
 	UE_LOG(LogAeonixRegen, Display, TEXT("RegenerateDynamicSubregion complete for region %s in volume %s (%.2fms)"),
@@ -789,6 +798,77 @@ void AAeonixBoundingVolume::EnqueueRegenResults(TArray<FAeonixLeafRasterResult>&
 	UE_LOG(LogAeonixRegen, Display, TEXT("Enqueued %d regeneration results for time-budgeted processing"), PendingRegenResults.Num());
 }
 
+void AAeonixBoundingVolume::TryRebuildDerivedData()
+{
+	if (!bIsReadyForNavigation || bDerivedDataRebuildInFlight)
+		return;
+
+	// Wait until nothing is left to change
+	if (DirtyRegionIds.Num() > 0 || PendingRegenResults.Num() > 0)
+		return;
+
+	const bool bRebuildTopology = !NavigationData.GetConnectivity().IsValid() || !NavigationData.GetFreeVolume().IsValid();
+
+	// Landmarks are the costliest to build, so they also wait out a burst of regens
+	const UAeonixSettings* Settings = GetDefault<UAeonixSettings>();
+	const float LandmarkRebuildDelay = Settings ? Settings->LandmarkRebuildDelay : 2.0f;
+	const bool bRebuildLandmarks = NavigationData.GetParams().NumLandmarks > 0 && !NavigationData.GetLandmarks().IsValid()
+		&& GetWorld()->GetTimeSeconds() - LastDynamicRegenTime >= LandmarkRebuildDelay;
+
+	if (!bRebuildTopology && !bRebuildLandmarks)
+		return;
+
+	// The rebuild works on a copy, so searches and regens carry on against the live octree while it runs
+	TSharedRef<FAeonixData> Rebuilt = MakeShared<FAeonixData>();
+	Rebuilt->UpdateGenerationParameters(NavigationData.GetParams());
+	{
+		FReadScopeLock ReadLock(OctreeDataLock);
+		Rebuilt->OctreeData = NavigationData.OctreeData;
+	}
+
+	const uint32 GenerationId = NavigationData.GetGenerationId();
+	const uint32 LeafChangeSerial = NavigationData.GetLeafChangeSerial();
+	TWeakObjectPtr<AAeonixBoundingVolume> WeakThis(this);
+	bDerivedDataRebuildInFlight = true;
+
+	FFunctionGraphTask::CreateAndDispatchWhenReady([WeakThis, Rebuilt, GenerationId, LeafChangeSerial, bRebuildTopology, bRebuildLandmarks]()
+	{
+		if (bRebuildTopology)
+		{
+			Rebuilt->BuildConnectivity();
+			Rebuilt->BuildFreeVolume();
+		}
+		if (bRebuildLandmarks)
+		{
+			Rebuilt->BuildLandmarks();
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Rebuilt, GenerationId, LeafChangeSerial]()
+		{
+			if (AAeonixBoundingVolume* Volume = WeakThis.Get())
+			{
+				Volume->FinishDerivedDataRebuild(*Rebuilt, GenerationId, LeafChangeSerial);
+			}
+		});
+	}, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+}
+
+void AAeonixBoundingVolume::FinishDerivedDataRebuild(FAeonixData& Rebuilt, uint32 GenerationId, uint32 LeafChangeSerial)
+{
+	bDerivedDataRebuildInFlight = false;
+
+	// Leaves written since the copy make it stale, the next tick starts again from the current octree
+	if (!bIsReadyForNavigation || !HasData() || PendingRegenResults.Num() > 0
+		|| NavigationData.GetGenerationId() != GenerationId || NavigationData.GetLeafChangeSerial() != LeafChangeSerial)
+	{
+		UE_LOG(LogAeonixRegen, Verbose, TEXT("Volume %s: dropping derived data rebuilt from an out of date octree"), *GetName());
+		return;
+	}
+
+	FWriteScopeLock WriteLock(OctreeDataLock);
+	NavigationData.TakeDerivedData(Rebuilt);
+}
+
 void AAeonixBoundingVolume::ProcessPendingRegenResults(float DeltaTime)
 {
 	if (PendingRegenResults.Num() == 0 || NextResultIndexToProcess >= PendingRegenResults.Num())
@@ -811,6 +891,7 @@ void AAeonixBoundingVolume::ProcessPendingRegenResults(float DeltaTime)
 	// Acquire write lock to update leaf nodes
 	FWriteScopeLock WriteLock(OctreeDataLock);
 	FAeonixOctreeData& OctreeData = NavigationData.OctreeData;
+	const int32 FirstChangedLeafThisFrame = PendingRegenChangedLeaves.Num();
 
 	// Process results until time budget is exhausted
 	while (NextResultIndexToProcess < PendingRegenResults.Num())
@@ -819,6 +900,16 @@ void AAeonixBoundingVolume::ProcessPendingRegenResults(float DeltaTime)
 
 		if (Result.LeafNodeArrayIndex >= 0 && Result.LeafNodeArrayIndex < OctreeData.LeafNodes.Num())
 		{
+			// Components go stale as soon as a leaf changes, stop using them until they are rebuilt after the whole batch is applied
+			if (OctreeData.LeafNodes[Result.LeafNodeArrayIndex].VoxelGrid != Result.VoxelBitmask)
+			{
+				NavigationData.InvalidateConnectivity();
+				NavigationData.InvalidateLandmarks();
+				NavigationData.InvalidateFreeVolume();
+				PendingRegenChangedLeaves.Add(Result.LeafNodeArrayIndex);
+				PendingRegenChangedVoxels.Add(OctreeData.LeafNodes[Result.LeafNodeArrayIndex].VoxelGrid ^ Result.VoxelBitmask);
+			}
+
 			// Clear and set new voxel data
 			OctreeData.LeafNodes[Result.LeafNodeArrayIndex].Clear();
 			OctreeData.LeafNodes[Result.LeafNodeArrayIndex].VoxelGrid = Result.VoxelBitmask;
@@ -844,6 +935,10 @@ void AAeonixBoundingVolume::ProcessPendingRegenResults(float DeltaTime)
 		}
 	}
 
+	// Unlike the components, the adjacency lists and clearance are patched as leaves are written, so searches between frames never see stale ones
+	NavigationData.UpdateAdjacency(MakeArrayView(PendingRegenChangedLeaves).RightChop(FirstChangedLeafThisFrame));
+	NavigationData.UpdateClearance(MakeArrayView(PendingRegenChangedLeaves).RightChop(FirstChangedLeafThisFrame));
+
 	// Check if we've finished processing all results
 	if (NextResultIndexToProcess >= PendingRegenResults.Num())
 	{
@@ -862,6 +957,12 @@ void AAeonixBoundingVolume::ProcessPendingRegenResults(float DeltaTime)
 			AsyncRegenStartTime = 0.0; // Reset for next regen
 		}
 
+		NavigationData.RecordLeafChanges(MoveTemp(PendingRegenChangedLeaves), MoveTemp(PendingRegenChangedVoxels));
+		PendingRegenChangedLeaves.Reset();
+		PendingRegenChangedVoxels.Reset();
+
+		// The components and free volume stay invalid until TryRebuildDerivedData replaces them from a background task
+
 		// Clear the queue
 		PendingRegenResults.Empty();
 		NextResultIndexToProcess = 0;
@@ -1148,6 +1249,34 @@ void AAeonixBoundingVolume::BeginPlay()
 	// If bIsReadyForNavigation is already true (from baked data), skip UpdateBounds()
 	// to preserve the generation-time Origin and Extents that were serialized
 
+	// Connectivity isn't serialized, so baked data needs it built once here
+	if (bIsReadyForNavigation && !NavigationData.GetConnectivity().IsValid())
+	{
+		FWriteScopeLock WriteLock(OctreeDataLock);
+		NavigationData.BuildConnectivity();
+	}
+
+	// Nor are the free volume totals, which group by the components so come after them
+	if (bIsReadyForNavigation && !NavigationData.GetFreeVolume().IsValid())
+	{
+		FWriteScopeLock WriteLock(OctreeDataLock);
+		NavigationData.BuildFreeVolume();
+	}
+
+	// Nor is the adjacency
+	if (bIsReadyForNavigation && GenerationParameters.bBakeAdjacency && !NavigationData.GetAdjacency().IsValid())
+	{
+		FWriteScopeLock WriteLock(OctreeDataLock);
+		NavigationData.BuildAdjacency();
+	}
+
+	// Nor is the clearance
+	if (bIsReadyForNavigation && GenerationParameters.bBakeClearance && !NavigationData.GetClearance().IsValid())
+	{
+		FWriteScopeLock WriteLock(OctreeDataLock);
+		NavigationData.BuildClearance();
+	}
+
 	// Handle dynamic regions - validate loaded regions have corresponding modifier volumes
 	if (GenerationParameters.DynamicRegionBoxes.Num() > 0)
 	{
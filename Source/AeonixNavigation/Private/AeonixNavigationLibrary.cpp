@@ -1,4 +1,17 @@
 #include "AeonixNavigationLibrary.h"
+#include "Subsystem/AeonixSubsystem.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+namespace
+{
+	UAeonixSubsystem* GetAeonixSubsystem(const UObject* WorldContextObject)
+	{
+		const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+		return World ? World->GetSubsystem<UAeonixSubsystem>() : nullptr;
+	}
+}
 
 TArray<FAeonixPathPoint> UAeonixNavigationLibrary::GetPathPoints(const FAeonixNavigationPath& Path)
 {
@@ -14,3 +27,21 @@ bool UAeonixNavigationLibrary::IsPathReady(const FAeonixNavigationPath& Path)
 {
 	return Path.IsReady();
 }
+
+bool UAeonixNavigationLibrary::GetRandomNavigablePoint(const UObject* WorldContextObject, FVector& OutPoint)
+{
+	UAeonixSubsystem* Subsystem = GetAeonixSubsystem(WorldContextObject);
+	return Subsystem && Subsystem->GetRandomNavigablePoint(OutPoint);
+}
+
+bool UAeonixNavigationLibrary::GetRandomReachablePoint(const UObject* WorldContextObject, const FVector& Origin, FVector& OutPoint)
+{
+	UAeonixSubsystem* Subsystem = GetAeonixSubsystem(WorldContextObject);
+	return Subsystem && Subsystem->GetRandomReachablePoint(Origin, OutPoint);
+}
+
+bool UAeonixNavigationLibrary::GetRandomNavigablePointInBox(const UObject* WorldContextObject, const FVector& Center, const FVector& Extent, FVector& OutPoint)
+{
+	UAeonixSubsystem* Subsystem = GetAeonixSubsystem(WorldContextObject);
+	return Subsystem && Subsystem->GetRandomNavigablePointInBox(FBox(Center - Extent, Center + Extent), OutPoint);
+}
@@ -1,6 +1,7 @@
 // Copyright 2024 Chris Ashworth
 
 #include "Component/AeonixFlyingMovementComponent.h"
+#include "Subsystem/AeonixSubsystem.h"
 #include "GameFramework/Pawn.h"
 #include "Components/StaticMeshComponent.h"
 #include "Engine.h"
@@ -23,8 +24,11 @@ void UAeonixFlyingMovementComponent::TickComponent(float DeltaTime, ELevelTick T
 	// Velocity is set by path following via RequestDirectMove
 	if (UpdatedComponent && !Velocity.IsNearlyZero())
 	{
+		// Steered from the requested velocity afresh each tick, rather than written back, so the push doesn't build up while path following isn't updating Velocity
+		const FVector SteeredVelocity = ApplyObstacleAvoidance(Velocity);
+
 		FHitResult Hit;
-		SafeMoveUpdatedComponent(Velocity * DeltaTime, UpdatedComponent->GetComponentRotation(), true, Hit);
+		SafeMoveUpdatedComponent(SteeredVelocity * DeltaTime, UpdatedComponent->GetComponentRotation(), true, Hit);
 	}
 
 	// DO NOT call Super::TickComponent - we're handling all movement ourselves
@@ -42,4 +46,30 @@ void UAeonixFlyingMovementComponent::RequestDirectMove(const FVector& MoveVeloci
 bool UAeonixFlyingMovementComponent::CanStartPathFollowing() const
 {
 	return true;
-}
\ No newline at end of file
+}
+
+FVector UAeonixFlyingMovementComponent::ApplyObstacleAvoidance(const FVector& InVelocity) const
+{
+	if (FlyingSettings.AvoidanceRadius <= 0.0f)
+	{
+		return InVelocity;
+	}
+
+	UWorld* World = GetWorld();
+	UAeonixSubsystem* AeonixSubsystem = World ? World->GetSubsystem<UAeonixSubsystem>() : nullptr;
+	if (!AeonixSubsystem)
+	{
+		return InVelocity;
+	}
+
+	FAeonixNearestObstacle Obstacle;
+	if (!AeonixSubsystem->FindNearestObstacle(UpdatedComponent->GetComponentLocation(), FlyingSettings.AvoidanceRadius, Obstacle) || Obstacle.Direction.IsZero())
+	{
+		return InVelocity;
+	}
+
+	// Push straight away from the obstacle, harder the closer it is
+	const float Falloff = 1.0f - Obstacle.Distance / FlyingSettings.AvoidanceRadius;
+	const FVector Steered = InVelocity - Obstacle.Direction * (Falloff * FlyingSettings.AvoidanceStrength * MaxSpeed);
+	return Steered.GetClampedToMaxSize(MaxSpeed);
+}
@@ -0,0 +1,171 @@
+#include "Data/AeonixAdjacency.h"
+#include "Data/AeonixOctreeData.h"
+#include "Data/AeonixStats.h"
+#include "AeonixNavigation.h"
+
+void FAeonixAdjacency::Build(const FAeonixOctreeData& aOctreeData)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AeonixAdjacencyBuild);
+
+	Reset();
+
+	const int32 numLayers = aOctreeData.Layers.Num();
+	if (numLayers == 0)
+	{
+		return;
+	}
+
+	TArray<AeonixLink> neighbours;
+	TArray<nodeindex_t> leaves;
+	// Each leaf paired with a node whose list reaches into it, sorted into LeafDependents once every list is baked
+	TArray<TPair<nodeindex_t, AeonixLink>> dependencies;
+
+	Offsets.SetNum(numLayers);
+	Counts.SetNum(numLayers);
+	for (int32 layerIndex = 0; layerIndex < numLayers; layerIndex++)
+	{
+		const TArray<AeonixNode>& layer = aOctreeData.Layers[layerIndex];
+		Offsets[layerIndex].SetNumUninitialized(layer.Num() + 1);
+		Counts[layerIndex].SetNumZeroed(layer.Num());
+
+		for (int32 nodeIndex = 0; nodeIndex < layer.Num(); nodeIndex++)
+		{
+			Offsets[layerIndex][nodeIndex] = Links.Num();
+
+			// Subdivided nodes are searched through their children or leaf subnodes, so never expanded themselves
+			if (layer[nodeIndex].HasChildren())
+			{
+				continue;
+			}
+
+			const AeonixLink link(layerIndex, nodeIndex, 0);
+			neighbours.Reset();
+			leaves.Reset();
+			aOctreeData.GetNeighbours(link, neighbours, &leaves);
+
+			// Leave room for every subnode of the faced leaves, so clearing voxels later never outgrows the slots
+			int32 numLeafSubnodes = 0;
+			for (const AeonixLink& neighbour : neighbours)
+			{
+				if (neighbour.GetLayerIndex() == 0 && aOctreeData.GetNode(neighbour).HasChildren())
+				{
+					numLeafSubnodes++;
+				}
+			}
+			const int32 capacity = neighbours.Num() - numLeafSubnodes + leaves.Num() * 16;
+
+			Counts[layerIndex][nodeIndex] = neighbours.Num();
+			Links.Append(neighbours);
+			Links.AddDefaulted(capacity - neighbours.Num());
+
+			for (const nodeindex_t leaf : leaves)
+			{
+				dependencies.Emplace(leaf, link);
+			}
+		}
+
+		Offsets[layerIndex][layer.Num()] = Links.Num();
+	}
+
+	const int32 numLeaves = aOctreeData.LeafNodes.Num();
+	LeafDependentOffsets.SetNumZeroed(numLeaves + 1);
+	for (const TPair<nodeindex_t, AeonixLink>& dependency : dependencies)
+	{
+		if (dependency.Key >= 0 && dependency.Key < numLeaves)
+		{
+			LeafDependentOffsets[dependency.Key + 1]++;
+		}
+	}
+	for (int32 leafIndex = 0; leafIndex < numLeaves; leafIndex++)
+	{
+		LeafDependentOffsets[leafIndex + 1] += LeafDependentOffsets[leafIndex];
+	}
+
+	TArray<int32> cursors(LeafDependentOffsets.GetData(), numLeaves);
+	LeafDependents.SetNum(LeafDependentOffsets[numLeaves]);
+	for (const TPair<nodeindex_t, AeonixLink>& dependency : dependencies)
+	{
+		if (dependency.Key >= 0 && dependency.Key < numLeaves)
+		{
+			LeafDependents[cursors[dependency.Key]++] = dependency.Value;
+		}
+	}
+
+	bIsValid = true;
+
+	UE_LOG(LogAeonixNavigation, Display, TEXT("Adjacency: %d link slots, %d leaf dependents, %.1f KB"),
+		Links.Num(), LeafDependents.Num(), (Links.GetAllocatedSize() + LeafDependents.GetAllocatedSize()) / 1024.f);
+}
+
+void FAeonixAdjacency::UpdateLeaves(const FAeonixOctreeData& aOctreeData, TConstArrayView<nodeindex_t> aChangedLeaves)
+{
+	if (!bIsValid)
+	{
+		return;
+	}
+
+	// A node facing several of the changed leaves only needs reading once
+	TSet<AeonixLink> dependents;
+	for (const nodeindex_t leaf : aChangedLeaves)
+	{
+		if (leaf < 0 || leaf + 1 >= LeafDependentOffsets.Num())
+		{
+			continue;
+		}
+		for (int32 i = LeafDependentOffsets[leaf]; i < LeafDependentOffsets[leaf + 1]; i++)
+		{
+			dependents.Add(LeafDependents[i]);
+		}
+	}
+
+	TArray<AeonixLink> neighbours;
+	for (const AeonixLink& link : dependents)
+	{
+		neighbours.Reset();
+		aOctreeData.GetNeighbours(link, neighbours);
+
+		const int32 layerIndex = link.GetLayerIndex();
+		const int32 nodeIndex = link.GetNodeIndex();
+		const int32 first = Offsets[layerIndex][nodeIndex];
+		const int32 capacity = Offsets[layerIndex][nodeIndex + 1] - first;
+		if (neighbours.Num() > capacity)
+		{
+			// Only possible if the octree was restructured rather than having its voxels rewritten
+			UE_LOG(LogAeonixNavigation, Warning, TEXT("Adjacency list for node %d on layer %d outgrew its slots, dropping the adjacency until it's rebuilt"), nodeIndex, layerIndex);
+			Reset();
+			return;
+		}
+
+		for (int32 i = 0; i < neighbours.Num(); i++)
+		{
+			Links[first + i] = neighbours[i];
+		}
+		Counts[layerIndex][nodeIndex] = neighbours.Num();
+	}
+}
+
+void FAeonixAdjacency::Reset()
+{
+	Offsets.Empty();
+	Counts.Empty();
+	Links.Empty();
+	LeafDependentOffsets.Empty();
+	LeafDependents.Empty();
+	bIsValid = false;
+}
+
+TConstArrayView<AeonixLink> FAeonixAdjacency::GetNeighbours(const AeonixLink& aLink) const
+{
+	if (!bIsValid || !Counts.IsValidIndex(aLink.GetLayerIndex()))
+	{
+		return {};
+	}
+
+	const TArray<int32>& counts = Counts[aLink.GetLayerIndex()];
+	if (!counts.IsValidIndex(aLink.GetNodeIndex()))
+	{
+		return {};
+	}
+
+	return TConstArrayView<AeonixLink>(Links.GetData() + Offsets[aLink.GetLayerIndex()][aLink.GetNodeIndex()], counts[aLink.GetNodeIndex()]);
+}
@@ -0,0 +1,489 @@
+#include "Data/AeonixClearance.h"
+#include "Data/AeonixOctreeData.h"
+#include "Data/AeonixStats.h"
+
+#include "Algo/BinarySearch.h"
+
+namespace
+{
+	int32 FindNode(const TArray<AeonixNode>& aLayer, uint64 aCode)
+	{
+		return Algo::BinarySearchBy(aLayer, static_cast<mortoncode_t>(aCode), &AeonixNode::Code);
+	}
+
+	// Grows a set of layer 0 cells by aRadius along each axis in turn, which puts a box round every cell in it
+	void DilateCells(TSet<uint64>& ioCells, int32 aRadius, uint_fast32_t aCellsPerSide)
+	{
+		TArray<uint64> cells;
+		for (int32 axis = 0; axis < 3; axis++)
+		{
+			cells = ioCells.Array();
+			for (const uint64 code : cells)
+			{
+				uint_fast32_t coords[3];
+				morton3D_64_decode(code, coords[0], coords[1], coords[2]);
+
+				const uint_fast32_t first = coords[axis] > static_cast<uint_fast32_t>(aRadius) ? coords[axis] - aRadius : 0;
+				const uint_fast32_t last = FMath::Min<uint_fast32_t>(coords[axis] + aRadius, aCellsPerSide - 1);
+				for (uint_fast32_t along = first; along <= last; along++)
+				{
+					coords[axis] = along;
+					ioCells.Add(morton3D_64_encode(coords[0], coords[1], coords[2]));
+				}
+			}
+		}
+	}
+}
+
+void FAeonixClearance::Build(const FAeonixOctreeData& aOctreeData)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AeonixClearanceBuild);
+
+	Reset();
+
+	const int32 numLayers = aOctreeData.Layers.Num();
+	const int32 numLeaves = aOctreeData.LeafNodes.Num();
+	if (numLayers == 0)
+	{
+		return;
+	}
+
+	// Layer 0 cells along each side of the volume, the wave is dropped where it would step outside
+	const uint_fast32_t cellsPerSide = 1u << (numLayers - 1);
+
+	// Subnodes the wave has reached in every layer 0 cell it has touched, keyed by morton code. Cells without a leaf lie inside free nodes
+	TMap<uint64, uint64> reached;
+	TMap<uint64, nodeindex_t> leafCells;
+	TArray<uint8> leafArrival;
+	leafArrival.Init(MaxClearance, numLeaves * 64);
+	TArray<uint64> covered;
+	covered.SetNumZeroed(numLeaves);
+
+	for (const AeonixNode& node : aOctreeData.Layers[0])
+	{
+		const nodeindex_t leafIndex = node.FirstChild.GetNodeIndex();
+		if (!node.HasChildren() || !aOctreeData.LeafNodes.IsValidIndex(leafIndex))
+		{
+			continue;
+		}
+
+		const uint64 blocked = aOctreeData.LeafNodes[leafIndex].VoxelGrid;
+		leafCells.Add(node.Code, leafIndex);
+		covered[leafIndex] = blocked;
+		for (uint64 bits = blocked; bits; bits &= bits - 1)
+		{
+			leafArrival[leafIndex * 64 + FMath::CountTrailingZeros64(bits)] = 0;
+		}
+
+		if (blocked)
+		{
+			reached.Add(node.Code, blocked);
+		}
+	}
+
+	// The step each leafless cell was first reached at, for the minimums of the free nodes they lie in
+	TMap<uint64, uint8> cellArrival;
+
+	GrowWave(reached, cellsPerSide, nullptr, [&](uint8 step, const TMap<uint64, uint64>& stepReached)
+	{
+		for (const TPair<uint64, uint64>& cell : stepReached)
+		{
+			if (const nodeindex_t* leafIndex = leafCells.Find(cell.Key))
+			{
+				const uint64 newlyReached = cell.Value & ~covered[*leafIndex];
+				covered[*leafIndex] |= newlyReached;
+				for (uint64 bits = newlyReached; bits; bits &= bits - 1)
+				{
+					leafArrival[*leafIndex * 64 + FMath::CountTrailingZeros64(bits)] = step;
+				}
+			}
+			else
+			{
+				cellArrival.FindOrAdd(cell.Key, step);
+			}
+		}
+	});
+
+	LeafClearance.SetNumZeroed(numLeaves * 4);
+	for (int32 leafIndex = 0; leafIndex < numLeaves; leafIndex++)
+	{
+		for (int32 subnode = 0; subnode < 64; subnode++)
+		{
+			LeafClearance[leafIndex * 4 + (subnode >> 4)] |= static_cast<uint64>(leafArrival[leafIndex * 64 + subnode]) << ((subnode & 15) * 4);
+		}
+	}
+
+	// Free nodes hold no leaves, so are as close as the nearest of their cells the wave reached
+	TArray<TMap<uint64, nodeindex_t>> freeNodes;
+	freeNodes.SetNum(numLayers);
+	NodeClearance.SetNum(numLayers);
+	for (int32 layerIndex = 0; layerIndex < numLayers; layerIndex++)
+	{
+		const TArray<AeonixNode>& layer = aOctreeData.Layers[layerIndex];
+		NodeClearance[layerIndex].Init(MaxClearance, layer.Num());
+		for (int32 nodeIndex = 0; nodeIndex < layer.Num(); nodeIndex++)
+		{
+			const AeonixNode& node = layer[nodeIndex];
+			if (!node.HasChildren())
+			{
+				freeNodes[layerIndex].Add(node.Code, nodeIndex);
+			}
+			else if (layerIndex == 0 && aOctreeData.LeafNodes.IsValidIndex(node.FirstChild.GetNodeIndex()))
+			{
+				const nodeindex_t leafIndex = node.FirstChild.GetNodeIndex();
+				uint8 leafMin = MaxClearance;
+				for (int32 subnode = 0; subnode < 64; subnode++)
+				{
+					leafMin = FMath::Min(leafMin, leafArrival[leafIndex * 64 + subnode]);
+				}
+				NodeClearance[0][nodeIndex] = leafMin;
+			}
+		}
+	}
+
+	for (const TPair<uint64, uint8>& cell : cellArrival)
+	{
+		for (int32 layerIndex = 0; layerIndex < numLayers; layerIndex++)
+		{
+			if (const nodeindex_t* nodeIndex = freeNodes[layerIndex].Find(cell.Key >> (3 * layerIndex)))
+			{
+				uint8& nodeMin = NodeClearance[layerIndex][*nodeIndex];
+				nodeMin = FMath::Min(nodeMin, cell.Value);
+				break;
+			}
+		}
+	}
+
+	// Subdivided nodes take the smallest of their children, bottom up
+	for (int32 layerIndex = 1; layerIndex < numLayers; layerIndex++)
+	{
+		const TArray<AeonixNode>& layer = aOctreeData.Layers[layerIndex];
+		for (int32 nodeIndex = 0; nodeIndex < layer.Num(); nodeIndex++)
+		{
+			if (!layer[nodeIndex].HasChildren())
+			{
+				continue;
+			}
+
+			uint8& nodeMin = NodeClearance[layerIndex][nodeIndex];
+			const nodeindex_t firstChild = layer[nodeIndex].FirstChild.GetNodeIndex();
+			for (int32 child = 0; child < 8; child++)
+			{
+				if (NodeClearance[layerIndex - 1].IsValidIndex(firstChild + child))
+				{
+					nodeMin = FMath::Min(nodeMin, NodeClearance[layerIndex - 1][firstChild + child]);
+				}
+			}
+		}
+	}
+
+	bIsValid = true;
+}
+
+void FAeonixClearance::UpdateLeaves(const FAeonixOctreeData& aOctreeData, TConstArrayView<nodeindex_t> aChangedLeaves)
+{
+	const int32 numLayers = aOctreeData.Layers.Num();
+	if (!bIsValid || NodeClearance.Num() != numLayers || LeafClearance.Num() != aOctreeData.LeafNodes.Num() * 4)
+	{
+		// Regens only rewrite voxels, anything else means the octree was rebuilt under the distances
+		Build(aOctreeData);
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_AeonixClearanceUpdate);
+
+	const uint_fast32_t cellsPerSide = 1u << (numLayers - 1);
+	const TArray<AeonixNode>& layer0 = aOctreeData.Layers[0];
+
+	// Leaves don't know which node holds them, so find the cells of the changed ones
+	const TSet<nodeindex_t> changedLeaves(aChangedLeaves);
+	TSet<uint64> affected;
+	for (const AeonixNode& node : layer0)
+	{
+		if (node.HasChildren() && changedLeaves.Contains(node.FirstChild.GetNodeIndex()))
+		{
+			affected.Add(node.Code);
+		}
+	}
+
+	if (affected.Num() == 0)
+	{
+		return;
+	}
+
+	DilateCells(affected, ReachCells, cellsPerSide);
+	TSet<uint64> sources = affected;
+	DilateCells(sources, ReachCells, cellsPerSide);
+
+	// The wave starts from every blocked subnode in range, and each affected leaf gets its arrivals measured afresh
+	TMap<uint64, uint64> reached;
+	TMap<uint64, int32> affectedSlots;
+	TArray<nodeindex_t> affectedNodes;
+	TArray<uint8> leafArrival;
+	TArray<uint64> covered;
+	TSet<AeonixLink> freeNodes;
+	for (const uint64 code : sources)
+	{
+		const bool bAffected = affected.Contains(code);
+		const int32 nodeIndex = FindNode(layer0, code);
+		if (nodeIndex == INDEX_NONE || !layer0[nodeIndex].HasChildren())
+		{
+			// Leafless cells lie inside the free node on the lowest layer that holds them
+			for (int32 layerIndex = 0; bAffected && layerIndex < numLayers; layerIndex++)
+			{
+				const int32 freeIndex = FindNode(aOctreeData.Layers[layerIndex], code >> (3 * layerIndex));
+				if (freeIndex != INDEX_NONE)
+				{
+					if (!aOctreeData.Layers[layerIndex][freeIndex].HasChildren())
+					{
+						freeNodes.Add(AeonixLink(layerIndex, freeIndex, 0));
+					}
+					break;
+				}
+			}
+			continue;
+		}
+
+		const nodeindex_t leafIndex = layer0[nodeIndex].FirstChild.GetNodeIndex();
+		if (!aOctreeData.LeafNodes.IsValidIndex(leafIndex))
+		{
+			continue;
+		}
+
+		const uint64 blocked = aOctreeData.LeafNodes[leafIndex].VoxelGrid;
+		if (blocked)
+		{
+			reached.Add(code, blocked);
+		}
+
+		if (bAffected)
+		{
+			const int32 slot = affectedNodes.Add(nodeIndex);
+			affectedSlots.Add(code, slot);
+			covered.Add(blocked);
+			leafArrival.AddUninitialized(64);
+			for (int32 subnode = 0; subnode < 64; subnode++)
+			{
+				leafArrival[slot * 64 + subnode] = (blocked >> subnode) & 1 ? 0 : MaxClearance;
+			}
+		}
+	}
+
+	// Every subnode within reach of an affected leaf lies inside the sources, so dropping the wave outside them loses nothing it needs
+	GrowWave(reached, cellsPerSide, &sources, [&](uint8 step, const TMap<uint64, uint64>& stepReached)
+	{
+		for (const TPair<uint64, uint64>& cell : stepReached)
+		{
+			if (const int32* slot = affectedSlots.Find(cell.Key))
+			{
+				const uint64 newlyReached = cell.Value & ~covered[*slot];
+				covered[*slot] |= newlyReached;
+				for (uint64 bits = newlyReached; bits; bits &= bits - 1)
+				{
+					leafArrival[*slot * 64 + FMath::CountTrailingZeros64(bits)] = step;
+				}
+			}
+		}
+	});
+
+	// Parents of everything rewritten, per layer, to take the minimums of again
+	TArray<TSet<nodeindex_t>> dirty;
+	dirty.SetNum(numLayers);
+	auto markParent = [&dirty](const AeonixNode& node)
+	{
+		if (node.Parent.IsValid() && dirty.IsValidIndex(node.Parent.GetLayerIndex()))
+		{
+			dirty[node.Parent.GetLayerIndex()].Add(node.Parent.GetNodeIndex());
+		}
+	};
+
+	for (int32 slot = 0; slot < affectedNodes.Num(); slot++)
+	{
+		const AeonixNode& node = layer0[affectedNodes[slot]];
+		const nodeindex_t leafIndex = node.FirstChild.GetNodeIndex();
+		uint8 leafMin = MaxClearance;
+		for (int32 word = 0; word < 4; word++)
+		{
+			LeafClearance[leafIndex * 4 + word] = 0;
+		}
+		for (int32 subnode = 0; subnode < 64; subnode++)
+		{
+			const uint8 arrival = leafArrival[slot * 64 + subnode];
+			LeafClearance[leafIndex * 4 + (subnode >> 4)] |= static_cast<uint64>(arrival) << ((subnode & 15) * 4);
+			leafMin = FMath::Min(leafMin, arrival);
+		}
+		NodeClearance[0][affectedNodes[slot]] = leafMin;
+		markParent(node);
+	}
+
+	for (const AeonixLink& link : freeNodes)
+	{
+		NodeClearance[link.GetLayerIndex()][link.GetNodeIndex()] = MeasureFreeNode(aOctreeData, link.GetLayerIndex(), link.GetNodeIndex());
+		markParent(aOctreeData.Layers[link.GetLayerIndex()][link.GetNodeIndex()]);
+	}
+
+	for (int32 layerIndex = 1; layerIndex < numLayers; layerIndex++)
+	{
+		const TArray<AeonixNode>& layer = aOctreeData.Layers[layerIndex];
+		for (const nodeindex_t nodeIndex : dirty[layerIndex])
+		{
+			if (!layer.IsValidIndex(nodeIndex) || !layer[nodeIndex].HasChildren())
+			{
+				continue;
+			}
+
+			uint8 nodeMin = MaxClearance;
+			const nodeindex_t firstChild = layer[nodeIndex].FirstChild.GetNodeIndex();
+			for (int32 child = 0; child < 8; child++)
+			{
+				if (NodeClearance[layerIndex - 1].IsValidIndex(firstChild + child))
+				{
+					nodeMin = FMath::Min(nodeMin, NodeClearance[layerIndex - 1][firstChild + child]);
+				}
+			}
+			NodeClearance[layerIndex][nodeIndex] = nodeMin;
+			markParent(layer[nodeIndex]);
+		}
+	}
+}
+
+void FAeonixClearance::GrowWave(TMap<uint64, uint64>& aReached, uint_fast32_t aCellsPerSide, const TSet<uint64>* aBounds, TFunctionRef<void(uint8, const TMap<uint64, uint64>&)> aOnStep)
+{
+	TMap<uint64, uint64> grown;
+	for (uint8 step = 1; step < MaxClearance && aReached.Num() > 0; step++)
+	{
+		// One step along each axis in turn is a box dilation, which grows the reached subnodes by one in Chebyshev distance
+		for (int32 axis = 0; axis < 3; axis++)
+		{
+			grown.Reset();
+			grown.Reserve(aReached.Num());
+			for (const TPair<uint64, uint64>& cell : aReached)
+			{
+				grown.FindOrAdd(cell.Key) |= AeonixLeafNode::DilateMaskAlongAxis(cell.Value, axis);
+
+				uint_fast32_t coords[3];
+				morton3D_64_decode(cell.Key, coords[0], coords[1], coords[2]);
+
+				// Subnodes on the positive face step onto the negative face of the next cell along, and the other way round
+				for (int32 sign = 0; sign < 2; sign++)
+				{
+					const uint64 face = cell.Value & AeonixLeafNode::GetFaceMask(axis * 2 + sign);
+					if (!face)
+					{
+						continue;
+					}
+
+					uint_fast32_t next[3] = { coords[0], coords[1], coords[2] };
+					if (sign == 0 ? next[axis] + 1 >= aCellsPerSide : next[axis] == 0)
+					{
+						continue;
+					}
+					next[axis] = sign == 0 ? next[axis] + 1 : next[axis] - 1;
+
+					const uint64 nextCode = morton3D_64_encode(next[0], next[1], next[2]);
+					if (aBounds && !aBounds->Contains(nextCode))
+					{
+						continue;
+					}
+
+					const uint64 moved = sign == 0 ? face >> (9 << axis) : face << (9 << axis);
+					grown.FindOrAdd(nextCode) |= moved;
+				}
+			}
+			Swap(aReached, grown);
+		}
+
+		aOnStep(step, aReached);
+	}
+}
+
+uint8 FAeonixClearance::MeasureFreeNode(const FAeonixOctreeData& aOctreeData, layerindex_t aLayer, nodeindex_t aNodeIndex)
+{
+	const TArray<AeonixNode>& layer0 = aOctreeData.Layers[0];
+	const int64 cellsPerSide = 1ll << (aOctreeData.Layers.Num() - 1);
+	const int64 nodeCells = 1ll << aLayer;
+
+	uint_fast32_t coords[3];
+	morton3D_64_decode(aOctreeData.Layers[aLayer][aNodeIndex].Code, coords[0], coords[1], coords[2]);
+
+	int64 boxMin[3], boxMax[3], first[3], last[3];
+	for (int32 axis = 0; axis < 3; axis++)
+	{
+		boxMin[axis] = static_cast<int64>(coords[axis]) * nodeCells;
+		boxMax[axis] = boxMin[axis] + nodeCells - 1;
+		first[axis] = FMath::Max<int64>(boxMin[axis] - ReachCells, 0);
+		last[axis] = FMath::Min<int64>(boxMax[axis] + ReachCells, cellsPerSide - 1);
+	}
+
+	uint8 nearest = MaxClearance;
+	for (int64 z = first[2]; z <= last[2]; z++)
+	{
+		for (int64 y = first[1]; y <= last[1]; y++)
+		{
+			// Nothing inside the node is blocked, so only the shell of cells round it is looked at
+			const bool bCrossesNode = z >= boxMin[2] && z <= boxMax[2] && y >= boxMin[1] && y <= boxMax[1];
+			for (int64 x = first[0]; x <= last[0]; x++)
+			{
+				if (bCrossesNode && x == boxMin[0])
+				{
+					x = boxMax[0];
+					continue;
+				}
+
+				const int32 nodeIndex = FindNode(layer0, morton3D_64_encode(static_cast<uint_fast32_t>(x), static_cast<uint_fast32_t>(y), static_cast<uint_fast32_t>(z)));
+				if (nodeIndex == INDEX_NONE || !layer0[nodeIndex].HasChildren() || !aOctreeData.LeafNodes.IsValidIndex(layer0[nodeIndex].FirstChild.GetNodeIndex()))
+				{
+					continue;
+				}
+
+				const int64 cell[3] = { x, y, z };
+				for (uint64 bits = aOctreeData.LeafNodes[layer0[nodeIndex].FirstChild.GetNodeIndex()].VoxelGrid; bits; bits &= bits - 1)
+				{
+					uint_fast32_t subnode[3];
+					morton3D_64_decode(FMath::CountTrailingZeros64(bits), subnode[0], subnode[1], subnode[2]);
+
+					// The wave grows in Chebyshev steps, so reaches the node after as many as the widest gap along one axis
+					int64 distance = 0;
+					for (int32 axis = 0; axis < 3; axis++)
+					{
+						const int64 position = cell[axis] * 4 + subnode[axis];
+						distance = FMath::Max(distance, FMath::Max(boxMin[axis] * 4 - position, position - (boxMax[axis] * 4 + 3)));
+					}
+					nearest = static_cast<uint8>(FMath::Min<int64>(nearest, distance));
+				}
+			}
+		}
+	}
+	return nearest;
+}
+
+void FAeonixClearance::Invalidate()
+{
+	bIsValid = false;
+}
+
+void FAeonixClearance::Reset()
+{
+	LeafClearance.Empty();
+	NodeClearance.Empty();
+	bIsValid = false;
+}
+
+uint8 FAeonixClearance::GetSubnodeClearance(nodeindex_t aLeafIndex, subnodeindex_t aSubnode) const
+{
+	const int32 word = aLeafIndex * 4 + (aSubnode >> 4);
+	if (!LeafClearance.IsValidIndex(word))
+	{
+		return 0;
+	}
+	return static_cast<uint8>((LeafClearance[word] >> ((aSubnode & 15) * 4)) & 0xF);
+}
+
+uint8 FAeonixClearance::GetNodeClearance(layerindex_t aLayer, nodeindex_t aNodeIndex) const
+{
+	if (!NodeClearance.IsValidIndex(aLayer) || !NodeClearance[aLayer].IsValidIndex(aNodeIndex))
+	{
+		return 0;
+	}
+	return NodeClearance[aLayer][aNodeIndex];
+}
@@ -0,0 +1,300 @@
+#include "Data/AeonixConnectivity.h"
+#include "Data/AeonixOctreeData.h"
+#include "Data/AeonixStats.h"
+#include "AeonixNavigation.h"
+
+namespace
+{
+	int32 FindRoot(TArray<int32>& aParents, int32 aElement)
+	{
+		while (aParents[aElement] != aElement)
+		{
+			// Path halving
+			aParents[aElement] = aParents[aParents[aElement]];
+			aElement = aParents[aElement];
+		}
+		return aElement;
+	}
+
+	void Union(TArray<int32>& aParents, int32 aA, int32 aB)
+	{
+		if (aA == INDEX_NONE || aB == INDEX_NONE)
+		{
+			return;
+		}
+
+		const int32 rootA = FindRoot(aParents, aA);
+		const int32 rootB = FindRoot(aParents, aB);
+		if (rootA != rootB)
+		{
+			aParents[FMath::Max(rootA, rootB)] = FMath::Min(rootA, rootB);
+		}
+	}
+}
+
+void FAeonixConnectivity::Build(const FAeonixOctreeData& aOctreeData)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AeonixConnectivityBuild);
+
+	Reset();
+
+	const int32 numLayers = aOctreeData.Layers.Num();
+	if (numLayers == 0)
+	{
+		return;
+	}
+
+	// Split the free space of every leaf into regions by flood filling the free mask
+	const int32 numLeaves = aOctreeData.LeafNodes.Num();
+	LeafRegionStart.SetNumUninitialized(numLeaves + 1);
+	for (int32 leafIndex = 0; leafIndex < numLeaves; leafIndex++)
+	{
+		LeafRegionStart[leafIndex] = LeafRegionMasks.Num();
+
+		uint64 remaining = ~static_cast<uint64>(aOctreeData.LeafNodes[leafIndex].VoxelGrid);
+		while (remaining)
+		{
+			const uint64 region = AeonixLeafNode::FloodFillMask(remaining & (~remaining + 1), remaining);
+			LeafRegionMasks.Add(region);
+			remaining &= ~region;
+		}
+	}
+	LeafRegionStart[numLeaves] = LeafRegionMasks.Num();
+
+	// Union-find elements are every node, followed by every leaf region
+	TArray<int32, TInlineAllocator<16>> nodeElementStart;
+	int32 numElements = 0;
+	for (int32 layerIndex = 0; layerIndex < numLayers; layerIndex++)
+	{
+		nodeElementStart.Add(numElements);
+		numElements += aOctreeData.Layers[layerIndex].Num();
+	}
+	const int32 regionElementStart = numElements;
+	numElements += LeafRegionMasks.Num();
+
+	TArray<int32> parents;
+	parents.SetNumUninitialized(numElements);
+	for (int32 i = 0; i < numElements; i++)
+	{
+		parents[i] = i;
+	}
+
+	auto getElement = [&](const AeonixLink& aLink) -> int32
+	{
+		const AeonixNode& node = aOctreeData.GetNode(aLink);
+		if (aLink.GetLayerIndex() == 0 && node.HasChildren())
+		{
+			const int32 region = GetLeafRegion(node.FirstChild.GetNodeIndex(), aLink.GetSubnodeIndex());
+			return region == INDEX_NONE ? INDEX_NONE : regionElementStart + region;
+		}
+		return nodeElementStart[aLink.GetLayerIndex()] + aLink.GetNodeIndex();
+	};
+
+	TArray<AeonixLink> neighbours;
+
+	// Nodes without children are free as a whole, join them to everything the pathfinder can step to from them
+	for (int32 layerIndex = 0; layerIndex < numLayers; layerIndex++)
+	{
+		const TArray<AeonixNode>& layer = aOctreeData.Layers[layerIndex];
+		for (int32 nodeIndex = 0; nodeIndex < layer.Num(); nodeIndex++)
+		{
+			if (layer[nodeIndex].HasChildren())
+			{
+				continue;
+			}
+
+			neighbours.Reset();
+			aOctreeData.GetNeighbours(AeonixLink(layerIndex, nodeIndex, 0), neighbours);
+
+			const int32 element = nodeElementStart[layerIndex] + nodeIndex;
+			for (const AeonixLink& neighbour : neighbours)
+			{
+				Union(parents, element, getElement(neighbour));
+			}
+		}
+	}
+
+	// Join leaf regions across the leaf faces. Leaves only ever touch free nodes or other leaves, so whole faces can be matched with masks
+	const TArray<AeonixNode>& layer0 = aOctreeData.Layers[0];
+	TBitArray<> leafInUse(false, numLeaves);
+	for (int32 nodeIndex = 0; nodeIndex < layer0.Num(); nodeIndex++)
+	{
+		const AeonixNode& node = layer0[nodeIndex];
+		if (!node.HasChildren())
+		{
+			continue;
+		}
+
+		const int32 leafIndex = node.FirstChild.GetNodeIndex();
+		leafInUse[leafIndex] = true;
+
+		for (int32 direction = 0; direction < 6; direction++)
+		{
+			const AeonixLink& neighbourLink = node.myNeighbours[direction];
+			if (!neighbourLink.IsValid())
+			{
+				continue;
+			}
+
+			const AeonixNode& neighbourNode = aOctreeData.GetNode(neighbourLink);
+			const uint64 faceMask = AeonixLeafNode::GetFaceMask(direction);
+
+			for (int32 region = LeafRegionStart[leafIndex]; region < LeafRegionStart[leafIndex + 1]; region++)
+			{
+				const uint64 regionFace = LeafRegionMasks[region] & faceMask;
+				if (!regionFace)
+				{
+					continue;
+				}
+
+				if (!neighbourNode.HasChildren())
+				{
+					Union(parents, regionElementStart + region, nodeElementStart[neighbourLink.GetLayerIndex()] + neighbourLink.GetNodeIndex());
+				}
+				else if (neighbourLink.GetLayerIndex() == 0)
+				{
+					// Move our face onto the opposite face of the neighbouring leaf
+					const int32 shift = 9 << (direction / 2);
+					const uint64 facing = (direction & 1) ? regionFace << shift : regionFace >> shift;
+
+					const int32 neighbourLeaf = neighbourNode.FirstChild.GetNodeIndex();
+					for (int32 neighbourRegion = LeafRegionStart[neighbourLeaf]; neighbourRegion < LeafRegionStart[neighbourLeaf + 1]; neighbourRegion++)
+					{
+						if (facing & LeafRegionMasks[neighbourRegion])
+						{
+							Union(parents, regionElementStart + region, regionElementStart + neighbourRegion);
+						}
+					}
+				}
+				else
+				{
+					// Subdivided space above layer 0, fall back to asking for each face subnode's neighbours
+					for (uint64 bits = regionFace; bits; bits &= bits - 1)
+					{
+						const subnodeindex_t subnode = static_cast<subnodeindex_t>(FMath::CountTrailingZeros64(bits));
+
+						neighbours.Reset();
+						aOctreeData.GetLeafNeighbours(AeonixLink(0, nodeIndex, subnode), neighbours);
+						for (const AeonixLink& neighbour : neighbours)
+						{
+							if (neighbour.GetLayerIndex() != 0 || neighbour.GetNodeIndex() != static_cast<uint_fast32_t>(nodeIndex))
+							{
+								Union(parents, regionElementStart + region, getElement(neighbour));
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// Compact the roots into sequential component ids
+	TArray<int32> rootComponents;
+	rootComponents.Init(INDEX_NONE, numElements);
+	auto getComponentForElement = [&](int32 aElement) -> int32
+	{
+		int32& component = rootComponents[FindRoot(parents, aElement)];
+		if (component == INDEX_NONE)
+		{
+			component = NumComponents++;
+		}
+		return component;
+	};
+
+	NodeComponents.SetNum(numLayers);
+	for (int32 layerIndex = 0; layerIndex < numLayers; layerIndex++)
+	{
+		const TArray<AeonixNode>& layer = aOctreeData.Layers[layerIndex];
+		TArray<int32>& components = NodeComponents[layerIndex];
+		components.SetNumUninitialized(layer.Num());
+		for (int32 nodeIndex = 0; nodeIndex < layer.Num(); nodeIndex++)
+		{
+			components[nodeIndex] = layer[nodeIndex].HasChildren() ? INDEX_NONE : getComponentForElement(nodeElementStart[layerIndex] + nodeIndex);
+		}
+	}
+
+	LeafRegionComponents.SetNumUninitialized(LeafRegionMasks.Num());
+	for (int32 leafIndex = 0; leafIndex < numLeaves; leafIndex++)
+	{
+		for (int32 region = LeafRegionStart[leafIndex]; region < LeafRegionStart[leafIndex + 1]; region++)
+		{
+			LeafRegionComponents[region] = leafInUse[leafIndex] ? getComponentForElement(regionElementStart + region) : INDEX_NONE;
+		}
+	}
+
+	bIsValid = true;
+
+	UE_LOG(LogAeonixNavigation, Log, TEXT("Connectivity: %d component(s) across %d node(s) and %d leaf region(s)"),
+		NumComponents, regionElementStart, LeafRegionMasks.Num());
+}
+
+void FAeonixConnectivity::Invalidate()
+{
+	bIsValid = false;
+}
+
+void FAeonixConnectivity::Reset()
+{
+	NodeComponents.Reset();
+	LeafRegionStart.Reset();
+	LeafRegionMasks.Reset();
+	LeafRegionComponents.Reset();
+	NumComponents = 0;
+	bIsValid = false;
+}
+
+int32 FAeonixConnectivity::GetComponent(const FAeonixOctreeData& aOctreeData, const AeonixLink& aLink) const
+{
+	if (!bIsValid || !aLink.IsValid() || aLink.GetLayerIndex() >= NodeComponents.Num())
+	{
+		return INDEX_NONE;
+	}
+
+	const TArray<int32>& components = NodeComponents[aLink.GetLayerIndex()];
+	if (aLink.GetNodeIndex() >= static_cast<uint_fast32_t>(components.Num()))
+	{
+		return INDEX_NONE;
+	}
+
+	const AeonixNode& node = aOctreeData.GetNode(aLink);
+	if (aLink.GetLayerIndex() == 0 && node.HasChildren())
+	{
+		const int32 region = GetLeafRegion(node.FirstChild.GetNodeIndex(), aLink.GetSubnodeIndex());
+		return region == INDEX_NONE ? INDEX_NONE : LeafRegionComponents[region];
+	}
+
+	return components[aLink.GetNodeIndex()];
+}
+
+bool FAeonixConnectivity::AreConnected(const FAeonixOctreeData& aOctreeData, const AeonixLink& aStart, const AeonixLink& aTarget) const
+{
+	const int32 startComponent = GetComponent(aOctreeData, aStart);
+	const int32 targetComponent = GetComponent(aOctreeData, aTarget);
+
+	return startComponent == INDEX_NONE || targetComponent == INDEX_NONE || startComponent == targetComponent;
+}
+
+int32 FAeonixConnectivity::GetLeafRegion(nodeindex_t aLeafIndex, subnodeindex_t aSubnode) const
+{
+	if (aLeafIndex < 0 || aLeafIndex + 1 >= LeafRegionStart.Num())
+	{
+		return INDEX_NONE;
+	}
+
+	const uint64 subnodeBit = 1ull << aSubnode;
+	for (int32 region = LeafRegionStart[aLeafIndex]; region < LeafRegionStart[aLeafIndex + 1]; region++)
+	{
+		if (LeafRegionMasks[region] & subnodeBit)
+		{
+			return region;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+uint64 FAeonixConnectivity::GetLeafRegionMask(nodeindex_t aLeafIndex, subnodeindex_t aSubnode) const
+{
+	const int32 region = GetLeafRegion(aLeafIndex, aSubnode);
+	return region == INDEX_NONE ? 0 : LeafRegionMasks[region];
+}
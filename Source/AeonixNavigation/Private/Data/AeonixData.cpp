@@ -5,6 +5,10 @@
 #include "AeonixNavigation.h"
 #include "Data/AeonixStats.h"
 
+#include "Algo/BinarySearch.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+
 void FAeonixData::SetExtents(const FVector& Origin, const FVector& Extents)
 {
 	GenerationParameters.Origin = Origin;
@@ -23,6 +27,13 @@ void FAeonixData::ResetForGeneration()
 	// Clear existing Octree data
 	OctreeData.Layers.Empty();
 	OctreeData.LeafNodes.Empty();
+	Connectivity.Reset();
+	Landmarks.Reset();
+	Adjacency.Reset();
+	Clearance.Reset();
+	FreeVolume.Reset();
+	RecentLeafChanges.Empty();
+	RecentLeafChangedVoxels.Empty();
 }
 
 void FAeonixData::UpdateGenerationParameters(const FAeonixGenerationParameters& Params)
@@ -63,6 +74,13 @@ void FAeonixData::Generate(UWorld& World, const IAeonixCollisionQueryInterface&
 	{
 		BuildNeighbourLinks(i, DebugInterface);
 	}
+
+	BuildConnectivity();
+	BuildFreeVolume();
+	BuildAdjacency();
+	BuildClearance();
+	BuildLandmarks();
+	GenerationId++;
 }
 
 void FAeonixData::RegenerateDynamicSubregions(const IAeonixCollisionQueryInterface& CollisionInterface, const IAeonixDebugDrawInterface& DebugInterface)
@@ -73,6 +91,8 @@ void FAeonixData::RegenerateDynamicSubregions(const IAeonixCollisionQueryInterfa
 		GenerationParameters.DynamicRegionBoxes.Num());
 
 	int32 TotalNodesUpdated = 0;
+	TArray<nodeindex_t> ChangedLeaves;
+	TArray<uint64> ChangedVoxels;
 	int32 RegionIndex = 0;
 
 	// Regenerate leaf voxels within dynamic regions by re-sampling collision geometry
@@ -125,6 +145,8 @@ void FAeonixData::RegenerateDynamicSubregions(const IAeonixCollisionQueryInterfa
 							// NodeIdx in Layer0 array corresponds to the same index in LeafNodes array
 							nodeindex_t LeafIndex = NodeIdx;
 
+							const uint64 OldVoxelGrid = LeafIndex < OctreeData.LeafNodes.Num() ? OctreeData.LeafNodes[LeafIndex].VoxelGrid : 0;
+
 							// IMPORTANT: Clear the existing leaf node data first
 							if (LeafIndex < OctreeData.LeafNodes.Num())
 							{
@@ -135,6 +157,11 @@ void FAeonixData::RegenerateDynamicSubregions(const IAeonixCollisionQueryInterfa
 							// Also need to pass the corner of the node, not center
 							FVector LeafOrigin = NodePosition - FVector(VoxelSize * 0.5f);
 							RasterizeLeafNode(LeafOrigin, LeafIndex, CollisionInterface, DebugInterface);
+							if (LeafIndex < OctreeData.LeafNodes.Num() && OctreeData.LeafNodes[LeafIndex].VoxelGrid != OldVoxelGrid)
+							{
+								ChangedLeaves.Add(LeafIndex);
+								ChangedVoxels.Add(OctreeData.LeafNodes[LeafIndex].VoxelGrid ^ OldVoxelGrid);
+							}
 
 							// Update the FirstChild link to mark this as having valid leaf data
 							AeonixNode& Node = Layer0[NodeIdx];
@@ -168,6 +195,14 @@ void FAeonixData::RegenerateDynamicSubregions(const IAeonixCollisionQueryInterfa
 	// Rebuild neighbor links for Layer 0 after dynamic regeneration
 	// This is critical because neighbor links become stale when leaf voxels change
 	BuildNeighbourLinks(0, DebugInterface);
+
+	UpdateAdjacency(ChangedLeaves);
+	UpdateClearance(ChangedLeaves);
+	RecordLeafChanges(MoveTemp(ChangedLeaves), MoveTemp(ChangedVoxels));
+
+	// Rebuilt off the game thread by the volume once the leaves settle, see TakeDerivedData
+	InvalidateConnectivity();
+	InvalidateFreeVolume();
 }
 
 void FAeonixData::RegenerateDynamicSubregions(const TSet<FGuid>& RegionIds, const IAeonixCollisionQueryInterface& CollisionInterface, const IAeonixDebugDrawInterface& DebugInterface)
@@ -178,6 +213,8 @@ void FAeonixData::RegenerateDynamicSubregions(const TSet<FGuid>& RegionIds, cons
 		RegionIds.Num(), GenerationParameters.DynamicRegionBoxes.Num());
 
 	int32 TotalNodesUpdated = 0;
+	TArray<nodeindex_t> ChangedLeaves;
+	TArray<uint64> ChangedVoxels;
 	int32 RegionIndex = 0;
 
 	// Regenerate only the specified regions
@@ -235,6 +272,8 @@ void FAeonixData::RegenerateDynamicSubregions(const TSet<FGuid>& RegionIds, cons
 							// Get or calculate the leaf index
 							nodeindex_t LeafIndex = NodeIdx;
 
+							const uint64 OldVoxelGrid = LeafIndex < OctreeData.LeafNodes.Num() ? OctreeData.LeafNodes[LeafIndex].VoxelGrid : 0;
+
 							// Clear the existing leaf node data first
 							if (LeafIndex < OctreeData.LeafNodes.Num())
 							{
@@ -244,6 +283,11 @@ void FAeonixData::RegenerateDynamicSubregions(const TSet<FGuid>& RegionIds, cons
 							// Re-rasterize the leaf voxels
 							FVector LeafOrigin = NodePosition - FVector(VoxelSize * 0.5f);
 							RasterizeLeafNode(LeafOrigin, LeafIndex, CollisionInterface, DebugInterface);
+							if (LeafIndex < OctreeData.LeafNodes.Num() && OctreeData.LeafNodes[LeafIndex].VoxelGrid != OldVoxelGrid)
+							{
+								ChangedLeaves.Add(LeafIndex);
+								ChangedVoxels.Add(OctreeData.LeafNodes[LeafIndex].VoxelGrid ^ OldVoxelGrid);
+							}
 
 							// Update the FirstChild link
 							AeonixNode& Node = Layer0[NodeIdx];
@@ -277,6 +321,315 @@ void FAeonixData::RegenerateDynamicSubregions(const TSet<FGuid>& RegionIds, cons
 	// Rebuild neighbor links for Layer 0 after dynamic regeneration
 	// This is critical because neighbor links become stale when leaf voxels change
 	BuildNeighbourLinks(0, DebugInterface);
+
+	UpdateAdjacency(ChangedLeaves);
+	UpdateClearance(ChangedLeaves);
+	RecordLeafChanges(MoveTemp(ChangedLeaves), MoveTemp(ChangedVoxels));
+
+	// Rebuilt off the game thread by the volume once the leaves settle, see TakeDerivedData
+	InvalidateConnectivity();
+	InvalidateFreeVolume();
+}
+
+void FAeonixData::BuildConnectivity()
+{
+	Connectivity.Build(OctreeData);
+}
+
+void FAeonixData::InvalidateConnectivity()
+{
+	Connectivity.Invalidate();
+}
+
+void FAeonixData::TakeDerivedData(FAeonixData& aRebuilt)
+{
+	if (aRebuilt.Connectivity.IsValid())
+	{
+		Connectivity = MoveTemp(aRebuilt.Connectivity);
+	}
+	if (aRebuilt.FreeVolume.IsValid())
+	{
+		FreeVolume = MoveTemp(aRebuilt.FreeVolume);
+	}
+	if (aRebuilt.Landmarks.IsValid())
+	{
+		Landmarks = MoveTemp(aRebuilt.Landmarks);
+	}
+}
+
+void FAeonixData::BuildLandmarks()
+{
+	Landmarks.Build(*this, GenerationParameters.NumLandmarks);
+}
+
+void FAeonixData::InvalidateLandmarks()
+{
+	Landmarks.Invalidate();
+}
+
+void FAeonixData::BuildAdjacency()
+{
+	if (GenerationParameters.bBakeAdjacency)
+	{
+		Adjacency.Build(OctreeData);
+	}
+	else
+	{
+		Adjacency.Reset();
+	}
+}
+
+void FAeonixData::UpdateAdjacency(TConstArrayView<nodeindex_t> aChangedLeaves)
+{
+	Adjacency.UpdateLeaves(OctreeData, aChangedLeaves);
+}
+
+void FAeonixData::GetNeighbours(const AeonixLink& aLink, TArray<AeonixLink>& oNeighbours) const
+{
+	if (Adjacency.IsValid())
+	{
+		oNeighbours.Append(Adjacency.GetNeighbours(aLink));
+	}
+	else
+	{
+		OctreeData.GetNeighbours(aLink, oNeighbours);
+	}
+}
+
+void FAeonixData::BuildClearance()
+{
+	if (GenerationParameters.bBakeClearance)
+	{
+		Clearance.Build(OctreeData);
+	}
+	else
+	{
+		Clearance.Reset();
+	}
+}
+
+void FAeonixData::UpdateClearance(TConstArrayView<nodeindex_t> aChangedLeaves)
+{
+	if (GenerationParameters.bBakeClearance)
+	{
+		Clearance.UpdateLeaves(OctreeData, aChangedLeaves);
+	}
+	else
+	{
+		Clearance.Reset();
+	}
+}
+
+void FAeonixData::InvalidateClearance()
+{
+	Clearance.Invalidate();
+}
+
+float FAeonixData::GetLinkClearance(const AeonixLink& aLink) const
+{
+	if (!Clearance.IsValid())
+	{
+		return FLT_MAX;
+	}
+
+	// A clearance of N subnodes puts the nearest blocked subnode's centre N subnodes away, and its near face half a subnode closer.
+	// A node is as far from it as its nearest subnode, plus the rest of the way to its centre
+	const float SubnodeSize = GetVoxelSize(0) * 0.25f;
+	const AeonixNode& Node = OctreeData.GetNode(aLink);
+	if (aLink.GetLayerIndex() == 0 && Node.HasChildren())
+	{
+		const uint8 SubnodeClearance = Clearance.GetSubnodeClearance(Node.FirstChild.GetNodeIndex(), aLink.GetSubnodeIndex());
+		return SubnodeClearance == 0 ? 0.f : (SubnodeClearance - 0.5f) * SubnodeSize;
+	}
+
+	const uint8 NodeClearance = Clearance.GetNodeClearance(aLink.GetLayerIndex(), aLink.GetNodeIndex());
+	return NodeClearance == 0 ? 0.f : GetVoxelSize(aLink.GetLayerIndex()) * 0.5f + (NodeClearance - 1) * SubnodeSize;
+}
+
+void FAeonixData::BuildFreeVolume()
+{
+	FreeVolume.Build(*this);
+}
+
+void FAeonixData::InvalidateFreeVolume()
+{
+	FreeVolume.Invalidate();
+}
+
+bool FAeonixData::GetRandomNavigablePoint(FRandomStream& aRandom, AeonixLink& oLink, FVector& oPosition) const
+{
+	return FreeVolume.GetRandomPoint(*this, aRandom, INDEX_NONE, oLink, oPosition);
+}
+
+bool FAeonixData::GetRandomReachablePoint(const AeonixLink& aOrigin, FRandomStream& aRandom, AeonixLink& oLink, FVector& oPosition) const
+{
+	const int32 Component = Connectivity.GetComponent(OctreeData, aOrigin);
+	if (Component == INDEX_NONE)
+	{
+		return false;
+	}
+
+	return FreeVolume.GetRandomPoint(*this, aRandom, Component, oLink, oPosition);
+}
+
+bool FAeonixData::GetRandomNavigablePointInBox(const FBox& aBox, FRandomStream& aRandom, AeonixLink& oLink, FVector& oPosition) const
+{
+	const int32 RootLayer = GetRootLayer();
+	if (RootLayer < 0 || !aBox.IsValid)
+	{
+		return false;
+	}
+
+	// The free parts of the octree inside the box, each clipped to it, with a running total of their volume
+	struct FCandidate
+	{
+		AeonixLink Link;
+		FBox Bounds;
+	};
+	TArray<FCandidate> Candidates;
+	TArray<double> CumulativeVolume;
+	auto AddCandidate = [&](const AeonixLink& aLink, const FBox& aBounds)
+	{
+		const FBox Clipped = aBounds.Overlap(aBox);
+		const double Volume = Clipped.GetVolume();
+		if (Volume > 0.0)
+		{
+			Candidates.Add({ aLink, Clipped });
+			CumulativeVolume.Add((CumulativeVolume.Num() > 0 ? CumulativeVolume.Last() : 0.0) + Volume);
+		}
+	};
+
+	const float SubnodeSize = GetVoxelSize(0) * 0.25f;
+
+	TArray<AeonixLink, TInlineAllocator<64>> WorkingSet;
+	for (int32 i = 0; i < OctreeData.GetLayer(RootLayer).Num(); i++)
+	{
+		WorkingSet.Add(AeonixLink(RootLayer, i, 0));
+	}
+
+	while (WorkingSet.Num() > 0)
+	{
+		const AeonixLink Current = WorkingSet.Pop(EAllowShrinking::No);
+		const AeonixNode& Node = OctreeData.GetNode(Current);
+		const FBox Bounds = GetNodeBounds(Current.GetLayerIndex(), Node.Code);
+		if (!Bounds.Intersect(aBox))
+		{
+			continue;
+		}
+
+		if (!Node.HasChildren())
+		{
+			AddCandidate(Current, Bounds);
+		}
+		else if (Current.GetLayerIndex() > 0)
+		{
+			for (int32 Child = 0; Child < 8; Child++)
+			{
+				WorkingSet.Add(AeonixLink(Node.FirstChild.GetLayerIndex(), Node.FirstChild.GetNodeIndex() + Child, 0));
+			}
+		}
+		else
+		{
+			uint64 Free = ~static_cast<uint64>(OctreeData.GetLeafNode(Node.FirstChild.GetNodeIndex()).VoxelGrid);
+			while (Free)
+			{
+				const uint64 Index = FMath::CountTrailingZeros64(Free);
+				Free &= Free - 1;
+
+				uint_fast32_t X = 0, Y = 0, Z = 0;
+				morton3D_64_decode(Index, X, Y, Z);
+				const FVector Min = Bounds.Min + FVector(X, Y, Z) * SubnodeSize;
+				AddCandidate(AeonixLink(0, Current.GetNodeIndex(), static_cast<subnodeindex_t>(Index)), FBox(Min, Min + FVector(SubnodeSize)));
+			}
+		}
+	}
+
+	if (Candidates.Num() == 0)
+	{
+		return false;
+	}
+
+	const double Pick = aRandom.GetFraction() * CumulativeVolume.Last();
+	const int32 Index = FMath::Min(Algo::UpperBound(CumulativeVolume, Pick), Candidates.Num() - 1);
+	const FBox& Picked = Candidates[Index].Bounds;
+	oLink = Candidates[Index].Link;
+	oPosition = Picked.Min + FVector(aRandom.GetFraction(), aRandom.GetFraction(), aRandom.GetFraction()) * Picked.GetSize();
+	return true;
+}
+
+void FAeonixData::RecordLeafChanges(TArray<nodeindex_t>&& ChangedLeaves, TArray<uint64>&& ChangedVoxels)
+{
+	static constexpr int32 MaxLeafChangeHistory = 8;
+
+	if (ChangedLeaves.Num() > 0)
+	{
+		InvalidateLandmarks();
+	}
+
+	// Without the flipped subnodes, every one of a changed leaf's might have
+	if (ChangedVoxels.Num() != ChangedLeaves.Num())
+	{
+		ChangedVoxels.Init(~0ull, ChangedLeaves.Num());
+	}
+
+	if (RecentLeafChanges.Num() >= MaxLeafChangeHistory)
+	{
+		RecentLeafChanges.RemoveAt(0);
+		RecentLeafChangedVoxels.RemoveAt(0);
+	}
+	RecentLeafChanges.Add(MoveTemp(ChangedLeaves));
+	RecentLeafChangedVoxels.Add(MoveTemp(ChangedVoxels));
+	LeafChangeSerial++;
+}
+
+bool FAeonixData::GetLeafChangesSince(uint32 Serial, TArray<nodeindex_t>& OutLeaves) const
+{
+	const uint32 NumChanges = LeafChangeSerial - Serial;
+	if (NumChanges > static_cast<uint32>(RecentLeafChanges.Num()))
+	{
+		return false;
+	}
+
+	for (int32 Index = RecentLeafChanges.Num() - NumChanges; Index < RecentLeafChanges.Num(); ++Index)
+	{
+		OutLeaves.Append(RecentLeafChanges[Index]);
+	}
+	return true;
+}
+
+bool FAeonixData::GetLeafChangesSince(uint32 Serial, TArray<nodeindex_t>& OutLeaves, TArray<uint64>& OutChangedVoxels) const
+{
+	if (!GetLeafChangesSince(Serial, OutLeaves))
+	{
+		return false;
+	}
+
+	const uint32 NumChanges = LeafChangeSerial - Serial;
+	for (int32 Index = RecentLeafChangedVoxels.Num() - NumChanges; Index < RecentLeafChangedVoxels.Num(); ++Index)
+	{
+		OutChangedVoxels.Append(RecentLeafChangedVoxels[Index]);
+	}
+	return true;
+}
+
+bool FAeonixData::AreLinksConnected(const AeonixLink& aStart, const AeonixLink& aTarget) const
+{
+	return Connectivity.AreConnected(OctreeData, aStart, aTarget);
+}
+
+uint64 FAeonixData::GetLeafRegionMask(nodeindex_t aLeafIndex, subnodeindex_t aSubnode) const
+{
+	if (Connectivity.IsValid())
+	{
+		return Connectivity.GetLeafRegionMask(aLeafIndex, aSubnode);
+	}
+
+	if (!OctreeData.LeafNodes.IsValidIndex(aLeafIndex))
+	{
+		return 0;
+	}
+
+	return AeonixLeafNode::FloodFillMask(1ull << aSubnode, ~static_cast<uint64>(OctreeData.LeafNodes[aLeafIndex].VoxelGrid));
 }
 
 int32 FAeonixData::GetNumNodesInLayer(layerindex_t Layer) const
@@ -322,6 +675,713 @@ float FAeonixData::GetVoxelSize(layerindex_t Layer) const
 	return (GenerationParameters.Extents.X / FMath::Pow(2.f, GenerationParameters.OctreeDepth)) * (FMath::Pow(2.0f, Layer + 1));
 }
 
+namespace
+{
+	// Clips the segment aStart + t * aDelta, t in [aMinTime, aMaxTime], to aBox. False if it misses, touching counts as a hit
+	bool ClipSegmentToBox(const FBox& aBox, const FVector& aStart, const FVector& aDelta, float aMinTime, float aMaxTime, float& oEntry, float& oExit)
+	{
+		float entry = aMinTime;
+		float exit = aMaxTime;
+		for (int32 axis = 0; axis < 3; axis++)
+		{
+			if (FMath::IsNearlyZero(aDelta[axis]))
+			{
+				if (aStart[axis] < aBox.Min[axis] || aStart[axis] > aBox.Max[axis])
+				{
+					return false;
+				}
+				continue;
+			}
+
+			float t0 = (aBox.Min[axis] - aStart[axis]) / aDelta[axis];
+			float t1 = (aBox.Max[axis] - aStart[axis]) / aDelta[axis];
+			if (t0 > t1)
+			{
+				Swap(t0, t1);
+			}
+
+			entry = FMath::Max(entry, t0);
+			exit = FMath::Min(exit, t1);
+			if (entry > exit)
+			{
+				return false;
+			}
+		}
+
+		oEntry = entry;
+		oExit = exit;
+		return true;
+	}
+
+	struct FTraceEntry
+	{
+		float Time;
+		AeonixLink Link;
+
+		bool operator<(const FTraceEntry& Other) const { return Time < Other.Time; }
+	};
+
+	struct FProjectionEntry
+	{
+		float Distance;
+		AeonixLink Link;
+
+		bool operator<(const FProjectionEntry& Other) const { return Distance < Other.Distance; }
+	};
+}
+
+bool FAeonixData::IsSegmentClear(const FVector& aStart, const FVector& aEnd) const
+{
+	// Anything leaving the volume isn't navigable
+	const FBox VolumeBounds(GenerationParameters.Origin - GenerationParameters.Extents, GenerationParameters.Origin + GenerationParameters.Extents);
+	if (!VolumeBounds.IsInsideOrOn(aStart) || !VolumeBounds.IsInsideOrOn(aEnd))
+	{
+		return false;
+	}
+
+	float HitTime = 1.f;
+	return !TraceSegment(aStart, aEnd, GetRootLayer(), false, HitTime);
+}
+
+bool FAeonixData::RaycastNav(const FVector& aStart, const FVector& aEnd, FAeonixNavRaycastHit& oHit) const
+{
+	oHit = FAeonixNavRaycastHit();
+
+	// Leaving the volume is as much a hit as anything in it
+	const FBox VolumeBounds(GenerationParameters.Origin - GenerationParameters.Extents, GenerationParameters.Origin + GenerationParameters.Extents);
+	float TraceEnd = 1.f;
+	if (!VolumeBounds.IsInsideOrOn(aStart))
+	{
+		oHit.bBlockingHit = true;
+		oHit.Time = 0.f;
+	}
+	else if (!VolumeBounds.IsInsideOrOn(aEnd))
+	{
+		float Entry = 0.f;
+		ClipSegmentToBox(VolumeBounds, aStart, aEnd - aStart, 0.f, 1.f, Entry, TraceEnd);
+		oHit.bBlockingHit = true;
+		oHit.Time = TraceEnd;
+	}
+
+	if (oHit.Time > 0.f)
+	{
+		float HitTime = 1.f;
+		if (TraceSegment(aStart, FMath::Lerp(aStart, aEnd, TraceEnd), GetRootLayer(), true, HitTime))
+		{
+			oHit.bBlockingHit = true;
+			oHit.Time = HitTime * TraceEnd;
+		}
+	}
+
+	oHit.Location = FMath::Lerp(aStart, aEnd, oHit.Time);
+	return oHit.bBlockingHit;
+}
+
+void FAeonixData::IsSegmentClearBatch(TConstArrayView<TPair<FVector, FVector>> aSegments, TArray<bool>& oClear) const
+{
+	oClear.SetNumUninitialized(aSegments.Num());
+	for (int32 i = 0; i < aSegments.Num(); i++)
+	{
+		oClear[i] = IsSegmentClear(aSegments[i].Key, aSegments[i].Value);
+	}
+}
+
+void FAeonixData::RaycastNavBatch(TConstArrayView<TPair<FVector, FVector>> aSegments, TArray<FAeonixNavRaycastHit>& oHits) const
+{
+	oHits.SetNum(aSegments.Num());
+	for (int32 i = 0; i < aSegments.Num(); i++)
+	{
+		RaycastNav(aSegments[i].Key, aSegments[i].Value, oHits[i]);
+	}
+}
+
+int32 FAeonixData::GetRootLayer() const
+{
+	int32 RootLayer = OctreeData.GetNumLayers() - 1;
+	while (RootLayer >= 0 && (RootLayer >= OctreeData.Layers.Num() || OctreeData.GetLayer(RootLayer).Num() == 0))
+	{
+		RootLayer--;
+	}
+	return RootLayer;
+}
+
+bool FAeonixData::TraceSegment(const FVector& aStart, const FVector& aEnd, int32 aRootLayer, bool bNearest, float& oHitTime) const
+{
+	if (aRootLayer < 0)
+	{
+		return false;
+	}
+
+	const FVector StartToEnd = aEnd - aStart;
+
+	// Time the segment enters the node, only nodes it passes through before the best hit so far are worth visiting
+	float BestHit = 1.f;
+	bool bHit = false;
+	auto GetEntryTime = [&](const FBox& aBox, float& oEntry)
+	{
+		float Exit = 0.f;
+		return ClipSegmentToBox(aBox, aStart, StartToEnd, 0.f, BestHit, oEntry, Exit);
+	};
+
+	// Kept as a heap on entry time, so with bNearest the first hit found in a leaf bounds everything still to visit
+	TArray<FTraceEntry, TInlineAllocator<64>> WorkingSet;
+
+	const TArray<AeonixNode>& Roots = OctreeData.GetLayer(aRootLayer);
+	for (int32 i = 0; i < Roots.Num(); i++)
+	{
+		float Entry = 0.f;
+		if (Roots[i].HasChildren() && GetEntryTime(GetNodeBounds(aRootLayer, Roots[i].Code), Entry))
+		{
+			WorkingSet.HeapPush({ Entry, AeonixLink(aRootLayer, i, 0) });
+		}
+	}
+
+	const float SubnodeSize = GetVoxelSize(0) * 0.25f;
+
+	while (WorkingSet.Num() > 0)
+	{
+		FTraceEntry Current;
+		WorkingSet.HeapPop(Current, EAllowShrinking::No);
+		if (bHit && Current.Time >= BestHit)
+		{
+			break;
+		}
+
+		const AeonixNode& Node = OctreeData.GetNode(Current.Link);
+
+		if (Current.Link.GetLayerIndex() > 0)
+		{
+			// Only children that are subdivided can contain anything blocked
+			for (int32 Child = 0; Child < 8; Child++)
+			{
+				AeonixLink ChildLink = Node.FirstChild;
+				ChildLink.NodeIndex += Child;
+				const AeonixNode& ChildNode = OctreeData.GetNode(ChildLink);
+
+				float Entry = 0.f;
+				if (ChildNode.HasChildren() && GetEntryTime(GetNodeBounds(ChildLink.GetLayerIndex(), ChildNode.Code), Entry))
+				{
+					WorkingSet.HeapPush({ Entry, ChildLink });
+				}
+			}
+			continue;
+		}
+
+		const AeonixLeafNode& Leaf = OctreeData.GetLeafNode(Node.FirstChild.GetNodeIndex());
+		if (Leaf.IsEmpty())
+		{
+			continue;
+		}
+		if (Leaf.IsCompletelyBlocked())
+		{
+			bHit = true;
+			BestHit = Current.Time;
+			if (!bNearest)
+			{
+				break;
+			}
+			continue;
+		}
+
+		// Test the segment against each blocked subnode, scanning the set bits of the grid
+		const FVector LeafOrigin = GetNodeBounds(0, Node.Code).Min;
+
+		uint64 Blocked = Leaf.VoxelGrid;
+		while (Blocked)
+		{
+			const uint64 Index = FMath::CountTrailingZeros64(Blocked);
+			Blocked &= Blocked - 1;
+
+			uint_fast32_t X = 0, Y = 0, Z = 0;
+			morton3D_64_decode(Index, X, Y, Z);
+			const FVector Min = LeafOrigin + FVector(X, Y, Z) * SubnodeSize;
+
+			float Entry = 0.f;
+			if (GetEntryTime(FBox(Min, Min + FVector(SubnodeSize)), Entry))
+			{
+				bHit = true;
+				BestHit = Entry;
+				if (!bNearest)
+				{
+					break;
+				}
+			}
+		}
+
+		if (bHit && !bNearest)
+		{
+			break;
+		}
+	}
+
+	oHitTime = BestHit;
+	return bHit;
+}
+
+FBox FAeonixData::GetNodeBounds(layerindex_t aLayer, mortoncode_t aCode) const
+{
+	FVector NodePosition;
+	GetNodePosition(aLayer, aCode, NodePosition);
+	const FVector HalfSize(GetVoxelSize(aLayer) * 0.5f);
+	return FBox(NodePosition - HalfSize, NodePosition + HalfSize);
+}
+
+bool FAeonixData::FindNearestNavigablePosition(const FVector& aPosition, float aMaxDistance, AeonixLink& oLink, FVector& oPosition) const
+{
+	const int32 RootLayer = GetRootLayer();
+	if (RootLayer < 0 || aMaxDistance < 0.f)
+	{
+		return false;
+	}
+
+	const float SubnodeSize = GetVoxelSize(0) * 0.25f;
+	// Points are pulled this far inside what they land in, so looking them up again finds the free voxel rather than the blocked one beside it
+	const float Inset = SubnodeSize * 0.01f;
+
+	// Kept as a heap on the distance to each node, so the first free node popped is the nearest, and a free subnode bounds everything still to visit
+	TArray<FProjectionEntry, TInlineAllocator<64>> WorkingSet;
+	auto Push = [&](layerindex_t aLayer, nodeindex_t aNodeIndex)
+	{
+		const FBox Bounds = GetNodeBounds(aLayer, OctreeData.GetLayer(aLayer)[aNodeIndex].Code);
+		const float Distance = FMath::Sqrt(Bounds.ComputeSquaredDistanceToPoint(aPosition));
+		if (Distance <= aMaxDistance)
+		{
+			WorkingSet.HeapPush({ Distance, AeonixLink(aLayer, aNodeIndex, 0) });
+		}
+	};
+
+	const TArray<AeonixNode>& Roots = OctreeData.GetLayer(RootLayer);
+	for (int32 i = 0; i < Roots.Num(); i++)
+	{
+		Push(RootLayer, i);
+	}
+
+	float BestDistance = aMaxDistance;
+	bool bFound = false;
+
+	while (WorkingSet.Num() > 0)
+	{
+		FProjectionEntry Current;
+		WorkingSet.HeapPop(Current, EAllowShrinking::No);
+		if (bFound && Current.Distance >= BestDistance)
+		{
+			break;
+		}
+
+		const AeonixNode& Node = OctreeData.GetNode(Current.Link);
+		const FBox Bounds = GetNodeBounds(Current.Link.GetLayerIndex(), Node.Code);
+
+		// Nothing in it is blocked, so nothing unvisited can be any nearer
+		if (!Node.HasChildren())
+		{
+			oLink = Current.Link;
+			oPosition = Bounds.ExpandBy(-Inset).GetClosestPointTo(aPosition);
+			return true;
+		}
+
+		if (Current.Link.GetLayerIndex() > 0)
+		{
+			for (int32 Child = 0; Child < 8; Child++)
+			{
+				Push(Node.FirstChild.GetLayerIndex(), Node.FirstChild.GetNodeIndex() + Child);
+			}
+			continue;
+		}
+
+		// Nearest of the free subnodes, scanning the clear bits of the grid
+		const AeonixLeafNode& Leaf = OctreeData.GetLeafNode(Node.FirstChild.GetNodeIndex());
+		uint64 Free = ~Leaf.VoxelGrid;
+		while (Free)
+		{
+			const uint64 Index = FMath::CountTrailingZeros64(Free);
+			Free &= Free - 1;
+
+			uint_fast32_t X = 0, Y = 0, Z = 0;
+			morton3D_64_decode(Index, X, Y, Z);
+			const FVector Min = Bounds.Min + FVector(X, Y, Z) * SubnodeSize;
+			const FBox SubnodeBounds(Min, Min + FVector(SubnodeSize));
+
+			const float Distance = FMath::Sqrt(SubnodeBounds.ComputeSquaredDistanceToPoint(aPosition));
+			if (Distance < BestDistance || (!bFound && Distance <= aMaxDistance))
+			{
+				bFound = true;
+				BestDistance = Distance;
+				oLink = AeonixLink(0, Current.Link.GetNodeIndex(), static_cast<subnodeindex_t>(Index));
+				oPosition = SubnodeBounds.ExpandBy(-Inset).GetClosestPointTo(aPosition);
+			}
+		}
+	}
+
+	return bFound;
+}
+
+void FAeonixData::FloodFill(const AeonixLink& aStart, const FVector& aCentre, float aRadius, int32 aMaxSteps, TArray<FVector>& oPositions) const
+{
+	// Rings below this size aren't worth handing out to the task graph
+	static constexpr int32 MinParallelRing = 64;
+
+	if (!aStart.IsValid() || aMaxSteps <= 0)
+	{
+		return;
+	}
+
+	// One bit per node, laid out layer after layer, and one per subnode of each leaf
+	TArray<int32, TInlineAllocator<16>> LayerOffsets;
+	int32 NumNodes = 0;
+	for (const TArray<AeonixNode>& Layer : OctreeData.Layers)
+	{
+		LayerOffsets.Add(NumNodes);
+		NumNodes += Layer.Num();
+	}
+	TBitArray<> NodeVisited(false, NumNodes);
+	TBitArray<> SubnodeVisited(false, OctreeData.LeafNodes.Num() * 64);
+
+	auto GetVisitedBit = [&](const AeonixLink& aLink) -> FBitReference
+	{
+		const AeonixNode& Node = OctreeData.GetNode(aLink);
+		if (aLink.GetLayerIndex() == 0 && Node.FirstChild.IsValid())
+		{
+			return SubnodeVisited[Node.FirstChild.GetNodeIndex() * 64 + aLink.GetSubnodeIndex()];
+		}
+		return NodeVisited[LayerOffsets[aLink.GetLayerIndex()] + aLink.GetNodeIndex()];
+	};
+
+	const float RadiusSquared = aRadius * aRadius;
+
+	struct FExpansion
+	{
+		FVector Position;
+		bool bInRadius = false;
+		TArray<AeonixLink> Neighbours;
+	};
+
+	TArray<AeonixLink> Ring;
+	TArray<AeonixLink> NextRing;
+	TArray<FExpansion> Expansions;
+	Ring.Add(aStart);
+	GetVisitedBit(aStart) = true;
+
+	int32 Steps = 0;
+	while (Ring.Num() > 0 && Steps < aMaxSteps)
+	{
+		const int32 NumToExpand = FMath::Min(Ring.Num(), aMaxSteps - Steps);
+		Expansions.Reset();
+		Expansions.SetNum(NumToExpand);
+
+		// The visited bits are only read here, each link's neighbours are gathered independently
+		ParallelFor(NumToExpand, [&](int32 Index)
+		{
+			const AeonixLink& Link = Ring[Index];
+			FExpansion& Expansion = Expansions[Index];
+			Expansion.bInRadius = GetLinkPosition(Link, Expansion.Position) && FVector::DistSquared(Expansion.Position, aCentre) <= RadiusSquared;
+			if (!Expansion.bInRadius)
+			{
+				return;
+			}
+
+			TArray<AeonixLink> Neighbours;
+			const AeonixNode& Node = OctreeData.GetNode(Link);
+			if (Link.GetLayerIndex() == 0 && Node.FirstChild.IsValid())
+			{
+				OctreeData.GetLeafNeighbours(Link, Neighbours);
+			}
+			else
+			{
+				GetNeighbours(Link, Neighbours);
+			}
+
+			for (const AeonixLink& Neighbour : Neighbours)
+			{
+				FVector NeighbourPosition;
+				if (Neighbour.IsValid() && !GetVisitedBit(Neighbour) && GetLinkPosition(Neighbour, NeighbourPosition) && FVector::DistSquared(NeighbourPosition, aCentre) <= RadiusSquared)
+				{
+					Expansion.Neighbours.Add(Neighbour);
+				}
+			}
+		}, NumToExpand < MinParallelRing ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		// Merged in ring order, so the links are reached in the same order as a queue would reach them
+		NextRing.Reset();
+		for (const FExpansion& Expansion : Expansions)
+		{
+			Steps++;
+			if (!Expansion.bInRadius)
+			{
+				continue;
+			}
+
+			oPositions.Add(Expansion.Position);
+			for (const AeonixLink& Neighbour : Expansion.Neighbours)
+			{
+				FBitReference Visited = GetVisitedBit(Neighbour);
+				if (!Visited)
+				{
+					Visited = true;
+					NextRing.Add(Neighbour);
+				}
+			}
+		}
+
+		Swap(Ring, NextRing);
+	}
+}
+
+void FAeonixData::ClassifyPoints(TConstArrayView<FVector> aPoints, float aProjectionRadius, TArray<FAeonixPointClassification>& oResults) const
+{
+	oResults.Reset();
+	oResults.SetNum(aPoints.Num());
+
+	const int32 RootLayer = GetRootLayer();
+	if (RootLayer < 0)
+	{
+		return;
+	}
+
+	// Layer 0 cell and subnode of each point inside the volume, the cell's morton code is the sort key and the path down the tree
+	struct FPointCell
+	{
+		mortoncode_t Code;
+		subnodeindex_t Subnode;
+		int32 PointIndex;
+	};
+	TArray<FPointCell> Cells;
+	Cells.Reserve(aPoints.Num());
+
+	const FVector VolumeOrigin = GenerationParameters.Origin - GenerationParameters.Extents;
+	const FBox VolumeBounds(VolumeOrigin, GenerationParameters.Origin + GenerationParameters.Extents);
+	const float CellSize = GetVoxelSize(0);
+	const float SubnodeSize = CellSize * 0.25f;
+	const int32 CellsPerSide = 1 << (OctreeData.GetNumLayers() - 1);
+	for (int32 i = 0; i < aPoints.Num(); i++)
+	{
+		FAeonixPointClassification& Result = oResults[i];
+		Result.Position = aPoints[i];
+		if (!VolumeBounds.IsInsideOrOn(aPoints[i]))
+		{
+			if (aProjectionRadius > 0.f && FindNearestNavigablePosition(aPoints[i], aProjectionRadius, Result.Link, Result.Position))
+			{
+				Result.State = EAeonixPointState::Projected;
+			}
+			continue;
+		}
+
+		const FVector Local = (aPoints[i] - VolumeOrigin) / SubnodeSize;
+		const FIntVector Subnode(
+			FMath::Clamp(FMath::FloorToInt(Local.X), 0, CellsPerSide * 4 - 1),
+			FMath::Clamp(FMath::FloorToInt(Local.Y), 0, CellsPerSide * 4 - 1),
+			FMath::Clamp(FMath::FloorToInt(Local.Z), 0, CellsPerSide * 4 - 1));
+		Cells.Add({ morton3D_64_encode(Subnode.X >> 2, Subnode.Y >> 2, Subnode.Z >> 2),
+			static_cast<subnodeindex_t>(morton3D_64_encode(Subnode.X & 3, Subnode.Y & 3, Subnode.Z & 3)), i });
+	}
+
+	Cells.Sort([](const FPointCell& A, const FPointCell& B) { return A.Code < B.Code; });
+
+	// Node at each layer on the path to the previous point, valid from the root down to where that path ended
+	TArray<nodeindex_t, TInlineAllocator<16>> Path;
+	Path.SetNumUninitialized(RootLayer + 1);
+	int32 EndLayer = INDEX_NONE;
+	mortoncode_t PreviousCode = 0;
+
+	const TArray<AeonixNode>& Roots = OctreeData.GetLayer(RootLayer);
+
+	for (const FPointCell& Cell : Cells)
+	{
+		// The highest layer at which this point's path differs from the last one's. Everything above it is shared
+		const mortoncode_t Difference = Cell.Code ^ PreviousCode;
+		const int32 DivergeLayer = EndLayer == INDEX_NONE ? RootLayer : (Difference ? static_cast<int32>(FMath::FloorLog2_64(Difference)) / 3 : INDEX_NONE);
+		PreviousCode = Cell.Code;
+
+		// Still inside the node the last path ended in, otherwise pick the path up where it branches off
+		if (EndLayer == INDEX_NONE || DivergeLayer >= EndLayer)
+		{
+			int32 Layer = FMath::Min(DivergeLayer, RootLayer);
+			if (Layer == RootLayer)
+			{
+				const mortoncode_t RootCode = Cell.Code >> (3 * RootLayer);
+				const int32 RootIndex = Algo::LowerBoundBy(Roots, RootCode, &AeonixNode::Code);
+				if (!Roots.IsValidIndex(RootIndex) || Roots[RootIndex].Code != RootCode)
+				{
+					EndLayer = INDEX_NONE;
+					continue;
+				}
+				Path[Layer] = RootIndex;
+			}
+			else
+			{
+				// Siblings are stored together in morton order, so the child is an offset from the first
+				const AeonixNode& Parent = OctreeData.GetLayer(Layer + 1)[Path[Layer + 1]];
+				Path[Layer] = Parent.FirstChild.GetNodeIndex() + ((Cell.Code >> (3 * Layer)) & 7);
+			}
+
+			while (Layer > 0 && OctreeData.GetLayer(Layer)[Path[Layer]].HasChildren())
+			{
+				const AeonixNode& Parent = OctreeData.GetLayer(Layer)[Path[Layer]];
+				Layer--;
+				Path[Layer] = Parent.FirstChild.GetNodeIndex() + ((Cell.Code >> (3 * Layer)) & 7);
+			}
+			EndLayer = Layer;
+		}
+
+		FAeonixPointClassification& Result = oResults[Cell.PointIndex];
+		const AeonixNode& Node = OctreeData.GetLayer(EndLayer)[Path[EndLayer]];
+		if (!Node.HasChildren())
+		{
+			Result.State = EAeonixPointState::Free;
+			Result.Link = AeonixLink(EndLayer, Path[EndLayer], 0);
+		}
+		else if (!OctreeData.GetLeafNode(Node.FirstChild.GetNodeIndex()).GetNode(Cell.Subnode))
+		{
+			Result.State = EAeonixPointState::Free;
+			Result.Link = AeonixLink(0, Path[0], Cell.Subnode);
+		}
+		else if (aProjectionRadius > 0.f && FindNearestNavigablePosition(aPoints[Cell.PointIndex], aProjectionRadius, Result.Link, Result.Position))
+		{
+			Result.State = EAeonixPointState::Projected;
+		}
+		else
+		{
+			Result.State = EAeonixPointState::Blocked;
+		}
+	}
+}
+
+bool FAeonixData::FindNearestObstacle(const FVector& aPosition, float aMaxDistance, FAeonixNearestObstacle& oResult) const
+{
+	TArray<FAeonixNearestObstacle> Results;
+	FindNearestObstacles(MakeArrayView(&aPosition, 1), aMaxDistance, Results);
+	oResult = Results[0];
+	return oResult.bFound;
+}
+
+void FAeonixData::FindNearestObstacles(TConstArrayView<FVector> aPositions, float aMaxDistance, TArray<FAeonixNearestObstacle>& oResults) const
+{
+	// Below this many positions they're searched on the calling thread
+	static constexpr int32 MinParallelQueries = 16;
+
+	oResults.Reset();
+	oResults.SetNum(aPositions.Num());
+
+	// The clearance is a lower bound on the distance to anything blocked, so where it reaches past aMaxDistance there's nothing to find
+	TArray<FAeonixPointClassification> Classifications;
+	if (Clearance.IsValid())
+	{
+		ClassifyPoints(aPositions, 0.f, Classifications);
+	}
+
+	ParallelFor(aPositions.Num(), [&](int32 Index)
+	{
+		if (Classifications.IsValidIndex(Index) && Classifications[Index].State == EAeonixPointState::Free)
+		{
+			const AeonixLink& Link = Classifications[Index].Link;
+			FVector LinkPosition;
+			GetLinkPosition(Link, LinkPosition);
+			if (GetLinkClearance(Link) - FVector::Dist(aPositions[Index], LinkPosition) > aMaxDistance)
+			{
+				return;
+			}
+		}
+		SearchNearestObstacle(aPositions[Index], aMaxDistance, oResults[Index]);
+	}, aPositions.Num() < MinParallelQueries ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+bool FAeonixData::SearchNearestObstacle(const FVector& aPosition, float aMaxDistance, FAeonixNearestObstacle& oResult) const
+{
+	oResult = FAeonixNearestObstacle();
+
+	const int32 RootLayer = GetRootLayer();
+	if (RootLayer < 0 || aMaxDistance < 0.f)
+	{
+		return false;
+	}
+
+	const float SubnodeSize = GetVoxelSize(0) * 0.25f;
+	float BestDistance = aMaxDistance;
+	FBox BestBounds(ForceInit);
+
+	// Kept as a heap on the distance to each node. Only subdivided nodes can hold anything blocked, so free space is never visited
+	TArray<FProjectionEntry, TInlineAllocator<64>> WorkingSet;
+	auto Push = [&](layerindex_t aLayer, nodeindex_t aNodeIndex)
+	{
+		const AeonixNode& Node = OctreeData.GetLayer(aLayer)[aNodeIndex];
+		if (!Node.HasChildren())
+		{
+			return;
+		}
+		const float Distance = FMath::Sqrt(GetNodeBounds(aLayer, Node.Code).ComputeSquaredDistanceToPoint(aPosition));
+		if (Distance <= BestDistance)
+		{
+			WorkingSet.HeapPush({ Distance, AeonixLink(aLayer, aNodeIndex, 0) });
+		}
+	};
+
+	const TArray<AeonixNode>& Roots = OctreeData.GetLayer(RootLayer);
+	for (int32 i = 0; i < Roots.Num(); i++)
+	{
+		Push(RootLayer, i);
+	}
+
+	while (WorkingSet.Num() > 0)
+	{
+		FProjectionEntry Current;
+		WorkingSet.HeapPop(Current, EAllowShrinking::No);
+		if (BestBounds.IsValid && Current.Distance >= BestDistance)
+		{
+			break;
+		}
+
+		const AeonixNode& Node = OctreeData.GetNode(Current.Link);
+		if (Current.Link.GetLayerIndex() > 0)
+		{
+			for (int32 Child = 0; Child < 8; Child++)
+			{
+				Push(Node.FirstChild.GetLayerIndex(), Node.FirstChild.GetNodeIndex() + Child);
+			}
+			continue;
+		}
+
+		const FBox Bounds = GetNodeBounds(0, Node.Code);
+		const AeonixLeafNode& Leaf = OctreeData.GetLeafNode(Node.FirstChild.GetNodeIndex());
+		if (Leaf.IsCompletelyBlocked())
+		{
+			// The leaf's own distance is the nearest any of its subnodes can be
+			BestDistance = Current.Distance;
+			BestBounds = Bounds;
+			continue;
+		}
+
+		// Nearest of the blocked subnodes, scanning the set bits of the grid
+		uint64 Blocked = Leaf.VoxelGrid;
+		while (Blocked)
+		{
+			const uint64 Index = FMath::CountTrailingZeros64(Blocked);
+			Blocked &= Blocked - 1;
+
+			uint_fast32_t X = 0, Y = 0, Z = 0;
+			morton3D_64_decode(Index, X, Y, Z);
+			const FVector Min = Bounds.Min + FVector(X, Y, Z) * SubnodeSize;
+			const FBox SubnodeBounds(Min, Min + FVector(SubnodeSize));
+
+			const float Distance = FMath::Sqrt(SubnodeBounds.ComputeSquaredDistanceToPoint(aPosition));
+			if (Distance < BestDistance || (!BestBounds.IsValid && Distance <= BestDistance))
+			{
+				BestDistance = Distance;
+				BestBounds = SubnodeBounds;
+			}
+		}
+	}
+
+	if (!BestBounds.IsValid)
+	{
+		return false;
+	}
+
+	oResult.bFound = true;
+	oResult.Location = BestBounds.GetClosestPointTo(aPosition);
+	oResult.Distance = BestDistance;
+	oResult.Direction = oResult.Distance > KINDA_SMALL_NUMBER ? (oResult.Location - aPosition) / oResult.Distance : FVector::ZeroVector;
+	return true;
+}
+
 bool FAeonixData::IsInDebugRange(const FVector& aPosition) const
 {
 	// If a debug filter box is active, use it for filtering instead of distance-based filtering
@@ -0,0 +1,183 @@
+#include "Data/AeonixFreeVolume.h"
+#include "Data/AeonixData.h"
+#include "Data/AeonixStats.h"
+
+#include "Algo/BinarySearch.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+	// Uniform in [0, aCount), from two draws so volumes beyond 32 bits of subnodes are still covered
+	uint64 RandomBelow(FRandomStream& aRandom, uint64 aCount)
+	{
+		const uint64 bits = (static_cast<uint64>(aRandom.GetUnsignedInt()) << 32) | aRandom.GetUnsignedInt();
+		return bits % aCount;
+	}
+}
+
+void FAeonixFreeVolume::Build(const FAeonixData& aData)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AeonixFreeVolumeBuild);
+
+	Reset();
+
+	const FAeonixOctreeData& octreeData = aData.OctreeData;
+	const FAeonixConnectivity& connectivity = aData.GetConnectivity();
+
+	TArray<FRegion> regions;
+	TArray<int32> regionComponents;
+	for (int32 layerIndex = 0; layerIndex < octreeData.Layers.Num(); layerIndex++)
+	{
+		const TArray<AeonixNode>& layer = octreeData.Layers[layerIndex];
+		for (int32 nodeIndex = 0; nodeIndex < layer.Num(); nodeIndex++)
+		{
+			const AeonixNode& node = layer[nodeIndex];
+			if (!node.HasChildren())
+			{
+				const AeonixLink link(layerIndex, nodeIndex, 0);
+				regions.Add({ link, 0 });
+				regionComponents.Add(connectivity.GetComponent(octreeData, link));
+			}
+			else if (layerIndex == 0 && octreeData.LeafNodes.IsValidIndex(node.FirstChild.GetNodeIndex()))
+			{
+				// One entry per locally connected region, as each may belong to a different component
+				const nodeindex_t leafIndex = node.FirstChild.GetNodeIndex();
+				uint64 free = ~static_cast<uint64>(octreeData.LeafNodes[leafIndex].VoxelGrid);
+				while (free)
+				{
+					const subnodeindex_t subnode = static_cast<subnodeindex_t>(FMath::CountTrailingZeros64(free));
+					const uint64 region = aData.GetLeafRegionMask(leafIndex, subnode);
+					free &= ~region;
+
+					const AeonixLink link(0, nodeIndex, subnode);
+					regions.Add({ link, region });
+					regionComponents.Add(connectivity.GetComponent(octreeData, link));
+				}
+			}
+		}
+	}
+
+	// Counting sort by component, so each component's regions are contiguous
+	if (connectivity.IsValid())
+	{
+		const int32 numComponents = connectivity.GetNumComponents();
+		ComponentStart.SetNumZeroed(numComponents + 1);
+		for (const int32 component : regionComponents)
+		{
+			ComponentStart[component + 1]++;
+		}
+		for (int32 i = 0; i < numComponents; i++)
+		{
+			ComponentStart[i + 1] += ComponentStart[i];
+		}
+
+		TArray<int32> next(ComponentStart.GetData(), numComponents);
+		Regions.SetNumUninitialized(regions.Num());
+		for (int32 i = 0; i < regions.Num(); i++)
+		{
+			Regions[next[regionComponents[i]]++] = regions[i];
+		}
+	}
+	else
+	{
+		Regions = MoveTemp(regions);
+	}
+
+	CumulativeSubnodes.SetNumUninitialized(Regions.Num());
+	uint64 total = 0;
+	for (int32 i = 0; i < Regions.Num(); i++)
+	{
+		const FRegion& region = Regions[i];
+		total += region.Mask ? FMath::CountBits(region.Mask) : 64ull << (3 * region.Link.GetLayerIndex());
+		CumulativeSubnodes[i] = total;
+	}
+
+	bIsValid = true;
+}
+
+void FAeonixFreeVolume::Invalidate()
+{
+	bIsValid = false;
+}
+
+void FAeonixFreeVolume::Reset()
+{
+	Regions.Empty();
+	CumulativeSubnodes.Empty();
+	ComponentStart.Empty();
+	bIsValid = false;
+}
+
+uint64 FAeonixFreeVolume::GetComponentSubnodes(int32 aComponent) const
+{
+	if (!ComponentStart.IsValidIndex(aComponent + 1) || aComponent < 0)
+	{
+		return 0;
+	}
+
+	const int32 first = ComponentStart[aComponent];
+	const int32 last = ComponentStart[aComponent + 1];
+	if (first == last)
+	{
+		return 0;
+	}
+	return CumulativeSubnodes[last - 1] - (first > 0 ? CumulativeSubnodes[first - 1] : 0);
+}
+
+bool FAeonixFreeVolume::GetRandomPoint(const FAeonixData& aData, FRandomStream& aRandom, int32 aComponent, AeonixLink& oLink, FVector& oPosition) const
+{
+	if (!bIsValid || Regions.Num() == 0)
+	{
+		return false;
+	}
+
+	int32 first = 0;
+	int32 last = Regions.Num();
+	if (aComponent != INDEX_NONE)
+	{
+		if (!ComponentStart.IsValidIndex(aComponent + 1) || aComponent < 0)
+		{
+			return false;
+		}
+		first = ComponentStart[aComponent];
+		last = ComponentStart[aComponent + 1];
+	}
+
+	const uint64 base = first > 0 ? CumulativeSubnodes[first - 1] : 0;
+	const uint64 count = last > first ? CumulativeSubnodes[last - 1] - base : 0;
+	if (count == 0)
+	{
+		return false;
+	}
+
+	// The region whose running total first passes the pick, and how far into its subnodes the pick lands
+	const uint64 pick = base + RandomBelow(aRandom, count);
+	const int32 index = first + Algo::UpperBound(MakeArrayView(CumulativeSubnodes.GetData() + first, last - first), pick);
+	const FRegion& region = Regions[index];
+	uint64 offset = pick - (index > 0 ? CumulativeSubnodes[index - 1] : 0);
+
+	const AeonixNode& node = aData.OctreeData.GetNode(region.Link);
+	const float subnodeSize = aData.GetVoxelSize(0) * 0.25f;
+	FVector nodePosition;
+	aData.GetNodePosition(region.Link.GetLayerIndex(), node.Code, nodePosition);
+	const FVector nodeOrigin = nodePosition - FVector(aData.GetVoxelSize(region.Link.GetLayerIndex()) * 0.5f);
+
+	// Each subnode is equally likely, so the offset picks one directly, for a free node as a morton code across all of its subnodes
+	subnodeindex_t subnode = 0;
+	if (region.Mask)
+	{
+		uint64 bits = region.Mask;
+		for (; offset > 0; offset--)
+		{
+			bits &= bits - 1;
+		}
+		subnode = static_cast<subnodeindex_t>(FMath::CountTrailingZeros64(bits));
+		offset = subnode;
+	}
+
+	uint_fast32_t x = 0, y = 0, z = 0;
+	morton3D_64_decode(offset, x, y, z);
+	oPosition = nodeOrigin + (FVector(x, y, z) + FVector(aRandom.GetFraction(), aRandom.GetFraction(), aRandom.GetFraction())) * subnodeSize;
+	oLink = AeonixLink(region.Link.GetLayerIndex(), region.Link.GetNodeIndex(), subnode);
+	return true;
+}
@@ -0,0 +1,314 @@
+#include "Data/AeonixLandmarks.h"
+#include "Data/AeonixData.h"
+#include "Data/AeonixStats.h"
+#include "AeonixNavigation.h"
+
+namespace
+{
+	struct FDijkstraEntry
+	{
+		float Distance;
+		int32 Element;
+
+		bool operator<(const FDijkstraEntry& Other) const { return Distance < Other.Distance; }
+	};
+}
+
+void FAeonixLandmarks::Build(const FAeonixData& aData, int32 aNumLandmarks)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AeonixLandmarkBuild);
+
+	Reset();
+
+	const FAeonixOctreeData& octreeData = aData.OctreeData;
+	const int32 numLayers = octreeData.Layers.Num();
+	if (numLayers == 0 || aNumLandmarks <= 0)
+	{
+		return;
+	}
+
+	// Search elements are every node, followed by 64 subnodes for each layer 0 node that has a leaf
+	const TArray<AeonixNode>& layer0 = octreeData.Layers[0];
+	TArray<int32, TInlineAllocator<16>> nodeElementStart;
+	int32 numElements = 0;
+	for (int32 layerIndex = 0; layerIndex < numLayers; layerIndex++)
+	{
+		nodeElementStart.Add(numElements);
+		numElements += octreeData.Layers[layerIndex].Num();
+	}
+	const int32 subnodeElementStart = numElements;
+
+	TArray<int32> nodeLeafBlock;
+	TArray<int32> leafBlockNode;
+	nodeLeafBlock.Init(INDEX_NONE, layer0.Num());
+	for (int32 nodeIndex = 0; nodeIndex < layer0.Num(); nodeIndex++)
+	{
+		if (layer0[nodeIndex].HasChildren())
+		{
+			nodeLeafBlock[nodeIndex] = leafBlockNode.Add(nodeIndex);
+		}
+	}
+	numElements += leafBlockNode.Num() * 64;
+
+	auto getElement = [&](const AeonixLink& aLink) -> int32
+	{
+		if (aLink.GetLayerIndex() == 0 && octreeData.GetNode(aLink).HasChildren())
+		{
+			return subnodeElementStart + nodeLeafBlock[aLink.GetNodeIndex()] * 64 + aLink.GetSubnodeIndex();
+		}
+		return nodeElementStart[aLink.GetLayerIndex()] + aLink.GetNodeIndex();
+	};
+
+	auto getLink = [&](int32 aElement) -> AeonixLink
+	{
+		if (aElement >= subnodeElementStart)
+		{
+			const int32 subnodeElement = aElement - subnodeElementStart;
+			return AeonixLink(0, leafBlockNode[subnodeElement / 64], subnodeElement % 64);
+		}
+
+		int32 layerIndex = numLayers - 1;
+		while (nodeElementStart[layerIndex] > aElement)
+		{
+			layerIndex--;
+		}
+		return AeonixLink(layerIndex, aElement - nodeElementStart[layerIndex], 0);
+	};
+
+	// Only nodes without children and free subnodes are ever searched
+	TBitArray<> isSearchElement(false, numElements);
+	for (int32 layerIndex = 0; layerIndex < numLayers; layerIndex++)
+	{
+		const TArray<AeonixNode>& layer = octreeData.Layers[layerIndex];
+		for (int32 nodeIndex = 0; nodeIndex < layer.Num(); nodeIndex++)
+		{
+			isSearchElement[nodeElementStart[layerIndex] + nodeIndex] = !layer[nodeIndex].HasChildren();
+		}
+	}
+	for (int32 block = 0; block < leafBlockNode.Num(); block++)
+	{
+		const uint64 freeMask = ~static_cast<uint64>(octreeData.GetLeafNode(layer0[leafBlockNode[block]].FirstChild.GetNodeIndex()).VoxelGrid);
+		for (uint64 bits = freeMask; bits; bits &= bits - 1)
+		{
+			isSearchElement[subnodeElementStart + block * 64 + FMath::CountTrailingZeros64(bits)] = true;
+		}
+	}
+
+	TArray<float> distances;
+	TArray<FDijkstraEntry> heap;
+	TArray<AeonixLink> neighbours;
+
+	// Edge costs match the pathfinder's, the distance between link positions
+	auto runDijkstra = [&](int32 aSource)
+	{
+		distances.Init(FLT_MAX, numElements);
+		heap.Reset();
+
+		distances[aSource] = 0.f;
+		heap.HeapPush({ 0.f, aSource });
+
+		while (heap.Num() > 0)
+		{
+			FDijkstraEntry entry;
+			heap.HeapPop(entry, EAllowShrinking::No);
+			if (entry.Distance > distances[entry.Element])
+			{
+				continue;
+			}
+
+			const AeonixLink link = getLink(entry.Element);
+			FVector position;
+			aData.GetLinkPosition(link, position);
+
+			neighbours.Reset();
+			if (entry.Element >= subnodeElementStart)
+			{
+				octreeData.GetLeafNeighbours(link, neighbours);
+			}
+			else
+			{
+				aData.GetNeighbours(link, neighbours);
+			}
+
+			for (const AeonixLink& neighbour : neighbours)
+			{
+				const int32 neighbourElement = getElement(neighbour);
+				if (!isSearchElement[neighbourElement])
+				{
+					continue;
+				}
+
+				FVector neighbourPosition;
+				aData.GetLinkPosition(neighbour, neighbourPosition);
+				const float distance = entry.Distance + FVector::Dist(position, neighbourPosition);
+				if (distance < distances[neighbourElement])
+				{
+					distances[neighbourElement] = distance;
+					heap.HeapPush({ distance, neighbourElement });
+				}
+			}
+		}
+	};
+
+	auto findFurthest = [&](const TArray<float>& aDistances) -> int32
+	{
+		int32 furthest = INDEX_NONE;
+		float furthestDistance = 0.f;
+		for (TConstSetBitIterator<> it(isSearchElement); it; ++it)
+		{
+			// Unreached elements are in other, usually tiny, components that would waste landmarks. They just get no bound
+			if (aDistances[it.GetIndex()] != FLT_MAX && aDistances[it.GetIndex()] > furthestDistance)
+			{
+				furthest = it.GetIndex();
+				furthestDistance = aDistances[it.GetIndex()];
+			}
+		}
+		return furthest;
+	};
+
+	// Start from the largest open node, which is all but certain to be in the main body of navigable space rather than some enclosed pocket
+	int32 seed = INDEX_NONE;
+	for (int32 layerIndex = numLayers - 1; layerIndex >= 0 && seed == INDEX_NONE; layerIndex--)
+	{
+		for (int32 nodeIndex = 0; nodeIndex < octreeData.Layers[layerIndex].Num(); nodeIndex++)
+		{
+			if (isSearchElement[nodeElementStart[layerIndex] + nodeIndex])
+			{
+				seed = nodeElementStart[layerIndex] + nodeIndex;
+				break;
+			}
+		}
+	}
+	if (seed == INDEX_NONE)
+	{
+		TConstSetBitIterator<> firstElement(isSearchElement);
+		if (!firstElement)
+		{
+			return;
+		}
+		seed = firstElement.GetIndex();
+	}
+
+	Stride = aNumLandmarks;
+	NodeRanges.SetNum(numLayers);
+	for (int32 layerIndex = 0; layerIndex < numLayers; layerIndex++)
+	{
+		NodeRanges[layerIndex].SetNum(octreeData.Layers[layerIndex].Num() * Stride);
+	}
+
+	// The furthest point from anywhere makes a good first landmark, then each next one is the furthest from all those picked so far
+	runDijkstra(seed);
+	int32 nextLandmark = findFurthest(distances);
+
+	TArray<float> nearestLandmarkDistances;
+	nearestLandmarkDistances.Init(FLT_MAX, numElements);
+
+	for (int32 landmark = 0; landmark < aNumLandmarks && nextLandmark != INDEX_NONE; landmark++)
+	{
+		runDijkstra(nextLandmark);
+		Landmarks.Add(getLink(nextLandmark));
+
+		for (int32 layerIndex = 0; layerIndex < numLayers; layerIndex++)
+		{
+			TArray<FDistanceRange>& ranges = NodeRanges[layerIndex];
+			for (int32 nodeIndex = 0; nodeIndex < octreeData.Layers[layerIndex].Num(); nodeIndex++)
+			{
+				const int32 element = nodeElementStart[layerIndex] + nodeIndex;
+				if (isSearchElement[element] && distances[element] != FLT_MAX)
+				{
+					ranges[nodeIndex * Stride + landmark] = { distances[element], distances[element] };
+				}
+			}
+		}
+
+		for (int32 block = 0; block < leafBlockNode.Num(); block++)
+		{
+			FDistanceRange range{ FLT_MAX, 0.f };
+			bool bAnyFree = false;
+			bool bAllReached = true;
+			for (int32 subnode = 0; subnode < 64; subnode++)
+			{
+				const int32 element = subnodeElementStart + block * 64 + subnode;
+				if (!isSearchElement[element])
+				{
+					continue;
+				}
+
+				bAnyFree = true;
+				bAllReached &= distances[element] != FLT_MAX;
+				range.Min = FMath::Min(range.Min, distances[element]);
+				range.Max = FMath::Max(range.Max, distances[element]);
+			}
+
+			// A leaf split between components would give a range that holds for neither
+			if (bAnyFree && bAllReached)
+			{
+				NodeRanges[0][leafBlockNode[block] * Stride + landmark] = range;
+			}
+		}
+
+		for (TConstSetBitIterator<> it(isSearchElement); it; ++it)
+		{
+			nearestLandmarkDistances[it.GetIndex()] = FMath::Min(nearestLandmarkDistances[it.GetIndex()], distances[it.GetIndex()]);
+		}
+		nextLandmark = findFurthest(nearestLandmarkDistances);
+	}
+
+	bIsValid = true;
+
+	UE_LOG(LogAeonixNavigation, Log, TEXT("Landmarks: %d landmark(s) across %d search node(s)"), Landmarks.Num(), isSearchElement.CountSetBits());
+}
+
+void FAeonixLandmarks::Invalidate()
+{
+	bIsValid = false;
+}
+
+void FAeonixLandmarks::Reset()
+{
+	Landmarks.Reset();
+	NodeRanges.Reset();
+	Stride = 0;
+	bIsValid = false;
+}
+
+const FAeonixLandmarks::FDistanceRange* FAeonixLandmarks::GetRanges(const AeonixLink& aLink) const
+{
+	if (!aLink.IsValid() || aLink.GetLayerIndex() >= NodeRanges.Num())
+	{
+		return nullptr;
+	}
+
+	const TArray<FDistanceRange>& ranges = NodeRanges[aLink.GetLayerIndex()];
+	const int32 first = static_cast<int32>(aLink.GetNodeIndex()) * Stride;
+	return first + Stride <= ranges.Num() ? &ranges[first] : nullptr;
+}
+
+float FAeonixLandmarks::GetLowerBound(const AeonixLink& aStart, const AeonixLink& aTarget) const
+{
+	if (!bIsValid)
+	{
+		return 0.f;
+	}
+
+	const FDistanceRange* startRanges = GetRanges(aStart);
+	const FDistanceRange* targetRanges = GetRanges(aTarget);
+	if (!startRanges || !targetRanges)
+	{
+		return 0.f;
+	}
+
+	float bound = 0.f;
+	for (int32 landmark = 0; landmark < Landmarks.Num(); landmark++)
+	{
+		const FDistanceRange& start = startRanges[landmark];
+		const FDistanceRange& target = targetRanges[landmark];
+		if (start.Min == FLT_MAX || target.Min == FLT_MAX)
+		{
+			continue;
+		}
+
+		bound = FMath::Max(bound, FMath::Max(target.Min - start.Max, start.Min - target.Max));
+	}
+	return bound;
+}
@@ -58,95 +58,205 @@ void FAeonixOctreeData::GetLeafNeighbours(const AeonixLink& aLink, TArray<Aeonix
 		}
 		else // the neighbours is out of bounds, we need to find our neighbour
 		{
-			const AeonixLink& neighbourLink = node.myNeighbours[i];
+			GetLeafNeighbourAcrossBoundary(node, i, sX, sY, sZ, oNeighbours);
+		}
+	}
+}
 
-			// Check if the neighbor link is valid first
-			if (!neighbourLink.IsValid())
-			{
-				continue; // Skip invalid neighbors
-			}
+void FAeonixOctreeData::GetLeafNeighbourAcrossBoundary(const AeonixNode& aNode, int32 aDirection, int32 sX, int32 sY, int32 sZ, TArray<AeonixLink>& oNeighbours) const
+{
+	const AeonixLink& neighbourLink = aNode.myNeighbours[aDirection];
+
+	// Check if the neighbor link is valid first
+	if (!neighbourLink.IsValid())
+	{
+		return; // Skip invalid neighbors
+	}
+
+	const AeonixNode& neighbourNode = GetNode(neighbourLink);
+
+	// If the neighbour layer 0 has no leaf nodes, just return it
+	if (!neighbourNode.FirstChild.IsValid())
+	{
+		oNeighbours.Add(neighbourLink);
+		return;
+	}
+
+	const AeonixLeafNode& leafNode = GetLeafNode(neighbourNode.FirstChild.GetNodeIndex());
+
+	if (leafNode.IsCompletelyBlocked())
+	{
+		// The leaf node is completely blocked, we don't return it
+		return;
+	}
+
+	// Calculate the correct leaf node position in the neighboring voxel
+	// The neighbor's leaf node should be directly adjacent to our current position
+	// When we cross a boundary, we need to wrap to the opposite side of the neighbor voxel
+	// But we maintain the other coordinates to stay aligned
+	const uint_fast32_t neighborX = sX < 0 ? 3 : (sX > 3 ? 0 : sX);
+	const uint_fast32_t neighborY = sY < 0 ? 3 : (sY > 3 ? 0 : sY);
+	const uint_fast32_t neighborZ = sZ < 0 ? 3 : (sZ > 3 ? 0 : sZ);
+
+	mortoncode_t subNodeCode = morton3D_64_encode(neighborX, neighborY, neighborZ);
+
+	// Only return the neighbour if it isn't blocked!
+	if (!leafNode.GetNode(subNodeCode))
+	{
+		oNeighbours.Emplace(0, neighbourNode.FirstChild.GetNodeIndex(), subNodeCode);
+	}
+}
+
+namespace
+{
+	// Mirrors a 4 bit leaf row, so jumps in negative directions can scan towards the high bits the same as positive ones
+	const uint8 ReversedLeafRow[16] = {0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE, 0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF};
+}
 
-			const AeonixNode& neighbourNode = GetNode(neighbourLink);
+int32 FAeonixOctreeData::GetFreeRowOutsideLeaf(const AeonixNode& aNode, int32 aDirection, int32 aAxis, const int32 (&aCoords)[3]) const
+{
+	const AeonixLink& neighbourLink = aNode.myNeighbours[aDirection];
+
+	// Edge of the volume, nothing out there
+	if (!neighbourLink.IsValid())
+	{
+		return 0;
+	}
+
+	const AeonixNode& neighbourNode = GetNode(neighbourLink);
+
+	// A single clear node, the whole row is open
+	if (!neighbourNode.HasChildren())
+	{
+		return 0xF;
+	}
+
+	// Subdivided neighbours above layer 0 would need a tree walk per subnode
+	if (neighbourLink.GetLayerIndex() != 0)
+	{
+		return -1;
+	}
+
+	// Wrap the stepped co-ordinate round to the facing side of the neighbouring leaf
+	const int32 perpAxis = aDirection / 2;
+	uint_fast32_t wrapped[3] = {static_cast<uint_fast32_t>(aCoords[0]), static_cast<uint_fast32_t>(aCoords[1]), static_cast<uint_fast32_t>(aCoords[2])};
+	wrapped[perpAxis] = aCoords[perpAxis] < 0 ? 3 : 0;
+
+	return GetLeafNode(neighbourNode.FirstChild.GetNodeIndex()).GetFreeRow(aAxis, wrapped[0], wrapped[1], wrapped[2]);
+}
+
+void FAeonixOctreeData::GetLeafJumpNeighbours(const AeonixLink& aLink, const AeonixLink& aGoal, TArray<AeonixLink>& oNeighbours) const
+{
+	const AeonixNode& node = GetNode(aLink);
+	const AeonixLeafNode& leaf = GetLeafNode(node.FirstChild.GetNodeIndex());
+
+	uint_fast32_t x = 0, y = 0, z = 0;
+	morton3D_64_decode(aLink.GetSubnodeIndex(), x, y, z);
+	const int32 coords[3] = {static_cast<int32>(x), static_cast<int32>(y), static_cast<int32>(z)};
+
+	// If the goal is in this leaf, any run that passes over it has to stop there
+	const bool bGoalInLeaf = aGoal.GetLayerIndex() == 0 && aGoal.GetNodeIndex() == aLink.GetNodeIndex();
+	uint_fast32_t gX = 0, gY = 0, gZ = 0;
+	if (bGoalInLeaf)
+	{
+		morton3D_64_decode(aGoal.GetSubnodeIndex(), gX, gY, gZ);
+	}
+	const int32 goalCoords[3] = {static_cast<int32>(gX), static_cast<int32>(gY), static_cast<int32>(gZ)};
+
+	for (int32 i = 0; i < 6; i++)
+	{
+		const int32 axis = i / 2;
+		const bool bPositive = (i % 2) == 0;
 
-			// If the neighbour layer 0 has no leaf nodes, just return it
-			if (!neighbourNode.FirstChild.IsValid())
+		// Our position along the run, mirrored for negative directions so the scan always heads towards bit 3
+		const int32 pos = bPositive ? coords[axis] : 3 - coords[axis];
+
+		if (pos == 3)
+		{
+			// Already on the face of the leaf, step across into the adjacent node as normal
+			int32 stepped[3] = {coords[0], coords[1], coords[2]};
+			stepped[axis] += bPositive ? 1 : -1;
+			GetLeafNeighbourAcrossBoundary(node, i, stepped[0], stepped[1], stepped[2], oNeighbours);
+			continue;
+		}
+
+		const uint8 rawRow = leaf.GetFreeRow(axis, x, y, z);
+		const uint32 freeRow = bPositive ? rawRow : ReversedLeafRow[rawRow];
+
+		// Count the consecutive free subnodes ahead of us, the set bits above the row stop the scan at the leaf face
+		const int32 runLength = FMath::CountTrailingZeros(~(freeRow >> (pos + 1)));
+		if (runLength == 0)
+		{
+			continue;
+		}
+
+		uint32 stopMask = 0;
+
+		// A forced neighbour is a perpendicular subnode that opens up where the one beside the previous step was blocked.
+		// Anything that was already open beside the previous step is reachable without stopping here. The first step always
+		// counts as forced if it has an opening, as the subnodes beside us are only reached by jumps that may skip them.
+		for (int32 j = 0; j < 6; j++)
+		{
+			const int32 perpAxis = j / 2;
+			if (perpAxis == axis)
 			{
-				oNeighbours.Add(neighbourLink);
 				continue;
 			}
 
-			const AeonixLeafNode& leafNode = GetLeafNode(neighbourNode.FirstChild.GetNodeIndex());
+			int32 perpCoords[3] = {coords[0], coords[1], coords[2]};
+			perpCoords[perpAxis] += (j % 2) == 0 ? 1 : -1;
 
-			if (leafNode.IsCompletelyBlocked())
+			int32 perpRow = 0;
+			if (perpCoords[perpAxis] < 0 || perpCoords[perpAxis] > 3)
 			{
-				// The leaf node is completely blocked, we don't return it
-				continue;
+				perpRow = GetFreeRowOutsideLeaf(node, j, axis, perpCoords);
 			}
-			else // Otherwise, we need to find the correct subnode
+			else
 			{
-				// Calculate the correct leaf node position in the neighboring voxel
-				// The neighbor's leaf node should be directly adjacent to our current position
-				uint_fast32_t neighborX = x;
-				uint_fast32_t neighborY = y;
-				uint_fast32_t neighborZ = z;
-
-				// When we cross a boundary, we need to wrap to the opposite side of the neighbor voxel
-				// But we maintain the other coordinates to stay aligned
-				if (sX < 0)
-				{
-					neighborX = 3; // Enter from the positive X side (right)
-				}
-				else if (sX > 3)
-				{
-					neighborX = 0; // Enter from the negative X side (left)
-				}
-				else
-				{
-					// X didn't cross boundary, so keep the same X coordinate
-					neighborX = sX;
-				}
+				perpRow = leaf.GetFreeRow(axis, perpCoords[0], perpCoords[1], perpCoords[2]);
+			}
 
-				if (sY < 0)
-				{
-					neighborY = 3; // Enter from the positive Y side
-				}
-				else if (sY > 3)
-				{
-					neighborY = 0; // Enter from the negative Y side
-				}
-				else
-				{
-					// Y didn't cross boundary, so keep the same Y coordinate
-					neighborY = sY;
-				}
+			if (perpRow < 0)
+			{
+				// Can't tell what's beside us, so fall back to stopping at every step
+				stopMask = 0xF;
+				break;
+			}
 
-				if (sZ < 0)
-				{
-					neighborZ = 3; // Enter from the positive Z side
-				}
-				else if (sZ > 3)
-				{
-					neighborZ = 0; // Enter from the negative Z side
-				}
-				else
-				{
-					// Z didn't cross boundary, so keep the same Z coordinate
-					neighborZ = sZ;
-				}
+			const uint32 row = bPositive ? perpRow : ReversedLeafRow[perpRow];
+			stopMask |= (row & ~(row << 1)) | (row & (1u << (pos + 1)));
+		}
 
-				mortoncode_t subNodeCode = morton3D_64_encode(neighborX, neighborY, neighborZ);
+		if (bGoalInLeaf && goalCoords[(axis + 1) % 3] == coords[(axis + 1) % 3] && goalCoords[(axis + 2) % 3] == coords[(axis + 2) % 3])
+		{
+			stopMask |= 1u << (bPositive ? goalCoords[axis] : 3 - goalCoords[axis]);
+		}
 
-				// Only return the neighbour if it isn't blocked!
-				if (!leafNode.GetNode(subNodeCode))
-				{
-					oNeighbours.Emplace(0, neighbourNode.FirstChild.GetNodeIndex(), subNodeCode);
-				}
-			}
+		// Only stops within the free run ahead of us count, otherwise we jump to the end of the run
+		stopMask &= ((1u << runLength) - 1) << (pos + 1);
+		const int32 jumpPos = stopMask ? FMath::CountTrailingZeros(stopMask) : pos + runLength;
+
+		uint_fast32_t jumpCoords[3] = {x, y, z};
+		jumpCoords[axis] = bPositive ? jumpPos : 3 - jumpPos;
+
+		oNeighbours.Emplace(0, aLink.GetNodeIndex(), morton3D_64_encode(jumpCoords[0], jumpCoords[1], jumpCoords[2]));
+
+		// An empty leaf is one convex free region, so the far end of the run is always a safe shortcut as well
+		if (leaf.IsEmpty() && jumpPos != pos + runLength)
+		{
+			jumpCoords[axis] = bPositive ? pos + runLength : 3 - (pos + runLength);
+			oNeighbours.Emplace(0, aLink.GetNodeIndex(), morton3D_64_encode(jumpCoords[0], jumpCoords[1], jumpCoords[2]));
 		}
 	}
+
+	// Likewise the goal can be reached in a straight line from anywhere in an empty leaf
+	if (bGoalInLeaf && leaf.IsEmpty() && !(aGoal == aLink))
+	{
+		oNeighbours.Add(aGoal);
+	}
 }
 
-void FAeonixOctreeData::GetNeighbours(const AeonixLink& aLink, TArray<AeonixLink>& oNeighbours) const
+void FAeonixOctreeData::GetNeighbours(const AeonixLink& aLink, TArray<AeonixLink>& oNeighbours, TArray<nodeindex_t>* oLeaves) const
 {
 	const AeonixNode& node = GetNode(aLink);
 
@@ -210,6 +320,10 @@ void FAeonixOctreeData::GetNeighbours(const AeonixLink& aLink, TArray<AeonixLink
 			else
 			{
 				// If this is a leaf layer, then we need to add whichever of the 16 facing leaf nodes aren't blocked
+				if (oLeaves)
+				{
+					oLeaves->AddUnique(thisNode.FirstChild.NodeIndex);
+				}
 				for (const nodeindex_t& leafIndex : AeonixStatics::dirLeafChildOffsets[i])
 				{
 					// Each of the childnodes
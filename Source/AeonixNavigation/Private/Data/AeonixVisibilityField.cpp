@@ -0,0 +1,357 @@
+#include "Data/AeonixVisibilityField.h"
+#include "Data/AeonixData.h"
+#include "Data/AeonixStats.h"
+
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	// Cells along each side of a cube map face, directions are binned into 6 * FaceResolution^2 buckets
+	constexpr int32 FaceResolution = 16;
+	constexpr int32 NumBuckets = 6 * FaceResolution * FaceResolution;
+	// Below this many rays they're traced on the calling thread
+	constexpr int32 MinParallelRays = 64;
+
+	int32 GetBucket(const FVector& aDirection)
+	{
+		const FVector absDirection = aDirection.GetAbs();
+		int32 face = 0;
+		float u = 0.f, v = 0.f, major = 0.f;
+		if (absDirection.X >= absDirection.Y && absDirection.X >= absDirection.Z)
+		{
+			face = aDirection.X > 0.f ? 0 : 1;
+			major = absDirection.X;
+			u = aDirection.Y;
+			v = aDirection.Z;
+		}
+		else if (absDirection.Y >= absDirection.Z)
+		{
+			face = aDirection.Y > 0.f ? 2 : 3;
+			major = absDirection.Y;
+			u = aDirection.X;
+			v = aDirection.Z;
+		}
+		else
+		{
+			face = aDirection.Z > 0.f ? 4 : 5;
+			major = absDirection.Z;
+			u = aDirection.X;
+			v = aDirection.Y;
+		}
+
+		const float scale = 0.5f * FaceResolution / FMath::Max(major, SMALL_NUMBER);
+		const int32 x = FMath::Clamp(FMath::FloorToInt((u + major) * scale), 0, FaceResolution - 1);
+		const int32 y = FMath::Clamp(FMath::FloorToInt((v + major) * scale), 0, FaceResolution - 1);
+		return (face * FaceResolution + y) * FaceResolution + x;
+	}
+
+	// Unit direction through the middle of each bucket
+	void GetBucketDirections(TArray<FVector>& oDirections)
+	{
+		oDirections.SetNumUninitialized(NumBuckets);
+		for (int32 face = 0; face < 6; face++)
+		{
+			const float sign = (face & 1) ? -1.f : 1.f;
+			for (int32 y = 0; y < FaceResolution; y++)
+			{
+				for (int32 x = 0; x < FaceResolution; x++)
+				{
+					const float u = (x + 0.5f) * 2.f / FaceResolution - 1.f;
+					const float v = (y + 0.5f) * 2.f / FaceResolution - 1.f;
+					FVector direction;
+					switch (face / 2)
+					{
+					case 0: direction = FVector(sign, u, v); break;
+					case 1: direction = FVector(u, sign, v); break;
+					default: direction = FVector(u, v, sign); break;
+					}
+					oDirections[(face * FaceResolution + y) * FaceResolution + x] = direction.GetUnsafeNormal();
+				}
+			}
+		}
+	}
+
+	// Slab test of the segment aStart + t * aDelta, t in [0, 1], with the reciprocal of the delta worked out once per ray
+	bool SegmentHitsBox(const FVector& aBoxMin, const FVector& aBoxMax, const FVector& aStart, const FVector& aDelta, const FVector& aInvDelta)
+	{
+		float entry = 0.f;
+		float exit = 1.f;
+		for (int32 axis = 0; axis < 3; axis++)
+		{
+			if (FMath::IsNearlyZero(aDelta[axis]))
+			{
+				if (aStart[axis] < aBoxMin[axis] || aStart[axis] > aBoxMax[axis])
+				{
+					return false;
+				}
+				continue;
+			}
+
+			float t0 = (aBoxMin[axis] - aStart[axis]) * aInvDelta[axis];
+			float t1 = (aBoxMax[axis] - aStart[axis]) * aInvDelta[axis];
+			if (t0 > t1)
+			{
+				Swap(t0, t1);
+			}
+
+			entry = FMath::Max(entry, t0);
+			exit = FMath::Min(exit, t1);
+			if (entry > exit)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	struct FOccluder
+	{
+		FBox Bounds;
+		uint64 Blocked;
+		// Squared distance from the target to the nearest point of the leaf
+		float NearDistanceSq;
+	};
+}
+
+void FAeonixVisibilityField::Build(const FAeonixData& aData, const FVector& aTarget, float aRadius)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AeonixVisibilityFieldBuild);
+
+	Reset();
+	Target = aTarget;
+	Radius = aRadius;
+	GenerationId = aData.GetGenerationId();
+	LeafChangeSerial = aData.GetLeafChangeSerial();
+	bIsValid = true;
+
+	const FAeonixOctreeData& octreeData = aData.OctreeData;
+	int32 rootLayer = octreeData.GetNumLayers() - 1;
+	while (rootLayer >= 0 && (rootLayer >= octreeData.Layers.Num() || octreeData.GetLayer(rootLayer).Num() == 0))
+	{
+		rootLayer--;
+	}
+	if (rootLayer < 0 || aRadius <= 0.f)
+	{
+		return;
+	}
+
+	const float radiusSq = aRadius * aRadius;
+	const float subnodeSize = aData.GetVoxelSize(0) * 0.25f;
+
+	// Walk down from the roots, skipping anything wholly outside the radius. Free nodes and subnodes are the rays, leaves with anything blocked are what can stop them
+	TArray<FOccluder> occluders;
+	TArray<AeonixLink, TInlineAllocator<64>> stack;
+	for (int32 i = 0; i < octreeData.GetLayer(rootLayer).Num(); i++)
+	{
+		stack.Add(AeonixLink(rootLayer, i, 0));
+	}
+
+	while (stack.Num() > 0)
+	{
+		const AeonixLink link = stack.Pop(EAllowShrinking::No);
+		const layerindex_t layer = link.GetLayerIndex();
+		const AeonixNode& node = octreeData.GetNode(link);
+
+		FVector centre;
+		aData.GetNodePosition(layer, node.Code, centre);
+		const FVector halfSize(aData.GetVoxelSize(layer) * 0.5f);
+		const FBox bounds(centre - halfSize, centre + halfSize);
+		const float nearDistanceSq = bounds.ComputeSquaredDistanceToPoint(aTarget);
+		if (nearDistanceSq > radiusSq)
+		{
+			continue;
+		}
+
+		if (!node.HasChildren())
+		{
+			if (FVector::DistSquared(centre, aTarget) <= radiusSq)
+			{
+				Links.Add(link);
+				Positions.Add(centre);
+			}
+			continue;
+		}
+
+		if (layer > 0)
+		{
+			for (int32 child = 0; child < 8; child++)
+			{
+				stack.Add(AeonixLink(layer - 1, node.FirstChild.GetNodeIndex() + child, 0));
+			}
+			continue;
+		}
+
+		const uint64 grid = octreeData.GetLeafNode(node.FirstChild.GetNodeIndex()).VoxelGrid;
+		uint64 free = ~grid;
+		while (free)
+		{
+			const subnodeindex_t subnode = static_cast<subnodeindex_t>(FMath::CountTrailingZeros64(free));
+			free &= free - 1;
+
+			uint_fast32_t x = 0, y = 0, z = 0;
+			morton3D_64_decode(subnode, x, y, z);
+			const FVector position = bounds.Min + (FVector(x, y, z) + FVector(0.5f)) * subnodeSize;
+			if (FVector::DistSquared(position, aTarget) <= radiusSq)
+			{
+				Links.Add(AeonixLink(0, link.GetNodeIndex(), subnode));
+				Positions.Add(position);
+			}
+		}
+
+		if (grid)
+		{
+			occluders.Add({ bounds, grid, nearDistanceSq });
+		}
+	}
+
+	// Nearest first, so each ray can stop at the first leaf beyond its end
+	occluders.Sort([](const FOccluder& a, const FOccluder& b) { return a.NearDistanceSq < b.NearDistanceSq; });
+
+	// Bin each leaf into every bucket whose cone of directions overlaps the leaf's bounding cone from the target
+	TArray<FVector> bucketDirections;
+	GetBucketDirections(bucketDirections);
+	// Widest a bucket gets, round its centre direction, which is at the middle of a face where the cells subtend the most
+	const float bucketHalfAngle = FMath::Atan(UE_SQRT_2 / FaceResolution);
+
+	TArray<int32> bucketStart;
+	bucketStart.SetNumZeroed(NumBuckets + 1);
+	TArray<TPair<int32, int32>> binned;
+	for (int32 occluderIndex = 0; occluderIndex < occluders.Num(); occluderIndex++)
+	{
+		const FBox& bounds = occluders[occluderIndex].Bounds;
+		const FVector toCentre = bounds.GetCenter() - aTarget;
+		const float distance = toCentre.Size();
+		const float boundingRadius = bounds.GetExtent().Size();
+
+		// Round the target, or close enough that it fills most of the sky
+		float minCos = -1.f;
+		if (distance > boundingRadius)
+		{
+			const float coneHalfAngle = FMath::Asin(boundingRadius / distance) + bucketHalfAngle + KINDA_SMALL_NUMBER;
+			minCos = coneHalfAngle < PI ? FMath::Cos(coneHalfAngle) : -1.f;
+		}
+
+		const FVector axis = distance > SMALL_NUMBER ? toCentre / distance : FVector::ForwardVector;
+		for (int32 bucket = 0; bucket < NumBuckets; bucket++)
+		{
+			if (minCos <= -1.f || FVector::DotProduct(axis, bucketDirections[bucket]) >= minCos)
+			{
+				binned.Emplace(bucket, occluderIndex);
+				bucketStart[bucket + 1]++;
+			}
+		}
+	}
+
+	// Counting sort by bucket, occluders stay nearest first within each
+	for (int32 bucket = 0; bucket < NumBuckets; bucket++)
+	{
+		bucketStart[bucket + 1] += bucketStart[bucket];
+	}
+	TArray<int32> bucketOccluders;
+	bucketOccluders.SetNumUninitialized(binned.Num());
+	{
+		TArray<int32> next(bucketStart.GetData(), NumBuckets);
+		for (const TPair<int32, int32>& entry : binned)
+		{
+			bucketOccluders[next[entry.Key]++] = entry.Value;
+		}
+	}
+
+	// Each ray runs from the target to a voxel centre, testing only the leaves in its direction's bucket
+	TArray<uint8> visible;
+	visible.SetNumZeroed(Links.Num());
+	ParallelFor(Links.Num(), [&](int32 index)
+	{
+		const FVector delta = Positions[index] - aTarget;
+		const float lengthSq = delta.SizeSquared();
+		if (lengthSq <= SMALL_NUMBER)
+		{
+			visible[index] = 1;
+			return;
+		}
+
+		const FVector invDelta(
+			FMath::IsNearlyZero(delta.X) ? 0.f : 1.f / delta.X,
+			FMath::IsNearlyZero(delta.Y) ? 0.f : 1.f / delta.Y,
+			FMath::IsNearlyZero(delta.Z) ? 0.f : 1.f / delta.Z);
+
+		const int32 bucket = GetBucket(delta);
+		for (int32 i = bucketStart[bucket]; i < bucketStart[bucket + 1]; i++)
+		{
+			const FOccluder& occluder = occluders[bucketOccluders[i]];
+			if (occluder.NearDistanceSq >= lengthSq)
+			{
+				break;
+			}
+			if (!SegmentHitsBox(occluder.Bounds.Min, occluder.Bounds.Max, aTarget, delta, invDelta))
+			{
+				continue;
+			}
+
+			uint64 blocked = occluder.Blocked;
+			while (blocked)
+			{
+				const uint64 subnode = FMath::CountTrailingZeros64(blocked);
+				blocked &= blocked - 1;
+
+				uint_fast32_t x = 0, y = 0, z = 0;
+				morton3D_64_decode(subnode, x, y, z);
+				const FVector min = occluder.Bounds.Min + FVector(x, y, z) * subnodeSize;
+				const FVector max = min + FVector(subnodeSize);
+				if (SegmentHitsBox(min, max, aTarget, delta, invDelta) && !FBox(min, max).IsInsideOrOn(aTarget))
+				{
+					return;
+				}
+			}
+		}
+		visible[index] = 1;
+	}, Links.Num() < MinParallelRays ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	Visible.Init(false, Links.Num());
+	LinkIndices.Reserve(Links.Num());
+	for (int32 i = 0; i < Links.Num(); i++)
+	{
+		LinkIndices.Add(Links[i], i);
+		if (visible[i])
+		{
+			Visible[i] = true;
+			NumVisible++;
+		}
+	}
+}
+
+void FAeonixVisibilityField::Reset()
+{
+	Links.Empty();
+	Positions.Empty();
+	Visible.Empty();
+	LinkIndices.Empty();
+	NumVisible = 0;
+	bIsValid = false;
+}
+
+bool FAeonixVisibilityField::IsCurrent(const FAeonixData& aData) const
+{
+	return bIsValid && GenerationId == aData.GetGenerationId() && LeafChangeSerial == aData.GetLeafChangeSerial();
+}
+
+EAeonixVisibility FAeonixVisibilityField::GetLinkVisibility(const AeonixLink& aLink) const
+{
+	const int32* index = LinkIndices.Find(aLink);
+	if (!index)
+	{
+		return EAeonixVisibility::Unknown;
+	}
+	return Visible[*index] ? EAeonixVisibility::Visible : EAeonixVisibility::Hidden;
+}
+
+void FAeonixVisibilityField::GetPositions(bool bVisible, TArray<FVector>& oPositions) const
+{
+	for (int32 i = 0; i < Links.Num(); i++)
+	{
+		if (Visible[i] == bVisible)
+		{
+			oPositions.Add(Positions[i]);
+		}
+	}
+}
@@ -5,7 +5,6 @@
 #include "EnvironmentQuery/Items/EnvQueryItemType_Point.h"
 #include "Subsystem/AeonixSubsystem.h"
 #include "Actor/AeonixBoundingVolume.h"
-#include "Util/AeonixMediator.h"
 #include "Data/AeonixData.h"
 #include "AeonixNavigation.h"
 
@@ -94,6 +93,8 @@ void UAeonixEQS3DGridGenerator::GenerateItems(FEnvQueryInstance& QueryInstance)
 	GeneratedPoints.Reserve(EstimatedPoints / 2); // Sphere is ~52% of cube volume
 
 	// Generate 3D grid with fixed spacing
+	TArray<FVector> TestPoints;
+	TestPoints.Reserve(EstimatedPoints / 2);
 	for (float X = -Radius; X <= Radius; X += Spacing)
 	{
 		for (float Y = -Radius; Y <= Radius; Y += Spacing)
@@ -101,51 +102,52 @@ void UAeonixEQS3DGridGenerator::GenerateItems(FEnvQueryInstance& QueryInstance)
 			for (float Z = -Radius; Z <= Radius; Z += Spacing)
 			{
 				const FVector Offset(X, Y, Z);
-				const FVector TestPoint = Origin + Offset;
 
 				// Spherical bounds culling
-				if (Offset.SizeSquared() > RadiusSquared)
+				if (Offset.SizeSquared() <= RadiusSquared)
 				{
-					continue;
+					TestPoints.Add(Origin + Offset);
 				}
+			}
+		}
+	}
 
-				// Validate against navigation data if requested
-				if (bOnlyNavigablePoints && NavVolume)
-				{
-					AeonixLink Link;
-					if (!AeonixMediator::GetLinkFromPosition(TestPoint, *NavVolume, Link))
-					{
-						// Point is not in navigable space
-						continue;
-					}
-
-					// Optionally project to navigation voxel center
-					if (bProjectToNavigation)
-					{
-						FVector ProjectedPos;
-						if (NavVolume->GetNavData().GetLinkPosition(Link, ProjectedPos))
-						{
-							GeneratedPoints.Add(FNavLocation(ProjectedPos));
-						}
-						else
-						{
-							// Fallback to original position if projection fails
-							GeneratedPoints.Add(FNavLocation(TestPoint));
-						}
-					}
-					else
-					{
-						GeneratedPoints.Add(FNavLocation(TestPoint));
-					}
-				}
-				else
+	// Validate against navigation data if requested
+	if (bOnlyNavigablePoints && NavVolume)
+	{
+		// The whole grid is classified in one walk of the octree. Blocked points are moved to the nearest free space when projecting,
+		// as long as they stay closer to their own grid point than any other
+		FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+		const FAeonixData& NavData = NavVolume->GetNavData();
+		TArray<FAeonixPointClassification> Classifications;
+		NavData.ClassifyPoints(TestPoints, bProjectToNavigation ? Spacing * 0.5f : 0.0f, Classifications);
+
+		for (const FAeonixPointClassification& Classification : Classifications)
+		{
+			if (Classification.State == EAeonixPointState::Projected)
+			{
+				GeneratedPoints.Add(FNavLocation(Classification.Position));
+			}
+			else if (Classification.State == EAeonixPointState::Free)
+			{
+				// Optionally project to navigation voxel center, falling back to the original position if that fails
+				FVector ProjectedPos = Classification.Position;
+				if (bProjectToNavigation)
 				{
-					// No validation - add all grid points
-					GeneratedPoints.Add(FNavLocation(TestPoint));
+					NavData.GetLinkPosition(Classification.Link, ProjectedPos);
 				}
+				GeneratedPoints.Add(FNavLocation(ProjectedPos));
 			}
 		}
 	}
+	else
+	{
+		// No validation - add all grid points
+		for (const FVector& TestPoint : TestPoints)
+		{
+			GeneratedPoints.Add(FNavLocation(TestPoint));
+		}
+	}
 
 	// Add generated points to query instance
 	for (const FNavLocation& NavLoc : GeneratedPoints)
@@ -0,0 +1,97 @@
+// Copyright 2024 Chris Ashworth
+
+#include "EQS/AeonixEQSPathDistanceTest.h"
+#include "EnvironmentQuery/Contexts/EnvQueryContext_Querier.h"
+#include "EnvironmentQuery/Items/EnvQueryItemType_VectorBase.h"
+#include "Subsystem/AeonixSubsystem.h"
+#include "AeonixNavigation.h"
+
+UAeonixEQSPathDistanceTest::UAeonixEQSPathDistanceTest(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	Context = UEnvQueryContext_Querier::StaticClass();
+	// One search for the whole item set, rather than one per item
+	Cost = EEnvTestCost::Medium;
+	ValidItemType = UEnvQueryItemType_VectorBase::StaticClass();
+	SetWorkOnFloatValues(true);
+
+	MaxPathDistance.DefaultValue = 3000.0f;
+	SkipUnreachable.DefaultValue = true;
+}
+
+void UAeonixEQSPathDistanceTest::RunTest(FEnvQueryInstance& QueryInstance) const
+{
+	UObject* DataOwner = QueryInstance.Owner.Get();
+	MaxPathDistance.BindData(DataOwner, QueryInstance.QueryID);
+	SkipUnreachable.BindData(DataOwner, QueryInstance.QueryID);
+	FloatValueMin.BindData(DataOwner, QueryInstance.QueryID);
+	FloatValueMax.BindData(DataOwner, QueryInstance.QueryID);
+
+	const float MaxDistance = MaxPathDistance.GetValue();
+	const bool bSkipUnreachable = SkipUnreachable.GetValue();
+	const float MinThresholdValue = FloatValueMin.GetValue();
+	const float MaxThresholdValue = FloatValueMax.GetValue();
+
+	TArray<FVector> ContextLocations;
+	if (!QueryInstance.PrepareContext(Context, ContextLocations) || ContextLocations.Num() == 0)
+	{
+		return;
+	}
+
+	UAeonixSubsystem* AeonixSubsystem = QueryInstance.World ? QueryInstance.World->GetSubsystem<UAeonixSubsystem>() : nullptr;
+	if (!AeonixSubsystem)
+	{
+		UE_LOG(LogAeonixNavigation, Warning, TEXT("AeonixEQSPathDistanceTest: No AeonixSubsystem found"));
+		return;
+	}
+
+	// Every item still in the running, by item index, so the distances line up with the iterator below
+	TArray<FVector> ItemLocations;
+	TArray<int32> ItemSlots;
+	ItemSlots.Init(INDEX_NONE, QueryInstance.Items.Num());
+	for (int32 ItemIndex = 0; ItemIndex < QueryInstance.Items.Num(); ItemIndex++)
+	{
+		if (QueryInstance.Items[ItemIndex].IsValid())
+		{
+			ItemSlots[ItemIndex] = ItemLocations.Add(GetItemLocation(QueryInstance, ItemIndex));
+		}
+	}
+
+	TArray<float> Distances;
+	AeonixSubsystem->GetPathDistances(ContextLocations[0], ItemLocations, MaxDistance, PathfinderSettings, Distances);
+
+	for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
+	{
+		const int32 Slot = ItemSlots[It.GetIndex()];
+		const float Distance = Distances.IsValidIndex(Slot) ? Distances[Slot] : -1.0f;
+		if (Distance >= 0.0f)
+		{
+			It.SetScore(TestPurpose, FilterType, Distance, MinThresholdValue, MaxThresholdValue);
+		}
+		else if (bSkipUnreachable)
+		{
+			It.ForceItemState(EEnvItemStatus::Failed);
+		}
+		else
+		{
+			It.SetScore(TestPurpose, FilterType, BIG_NUMBER, MinThresholdValue, MaxThresholdValue);
+		}
+	}
+}
+
+FText UAeonixEQSPathDistanceTest::GetDescriptionTitle() const
+{
+	return FText::Format(
+		NSLOCTEXT("EnvQueryTest", "AeonixPathDistanceDescription", "Aeonix path distance from {0}"),
+		UEnvQueryTypes::DescribeContext(Context)
+	);
+}
+
+FText UAeonixEQSPathDistanceTest::GetDescriptionDetails() const
+{
+	return FText::Format(
+		NSLOCTEXT("EnvQueryTest", "AeonixPathDistanceDetails", "Up to {0}, from one search for all items.\n{1}"),
+		FText::FromString(MaxPathDistance.ToString()),
+		DescribeFloatTestParams()
+	);
+}
@@ -0,0 +1,98 @@
+// Copyright 2024 Chris Ashworth
+
+#include "EQS/AeonixEQSVisibilityTest.h"
+#include "EnvironmentQuery/Contexts/EnvQueryContext_Querier.h"
+#include "EnvironmentQuery/Items/EnvQueryItemType_VectorBase.h"
+#include "Subsystem/AeonixSubsystem.h"
+#include "Actor/AeonixBoundingVolume.h"
+#include "Data/AeonixData.h"
+#include "AeonixNavigation.h"
+
+UAeonixEQSVisibilityTest::UAeonixEQSVisibilityTest(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	Context = UEnvQueryContext_Querier::StaticClass();
+	Cost = EEnvTestCost::Medium;
+	ValidItemType = UEnvQueryItemType_VectorBase::StaticClass();
+	SetWorkOnFloatValues(false);
+
+	MaxRadius.DefaultValue = 2000.0f;
+}
+
+void UAeonixEQSVisibilityTest::RunTest(FEnvQueryInstance& QueryInstance) const
+{
+	UObject* DataOwner = QueryInstance.Owner.Get();
+	MaxRadius.BindData(DataOwner, QueryInstance.QueryID);
+	BoolValue.BindData(DataOwner, QueryInstance.QueryID);
+
+	const float Radius = MaxRadius.GetValue();
+	const bool bWantsVisible = BoolValue.GetValue();
+
+	TArray<FVector> ContextLocations;
+	if (!QueryInstance.PrepareContext(Context, ContextLocations) || ContextLocations.Num() == 0)
+	{
+		return;
+	}
+	const FVector Target = ContextLocations[0];
+
+	UAeonixSubsystem* AeonixSubsystem = QueryInstance.World ? QueryInstance.World->GetSubsystem<UAeonixSubsystem>() : nullptr;
+	if (!AeonixSubsystem)
+	{
+		UE_LOG(LogAeonixNavigation, Warning, TEXT("AeonixEQSVisibilityTest: No AeonixSubsystem found"));
+		return;
+	}
+
+	// Every item still in the running, by item index, and how far out the field needs to reach to cover them
+	TArray<FVector> ItemLocations;
+	TArray<int32> ItemSlots;
+	ItemSlots.Init(INDEX_NONE, QueryInstance.Items.Num());
+	float FieldRadiusSq = 0.0f;
+	for (int32 ItemIndex = 0; ItemIndex < QueryInstance.Items.Num(); ItemIndex++)
+	{
+		if (QueryInstance.Items[ItemIndex].IsValid())
+		{
+			const FVector Location = GetItemLocation(QueryInstance, ItemIndex);
+			ItemSlots[ItemIndex] = ItemLocations.Add(Location);
+			FieldRadiusSq = FMath::Max(FieldRadiusSq, FVector::DistSquared(Location, Target));
+		}
+	}
+
+	// Items are tested by their voxel's centre, which can be up to half a voxel further out than the item
+	const AAeonixBoundingVolume* NavVolume = AeonixSubsystem->GetVolumeForPosition(Target);
+	const float Padding = NavVolume ? NavVolume->GetNavData().GetVoxelSize(0) : 0.0f;
+	const float FieldRadius = FMath::Min(FMath::Sqrt(FieldRadiusSq) + Padding, Radius);
+
+	TArray<EAeonixVisibility> Visibility;
+	AeonixSubsystem->GetPointVisibility(Target, ItemLocations, FieldRadius, Visibility);
+
+	for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
+	{
+		const int32 Slot = ItemSlots[It.GetIndex()];
+		const EAeonixVisibility ItemVisibility = Visibility.IsValidIndex(Slot) ? Visibility[Slot] : EAeonixVisibility::Unknown;
+		if (ItemVisibility == EAeonixVisibility::Unknown)
+		{
+			It.ForceItemState(EEnvItemStatus::Failed);
+		}
+		else
+		{
+			It.SetScore(TestPurpose, FilterType, ItemVisibility == EAeonixVisibility::Visible, bWantsVisible);
+		}
+	}
+}
+
+FText UAeonixEQSVisibilityTest::GetDescriptionTitle() const
+{
+	return FText::Format(
+		NSLOCTEXT("EnvQueryTest", "AeonixVisibilityDescription", "Aeonix visibility to {0}"),
+		UEnvQueryTypes::DescribeContext(Context)
+	);
+}
+
+FText UAeonixEQSVisibilityTest::GetDescriptionDetails() const
+{
+	return FText::Format(
+		NSLOCTEXT("EnvQueryTest", "AeonixVisibilityDetails", "Up to {0}, from one visibility field for all items.\n{1}"),
+		FText::FromString(MaxRadius.ToString()),
+		DescribeBoolTestParams(TEXT("visible"))
+	);
+}
@@ -0,0 +1,67 @@
+#include "EQS/AeonixFloodFillCache.h"
+
+#include "Misc/ScopeLock.h"
+
+void FAeonixFloodFillCache::SetCapacity(int32 InMaxEntries)
+{
+	FScopeLock ScopeLock(&Lock);
+	MaxEntries = FMath::Max(0, InMaxEntries);
+	Entries.Empty(FMath::Max(1, MaxEntries));
+}
+
+bool FAeonixFloodFillCache::Find(const FAeonixFloodFillCacheKey& Key, uint32 GenerationId, TFunctionRef<uint32(const FGuid&)> GetRegionVersion, TArray<FVector>& OutPoints)
+{
+	if (!IsEnabled())
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	const FEntry* Entry = Entries.FindAndTouch(Key);
+	if (!Entry)
+	{
+		return false;
+	}
+
+	// A regenerated volume invalidates every link, a regenerated region only the floods that could reach into it
+	bool bStale = Entry->GenerationId != GenerationId;
+	for (const TPair<FGuid, uint32>& RegionVersion : Entry->RegionVersions)
+	{
+		if (bStale || GetRegionVersion(RegionVersion.Key) != RegionVersion.Value)
+		{
+			bStale = true;
+			break;
+		}
+	}
+
+	if (bStale)
+	{
+		Entries.Remove(Key);
+		return false;
+	}
+
+	OutPoints = Entry->Points;
+	return true;
+}
+
+void FAeonixFloodFillCache::Add(const FAeonixFloodFillCacheKey& Key, uint32 GenerationId, const TArray<FVector>& Points, TMap<FGuid, uint32>&& RegionVersions)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	FEntry Entry;
+	Entry.Points = Points;
+	Entry.RegionVersions = MoveTemp(RegionVersions);
+	Entry.GenerationId = GenerationId;
+
+	FScopeLock ScopeLock(&Lock);
+	Entries.Add(Key, Entry);
+}
+
+void FAeonixFloodFillCache::Empty()
+{
+	FScopeLock ScopeLock(&Lock);
+	Entries.Empty(FMath::Max(1, MaxEntries));
+}
@@ -0,0 +1,23 @@
+#include "Pathfinding/AeonixFlowField.h"
+
+void FAeonixFlowField::Reset(const AeonixLink& InTargetLink, const FVector& InTargetPosition, uint32 InGenerationId)
+{
+	Invalidate();
+
+	TargetLink = InTargetLink;
+	TargetPosition = InTargetPosition;
+	GenerationId = InGenerationId;
+
+	NextHop.Add(TargetLink, TargetLink);
+	Cost.Add(TargetLink, 0.f);
+	OpenHeap.HeapPush({ TargetLink, 0.f });
+}
+
+void FAeonixFlowField::Invalidate()
+{
+	TargetLink = AeonixLink();
+	NextHop.Reset();
+	Cost.Reset();
+	Settled.Reset();
+	OpenHeap.Reset();
+}
@@ -0,0 +1,16 @@
+#include "Pathfinding/AeonixIncrementalSearch.h"
+
+void FAeonixIncrementalSearch::Reset()
+{
+	GoalLink = AeonixLink();
+	LastStart = AeonixLink();
+	KeyModifier = 0.f;
+	GenerationId = 0;
+	LeafChangeSerial = 0;
+	G.Reset();
+	Rhs.Reset();
+	OpenKeys.Reset();
+	OpenHeap.Reset();
+	LastExpansions = 0;
+	bLastSearchWasRepair = false;
+}
@@ -17,6 +17,7 @@ void FAeonixNavigationPath::ResetForRepath()
 	UE_LOG(LogAeonixNavigation, Verbose, TEXT("AeonixNavigationPath: ResetForRepath called, clearing %d points"), myPoints.Num());
 	myPoints.Empty();
 	myIsReady = false;
+	myIsPartial = false;
 }
 
 void FAeonixNavigationPath::DebugDraw(UWorld* World, const FAeonixData& Data)
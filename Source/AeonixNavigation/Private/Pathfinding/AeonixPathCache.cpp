@@ -0,0 +1,97 @@
+#include "Pathfinding/AeonixPathCache.h"
+
+#include "Pathfinding/AeonixPathFinder.h"
+
+void FAeonixPathCacheKey::SetSettings(const FAeonixPathFinderSettings& InSettings)
+{
+	Settings = MakeShared<const FAeonixPathFinderSettings>(InSettings);
+	SettingsHash = GetTypeHash(InSettings);
+}
+
+bool FAeonixPathCacheKey::operator==(const FAeonixPathCacheKey& Other) const
+{
+	if (!(Volume == Other.Volume && Start == Other.Start && Goal == Other.Goal && SettingsHash == Other.SettingsHash))
+	{
+		return false;
+	}
+
+	return Settings == Other.Settings || (Settings.IsValid() && Other.Settings.IsValid() && *Settings == *Other.Settings);
+}
+
+void FAeonixPathCache::SetCapacity(int32 InMaxEntries)
+{
+	MaxEntries = FMath::Max(0, InMaxEntries);
+	Entries.Empty(FMath::Max(1, MaxEntries));
+}
+
+bool FAeonixPathCache::Find(const FAeonixPathCacheKey& Key, uint32 GenerationId, TFunctionRef<uint32(const FGuid&)> GetRegionVersion,
+	TFunctionRef<bool(const FVector&, const FVector&)> IsSegmentClear, const FVector& StartPosition, const FVector& EndPosition, FAeonixNavigationPath& OutPath)
+{
+	if (!IsEnabled())
+	{
+		return false;
+	}
+
+	const FEntry* Entry = Entries.FindAndTouch(Key);
+	if (!Entry)
+	{
+		return false;
+	}
+
+	// A regenerated volume invalidates every link, a regenerated region only the paths through it
+	bool bStale = Entry->GenerationId != GenerationId;
+	for (const TPair<FGuid, uint32>& RegionVersion : Entry->RegionVersions)
+	{
+		if (bStale || GetRegionVersion(RegionVersion.Key) != RegionVersion.Value)
+		{
+			bStale = true;
+			break;
+		}
+	}
+
+	if (bStale)
+	{
+		Entries.Remove(Key);
+		return false;
+	}
+
+	// Same start and goal voxels, so only the end points need moving. A node can be big enough that the move puts geometry between
+	// an end point and its neighbour though, that's a miss rather than a stale entry as the path still suits other positions
+	const TArray<FAeonixPathPoint>& Points = Entry->Points;
+	if (!IsSegmentClear(StartPosition, Points[1].Position) || !IsSegmentClear(Points[Points.Num() - 2].Position, EndPosition))
+	{
+		return false;
+	}
+
+	OutPath.ResetForRepath();
+	OutPath.GetPathPoints() = Points;
+	OutPath.GetPathPoints()[0].Position = StartPosition;
+	OutPath.GetPathPoints().Last().Position = EndPosition;
+
+	for (const TPair<FGuid, uint32>& RegionVersion : Entry->RegionVersions)
+	{
+		OutPath.AddTraversedRegion(RegionVersion.Key);
+	}
+
+	return true;
+}
+
+void FAeonixPathCache::Add(const FAeonixPathCacheKey& Key, uint32 GenerationId, const FAeonixNavigationPath& Path, TMap<FGuid, uint32>&& RegionVersions)
+{
+	if (!IsEnabled() || Path.GetNumPoints() < 2)
+	{
+		return;
+	}
+
+	FEntry Entry;
+	Entry.Points = Path.GetPathPoints();
+	Entry.RegionVersions = MoveTemp(RegionVersions);
+	Entry.GenerationId = GenerationId;
+
+	Entries.Add(Key, Entry);
+}
+
+void FAeonixPathCache::Empty()
+{
+	Entries.Empty(FMath::Max(1, MaxEntries));
+}
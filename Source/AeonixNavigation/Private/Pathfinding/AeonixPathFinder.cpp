@@ -1,4 +1,3 @@
-
 #include "Pathfinding/AeonixPathFinder.h"
 
 #include "AeonixNavigation.h"
@@ -7,357 +6,1727 @@
 #include "Data/AeonixLink.h"
 #include "Data/AeonixNode.h"
 #include "Data/AeonixStats.h"
+#include "Pathfinding/AeonixFlowField.h"
+#include "Pathfinding/AeonixIncrementalSearch.h"
 #include "Pathfinding/AeonixNavigationPath.h"
 
+uint32 GetTypeHash(const FAeonixPathFinderSettings& Settings)
+{
+	uint32 Hash = GetTypeHash(Settings.bUseUnitCost);
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.UnitCost));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.MaxIterations));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.bUseLeafJumpPointSearch));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.bExpandLeafRegions));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.bCollapseEmptyLeaves));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.AgentRadius));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.VisibleCostMultiplier));
+	// The field's address can be reused once it's freed, what it was built from can't be
+	if (Settings.VisibilityField.IsValid())
+	{
+		Hash = HashCombineFast(Hash, GetTypeHash(Settings.VisibilityField->GetGenerationId()));
+		Hash = HashCombineFast(Hash, GetTypeHash(Settings.VisibilityField->GetLeafChangeSerial()));
+	}
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.bUseAnyAnglePathfinding));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.bVectorizeNeighbourExpansion));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.HeuristicSettings.EuclideanWeight));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.HeuristicSettings.bUseLandmarks));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.HeuristicSettings.VelocityWeight));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.HeuristicSettings.VelocityBias));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.HeuristicSettings.NodeSizeWeight));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.HeuristicSettings.GlobalWeight));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.PathPointType));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.bOptimizePath));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.OptimizeDotTolerance));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.bUseStringPulling));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.StringPullingVoxelThreshold));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.bUseVisibilityStringPulling));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.bSmoothPositions));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.SmoothingFactor));
+	Hash = HashCombineFast(Hash, GetTypeHash(Settings.SmoothingIterations));
+	return Hash;
+}
+
+bool operator==(const FAeonixPathFinderSettings& A, const FAeonixPathFinderSettings& B)
+{
+	return A.VisibilityField == B.VisibilityField && FAeonixPathFinderSettings::StaticStruct()->CompareScriptStruct(&A, &B, PPF_None);
+}
+
 bool AeonixPathFinder::FindPath(const AeonixLink& Start, const AeonixLink& InGoal, const FVector& StartPos, const FVector& TargetPos, FAeonixNavigationPath& Path, FAeonixPathFailureInfo* OutFailureInfo)
 {
-	OpenHeap.Empty();
-	OpenSetLookup.Empty();
-	ClosedSet.Empty();
-	CameFrom.Empty();
-	FScore.Empty();
-	GScore.Empty();
-	CurrentLink = AeonixLink();
-	GoalLink = InGoal;
-	StartLink = Start;
+	GoalLinks.Reset();
+	GoalLinks.Add(InGoal);
+	GoalPositions.Reset();
+	GoalPositions.Add(TargetPos);
 
-	CameFrom.Add(Start, Start);
-	GScore.Add(Start, 0);
-	FScore.Add(Start, CalculateHeuristic(Start, InGoal)); // Distance to target
+	return SearchToGoals(Start, StartPos, Path, OutFailureInfo);
+}
 
-	// Add start to open set using heap
-	OpenHeap.Add(Start);
-	OpenSetLookup.Add(Start);
+bool AeonixPathFinder::FindPathToNearestGoal(const AeonixLink& aStart, const TArray<AeonixLink>& aGoals, const FVector& aStartPos, const TArray<FVector>& aTargetPositions, FAeonixNavigationPath& oPath, int32& oGoalIndex, FAeonixPathFailureInfo* OutFailureInfo)
+{
+	oGoalIndex = INDEX_NONE;
 
-	int numIterations = 0;
-	FScoreHeapPredicate HeapPredicate(FScore);
+	if (aGoals.Num() == 0 || aGoals.Num() != aTargetPositions.Num())
+	{
+		UE_LOG(LogAeonixNavigation, Error, TEXT("FindPathToNearestGoal: Need one target position per goal link (%d links, %d positions)"), aGoals.Num(), aTargetPositions.Num());
+		return false;
+	}
 
-	// Diagnostic tracking for iteration explosion debugging
-	TSet<AeonixLink> UniqueNodesProcessed;
-	int32 DuplicatePopCount = 0;
-	int32 TotalNeighborsGenerated = 0;
-	int32 MaxNeighborsInSingleIteration = 0;
-	int32 EmptyLeafNeighbourCount = 0;
-	int32 NonEmptyLeafNeighbourCount = 0;
-	int32 HigherLayerNeighbourCount = 0;
+	GoalLinks = aGoals;
+	GoalPositions = aTargetPositions;
 
-	while (OpenHeap.Num() > 0)
+	if (!SearchToGoals(aStart, aStartPos, oPath, OutFailureInfo))
 	{
-		// Pop the node with lowest FScore from the heap - O(log n) instead of O(n)
-		OpenHeap.HeapPop(CurrentLink, HeapPredicate);
-		OpenSetLookup.Remove(CurrentLink);
+		return false;
+	}
 
-		// Skip if already processed (can happen with lazy deletion approach)
-		if (ClosedSet.Contains(CurrentLink))
+	oGoalIndex = GoalLinks.Find(GoalLink);
+	return true;
+}
+
+bool AeonixPathFinder::FindPathFromFlowField(FAeonixFlowField& ioField, const AeonixLink& aStart, const FVector& aStartPos, FAeonixNavigationPath& oPath, int32 aMaxExpansions)
+{
+	const int32 maxIterations = aMaxExpansions == INDEX_NONE ? Settings.MaxIterations : FMath::Min(aMaxExpansions, Settings.MaxIterations);
+	if (!ioField.IsValid() || !ExpandFlowField(ioField, aStart, maxIterations))
+	{
+		return false;
+	}
+
+	StartLink = aStart;
+	GoalLink = ioField.TargetLink;
+	StartPosition = aStartPos;
+	TargetPosition = ioField.TargetPosition;
+
+	// Follow the next hops out to the target
+	TArray<AeonixLink> links;
+	for (AeonixLink link = aStart;; link = ioField.NextHop[link])
+	{
+		links.Add(link);
+
+		if (link == ioField.TargetLink)
+		{
+			break;
+		}
+	}
+
+	BuildPathFromLinks(links, aStartPos, TargetPosition, oPath);
+	return true;
+}
+
+bool AeonixPathFinder::ExpandFlowField(FAeonixFlowField& ioField, const AeonixLink& aUntil, int32 aMaxIterations)
+{
+	int32 numIterations = 0;
+	TArray<AeonixLink> neighbours;
+
+	while (!ioField.Settled.Contains(aUntil))
+	{
+		if (ioField.OpenHeap.Num() == 0 || numIterations++ > aMaxIterations)
+		{
+			LastIterationCount = numIterations;
+			return false;
+		}
+
+		FAeonixFlowField::FOpenEntry entry;
+		ioField.OpenHeap.HeapPop(entry, EAllowShrinking::No);
+
+		// Already settled through a cheaper entry
+		if (ioField.Settled.Contains(entry.Link))
 		{
-			DuplicatePopCount++;
 			continue;
 		}
+		ioField.Settled.Add(entry.Link);
 
-		// Track unique nodes processed
-		UniqueNodesProcessed.Add(CurrentLink);
-		ClosedSet.Add(CurrentLink);
+		GetSearchNeighbours(entry.Link, neighbours);
 
-		if (CurrentLink == GoalLink)
+		for (const AeonixLink& neighbour : neighbours)
 		{
-			BuildPath(CameFrom, CurrentLink, StartPos, TargetPos, Path);
-			UE_LOG(LogAeonixNavigation, Display, TEXT("Pathfinding complete, iterations : %i"), numIterations);
+			if (!neighbour.IsValid() || ioField.Settled.Contains(neighbour))
+			{
+				continue;
+			}
 
-			LastIterationCount = numIterations;
-			return true;
+			// Adjacency is symmetric, so the cost of walking out from the target is the cost of walking back to it
+			const float cost = entry.Cost + GetCost(neighbour, entry.Link);
+			const float* knownCost = ioField.Cost.Find(neighbour);
+			if (knownCost && *knownCost <= cost)
+			{
+				continue;
+			}
+
+			ioField.Cost.Add(neighbour, cost);
+			ioField.NextHop.Add(neighbour, entry.Link);
+			ioField.OpenHeap.HeapPush({ neighbour, cost });
+		}
+	}
+
+	LastIterationCount = numIterations;
+	return true;
+}
+
+void AeonixPathFinder::FindPathDistances(const AeonixLink& aStart, float aMaxDistance, TConstArrayView<AeonixLink> aTargets, TArray<float>& oDistances)
+{
+	oDistances.Init(-1.f, aTargets.Num());
+
+	// Targets not settled yet, several can share a link
+	TMultiMap<AeonixLink, int32> pendingTargets;
+	for (int32 i = 0; i < aTargets.Num(); i++)
+	{
+		if (aTargets[i].IsValid())
+		{
+			pendingTargets.Add(aTargets[i], i);
 		}
+	}
 
-		const AeonixNode& currentNode = NavigationData.OctreeData.GetNode(CurrentLink);
+	LastIterationCount = 0;
+	if (!aStart.IsValid() || pendingTargets.Num() == 0)
+	{
+		return;
+	}
 
-		TArray<AeonixLink> neighbours;
+	// No goals to exempt from clearance filtering, a target the agent doesn't fit at is unreachable
+	GoalLinks.Reset();
+	GScore.Reset();
+	ClosedSet.Reset();
+	DistanceHeap.Reset();
 
-		if (CurrentLink.GetLayerIndex() == 0 && currentNode.FirstChild.IsValid())
+	GScore.Add(aStart, 0.f);
+	DistanceHeap.HeapPush({ aStart, 0.f });
+
+	// Bounded by aMaxDistance rather than MaxIterations, a cap sized for point to point searches would cut a wide radius short and report reachable points as unreachable
+	int32 numIterations = 0;
+	TArray<int32, TInlineAllocator<4>> settledTargets;
+	while (DistanceHeap.Num() > 0 && pendingTargets.Num() > 0)
+	{
+		numIterations++;
+
+		FDistanceEntry entry;
+		DistanceHeap.HeapPop(entry, EAllowShrinking::No);
+
+		bool bAlreadySettled = false;
+		ClosedSet.Add(entry.Link, &bAlreadySettled);
+		if (bAlreadySettled)
 		{
-			// Layer 0 node with leaf subdivision - use GetLeafNeighbours
-			// This returns ~6 neighbors (one per direction) instead of up to 96
-			// The previous "empty leaf optimization" was causing neighbor explosion
-			NavigationData.OctreeData.GetLeafNeighbours(CurrentLink, neighbours);
-			NonEmptyLeafNeighbourCount++;
+			continue;
+		}
 
-			// Early filtering: skip neighbors already in closed set
-			for (const AeonixLink& neighbour : neighbours)
+		settledTargets.Reset();
+		pendingTargets.MultiFind(entry.Link, settledTargets);
+		for (const int32 target : settledTargets)
+		{
+			oDistances[target] = entry.Cost;
+		}
+		pendingTargets.Remove(entry.Link);
+
+		GetSearchNeighbours(entry.Link, NeighbourScratch);
+		for (const AeonixLink& neighbour : NeighbourScratch)
+		{
+			if (!neighbour.IsValid() || ClosedSet.Contains(neighbour))
 			{
-				if (!ClosedSet.Contains(neighbour))
-				{
-					ProcessLink(neighbour);
-				}
+				continue;
+			}
+
+			// Nothing past the radius is settled, so it never needs to be opened
+			const float cost = entry.Cost + GetCost(entry.Link, neighbour);
+			const float* knownCost = GScore.Find(neighbour);
+			if (cost > aMaxDistance || (knownCost && *knownCost <= cost))
+			{
+				continue;
 			}
+
+			GScore.Add(neighbour, cost);
+			DistanceHeap.HeapPush({ neighbour, cost });
 		}
-		else
+	}
+
+	LastIterationCount = numIterations;
+}
+
+bool AeonixPathFinder::FindPathIncremental(FAeonixIncrementalSearch& ioSearch, const AeonixLink& aStart, const AeonixLink& aGoal, const FVector& aStartPos, const FVector& aTargetPos, FAeonixNavigationPath& oPath)
+{
+	StartLink = aStart;
+	GoalLink = aGoal;
+	StartPosition = aStartPos;
+	TargetPosition = aTargetPos;
+
+	// Earlier state can only be repaired if it was searched towards the same goal on the same nodes, and we still know which leaves changed since
+	TArray<nodeindex_t> changedLeaves;
+	TArray<uint64> changedVoxels;
+	const bool bRepair = ioSearch.IsValid()
+		&& ioSearch.GoalLink == aGoal
+		&& ioSearch.GenerationId == NavigationData.GetGenerationId()
+		&& NavigationData.GetLeafChangesSince(ioSearch.LeafChangeSerial, changedLeaves, changedVoxels);
+
+	if (bRepair)
+	{
+		// Keys already queued were measured from the old start, they can be off by at most the distance it moved
+		ioSearch.KeyModifier += GetIncrementalHeuristic(ioSearch.LastStart, aStart);
+		ioSearch.LastStart = aStart;
+
+		// Only the subnodes that flipped and their neighbours can have a different rhs. A flip also changes the clearance of the subnodes round it,
+		// so when that filters neighbours every subnode of a changed leaf is looked at
+		TSet<AeonixLink> affected;
+		TArray<AeonixLink> neighbours;
+		const TArray<AeonixNode>& layer0 = NavigationData.OctreeData.GetLayer(0);
+		for (int32 changeIndex = 0; changeIndex < changedLeaves.Num(); ++changeIndex)
 		{
-			NavigationData.OctreeData.GetNeighbours(CurrentLink, neighbours);
-			HigherLayerNeighbourCount++;
+			const nodeindex_t leafIndex = changedLeaves[changeIndex];
+			if (!layer0.IsValidIndex(leafIndex) || !layer0[leafIndex].FirstChild.IsValid())
+			{
+				continue;
+			}
 
-			// Early filtering: skip neighbors already in closed set
-			for (const AeonixLink& neighbour : neighbours)
+			const uint64 flipped = ShouldFilterByClearance() ? ~0ull : changedVoxels[changeIndex];
+			for (int32 subnode = 0; subnode < 64; ++subnode)
 			{
-				if (!ClosedSet.Contains(neighbour))
+				if (!(flipped & (1ull << subnode)))
 				{
-					ProcessLink(neighbour);
+					continue;
 				}
+
+				const AeonixLink link(0, leafIndex, subnode);
+				affected.Add(link);
+
+				GetSearchNeighbours(link, neighbours);
+				affected.Append(neighbours);
 			}
 		}
 
-		// Track neighbor generation statistics
-		TotalNeighborsGenerated += neighbours.Num();
-		MaxNeighborsInSingleIteration = FMath::Max(MaxNeighborsInSingleIteration, neighbours.Num());
+		for (const AeonixLink& link : affected)
+		{
+			UpdateIncrementalVertex(ioSearch, link);
+		}
+	}
+	else
+	{
+		ioSearch.Reset();
+		ioSearch.GoalLink = aGoal;
+		ioSearch.LastStart = aStart;
+		ioSearch.GenerationId = NavigationData.GetGenerationId();
+
+		ioSearch.Rhs.Add(aGoal, 0.f);
+		const FAeonixIncrementalSearch::FKey goalKey = CalculateIncrementalKey(ioSearch, aGoal);
+		ioSearch.OpenKeys.Add(aGoal, goalKey);
+		ioSearch.OpenHeap.HeapPush({ goalKey, aGoal });
+	}
 
-		// Periodic diagnostic logging every 100 iterations
-		if (numIterations > 0 && numIterations % 100 == 0)
+	ioSearch.LeafChangeSerial = NavigationData.GetLeafChangeSerial();
+	ioSearch.bLastSearchWasRepair = bRepair;
+
+	if (!ComputeIncrementalPath(ioSearch))
+	{
+		return false;
+	}
+
+	// Walk downhill through g from the start, every step goes to the neighbour with the cheapest remaining cost
+	TArray<AeonixLink> links;
+	TSet<AeonixLink> visited;
+	TArray<AeonixLink> neighbours;
+	links.Add(aStart);
+	visited.Add(aStart);
+	for (AeonixLink link = aStart; !(link == aGoal);)
+	{
+		GetSearchNeighbours(link, neighbours);
+
+		AeonixLink next;
+		float bestCost = FLT_MAX;
+		for (const AeonixLink& neighbour : neighbours)
 		{
-			FVector CurrentPos;
-			NavigationData.GetLinkPosition(CurrentLink, CurrentPos);
-			const float DistToGoal = FVector::Dist(CurrentPos, TargetPos);
+			const float neighbourG = ioSearch.G.FindRef(neighbour, FLT_MAX);
+			if (neighbourG == FLT_MAX || IsLinkBlocked(neighbour))
+			{
+				continue;
+			}
 
-			UE_LOG(LogAeonixNavigation, Verbose, TEXT("Iteration %d: Heap=%d, Unique=%d, Dups=%d, Neighbors=%d, MaxNeighbors=%d, DistToGoal=%.1f"),
-				numIterations, OpenHeap.Num(), UniqueNodesProcessed.Num(), DuplicatePopCount,
-				TotalNeighborsGenerated, MaxNeighborsInSingleIteration, DistToGoal);
+			const float cost = GetCost(link, neighbour) + neighbourG;
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				next = neighbour;
+			}
 		}
 
-		numIterations++;
-
-		if (numIterations > Settings.MaxIterations)
+		bool bAlreadyVisited = false;
+		if (next.IsValid())
 		{
-			const float Distance = FVector::Dist(StartPos, TargetPos);
-			FVector CurrentPos;
-			NavigationData.GetLinkPosition(CurrentLink, CurrentPos);
-			const float DistToGoal = FVector::Dist(CurrentPos, TargetPos);
+			visited.Add(next, &bAlreadyVisited);
+		}
 
-			UE_LOG(LogAeonixNavigation, Warning, TEXT("Pathfinding aborted - hit iteration limit %i. Distance: %.2f units. Start: %s, Target: %s, StartLink: (L:%d N:%d S:%d), GoalLink: (L:%d N:%d S:%d), CurrentLink: (L:%d N:%d S:%d)"),
-				numIterations,
-				Distance,
-				*StartPos.ToCompactString(),
-				*TargetPos.ToCompactString(),
-				StartLink.GetLayerIndex(), StartLink.GetNodeIndex(), StartLink.GetSubnodeIndex(),
-				InGoal.GetLayerIndex(), InGoal.GetNodeIndex(), InGoal.GetSubnodeIndex(),
-				CurrentLink.GetLayerIndex(), CurrentLink.GetNodeIndex(), CurrentLink.GetSubnodeIndex());
+		if (!next.IsValid() || bAlreadyVisited || links.Num() > Settings.MaxIterations)
+		{
+			UE_LOG(LogAeonixNavigation, Warning, TEXT("FindPathIncremental: Couldn't follow the search back to the goal, starting again next time"));
+			ioSearch.Reset();
+			return false;
+		}
 
-			// Detailed diagnostic information
-			UE_LOG(LogAeonixNavigation, Warning, TEXT("  Diagnostics: HeapSize=%d, UniqueNodes=%d, DuplicatePops=%d, TotalNeighbors=%d, MaxNeighbors=%d, DistToGoal=%.1f"),
-				OpenHeap.Num(), UniqueNodesProcessed.Num(), DuplicatePopCount,
-				TotalNeighborsGenerated, MaxNeighborsInSingleIteration, DistToGoal);
+		links.Add(next);
+		link = next;
+	}
 
-			// Calculate average neighbors per iteration
-			const float AvgNeighbors = numIterations > 0 ? static_cast<float>(TotalNeighborsGenerated) / numIterations : 0.0f;
-			UE_LOG(LogAeonixNavigation, Warning, TEXT("  AvgNeighborsPerIteration=%.1f, DuplicatePopRate=%.1f%%"),
-				AvgNeighbors, numIterations > 0 ? (DuplicatePopCount * 100.0f) / (numIterations + DuplicatePopCount) : 0.0f);
+	BuildPathFromLinks(links, aStartPos, aTargetPos, oPath);
+	return true;
+}
 
-			// Report which neighbor generation paths were taken
-			UE_LOG(LogAeonixNavigation, Warning, TEXT("  NeighborGenPaths: EmptyLeaf=%d, NonEmptyLeaf=%d, HigherLayer=%d"),
-				EmptyLeafNeighbourCount, NonEmptyLeafNeighbourCount, HigherLayerNeighbourCount);
+bool AeonixPathFinder::ComputeIncrementalPath(FAeonixIncrementalSearch& ioSearch)
+{
+	int32 numExpansions = 0;
+	TArray<AeonixLink> neighbours;
 
-			// Populate failure info if requested
-			if (OutFailureInfo)
+	while (true)
+	{
+		// Skip entries for links that have since been requeued or removed
+		while (ioSearch.OpenHeap.Num() > 0)
+		{
+			const FAeonixIncrementalSearch::FOpenEntry& top = ioSearch.OpenHeap.HeapTop();
+			const FAeonixIncrementalSearch::FKey* currentKey = ioSearch.OpenKeys.Find(top.Link);
+			if (currentKey && *currentKey == top.Key)
 			{
-				OutFailureInfo->bFailedDueToMaxIterations = true;
-				OutFailureInfo->StartPosition = StartPos;
-				OutFailureInfo->TargetPosition = TargetPos;
-				OutFailureInfo->StartLink = StartLink;
-				OutFailureInfo->GoalLink = InGoal;
-				OutFailureInfo->LastProcessedLink = CurrentLink;
-				OutFailureInfo->IterationCount = numIterations;
-				OutFailureInfo->StraightLineDistance = Distance;
+				break;
 			}
+			ioSearch.OpenHeap.HeapPopDiscard(EAllowShrinking::No);
+		}
 
-			LastIterationCount = numIterations;
+		const float startG = ioSearch.G.FindRef(StartLink, FLT_MAX);
+		const float startRhs = ioSearch.Rhs.FindRef(StartLink, FLT_MAX);
+		if (ioSearch.OpenHeap.Num() == 0 || (!(ioSearch.OpenHeap.HeapTop().Key < CalculateIncrementalKey(ioSearch, StartLink)) && startG == startRhs))
+		{
+			break;
+		}
+
+		if (++numExpansions > Settings.MaxIterations)
+		{
+			UE_LOG(LogAeonixNavigation, Warning, TEXT("FindPathIncremental: Hit iteration limit %d"), Settings.MaxIterations);
+			ioSearch.LastExpansions = numExpansions;
+			LastIterationCount = numExpansions;
 			return false;
 		}
+
+		FAeonixIncrementalSearch::FOpenEntry entry;
+		ioSearch.OpenHeap.HeapPop(entry, EAllowShrinking::No);
+		const AeonixLink& link = entry.Link;
+
+		const FAeonixIncrementalSearch::FKey newKey = CalculateIncrementalKey(ioSearch, link);
+		const float linkG = ioSearch.G.FindRef(link, FLT_MAX);
+		const float linkRhs = ioSearch.Rhs.FindRef(link, FLT_MAX);
+
+		if (entry.Key < newKey)
+		{
+			// The start moved since this was queued
+			ioSearch.OpenKeys.Add(link, newKey);
+			ioSearch.OpenHeap.HeapPush({ newKey, link });
+		}
+		else if (linkG > linkRhs)
+		{
+			// Overconsistent, the link got cheaper
+			ioSearch.G.Add(link, linkRhs);
+			ioSearch.OpenKeys.Remove(link);
+
+			GetSearchNeighbours(link, neighbours);
+			for (const AeonixLink& neighbour : neighbours)
+			{
+				UpdateIncrementalVertex(ioSearch, neighbour);
+			}
+		}
+		else
+		{
+			// Underconsistent, the link got dearer so everything routed through it has to be looked at again
+			ioSearch.G.Add(link, FLT_MAX);
+
+			GetSearchNeighbours(link, neighbours);
+			for (const AeonixLink& neighbour : neighbours)
+			{
+				UpdateIncrementalVertex(ioSearch, neighbour);
+			}
+			UpdateIncrementalVertex(ioSearch, link);
+		}
 	}
 
-	UE_LOG(LogAeonixNavigation, Display, TEXT("Pathfinding failed, iterations : %i"), numIterations);
-	LastIterationCount = numIterations;
-	return false;
+	ioSearch.LastExpansions = numExpansions;
+	LastIterationCount = numExpansions;
+	return ioSearch.G.FindRef(StartLink, FLT_MAX) < FLT_MAX;
 }
 
-float AeonixPathFinder::CalculateHeuristic(const AeonixLink& aStart, const AeonixLink& aTarget, const AeonixLink& aParent)
+void AeonixPathFinder::UpdateIncrementalVertex(FAeonixIncrementalSearch& ioSearch, const AeonixLink& aLink)
 {
-	float totalScore = 0.0f;
+	if (!(aLink == ioSearch.GoalLink))
+	{
+		// One step lookahead, cost through the best neighbour
+		float bestRhs = FLT_MAX;
+		if (!IsLinkBlocked(aLink))
+		{
+			GetSearchNeighbours(aLink, VertexNeighbourScratch);
+			for (const AeonixLink& neighbour : VertexNeighbourScratch)
+			{
+				const float neighbourG = ioSearch.G.FindRef(neighbour, FLT_MAX);
+				if (neighbourG == FLT_MAX || IsLinkBlocked(neighbour))
+				{
+					continue;
+				}
+				bestRhs = FMath::Min(bestRhs, GetCost(aLink, neighbour) + neighbourG);
+			}
+		}
+		ioSearch.Rhs.Add(aLink, bestRhs);
+	}
 
-	FVector startPos, targetPos;
-	NavigationData.GetLinkPosition(aStart, startPos);
-	NavigationData.GetLinkPosition(aTarget, targetPos);
+	ioSearch.OpenKeys.Remove(aLink);
+	if (ioSearch.G.FindRef(aLink, FLT_MAX) != ioSearch.Rhs.FindRef(aLink, FLT_MAX))
+	{
+		const FAeonixIncrementalSearch::FKey key = CalculateIncrementalKey(ioSearch, aLink);
+		ioSearch.OpenKeys.Add(aLink, key);
+		ioSearch.OpenHeap.HeapPush({ key, aLink });
+	}
+}
 
-	// 1. Euclidean distance component
-	if (Settings.HeuristicSettings.EuclideanWeight > 0.0f)
+FAeonixIncrementalSearch::FKey AeonixPathFinder::CalculateIncrementalKey(const FAeonixIncrementalSearch& aSearch, const AeonixLink& aLink)
+{
+	const float minCost = FMath::Min(aSearch.G.FindRef(aLink, FLT_MAX), aSearch.Rhs.FindRef(aLink, FLT_MAX));
+	if (minCost == FLT_MAX)
 	{
-		float euclideanDistance = (startPos - targetPos).Size();
-		totalScore += euclideanDistance * Settings.HeuristicSettings.EuclideanWeight;
+		return FAeonixIncrementalSearch::FKey();
 	}
 
-	// 2. Velocity component (requires valid parent)
-	if (Settings.HeuristicSettings.VelocityWeight > 0.0f && aParent.IsValid() && !(aParent == aStart))
+	return { minCost + GetIncrementalHeuristic(StartLink, aLink) + aSearch.KeyModifier, minCost };
+}
+
+float AeonixPathFinder::GetIncrementalHeuristic(const AeonixLink& aFrom, const AeonixLink& aTo) const
+{
+	// Has to stay admissible and consistent for repairs to be correct, so none of the weighted A* terms
+	if (Settings.bUseUnitCost || !aFrom.IsValid() || !aTo.IsValid())
 	{
-		// Get direction from parent to current node (incoming direction)
-		FVector incomingDirection = GetDirectionVector(aParent, aStart);
+		return 0.f;
+	}
 
-		// Get direction from current node to target (desired direction)
-		FVector outgoingDirection = GetDirectionVector(aStart, aTarget);
+	FVector fromPos, toPos;
+	NavigationData.GetLinkPosition(aFrom, fromPos);
+	NavigationData.GetLinkPosition(aTo, toPos);
+	return FVector::Dist(fromPos, toPos);
+}
 
-		// Calculate alignment using dot product (-1 to 1, where 1 = same direction)
-		float alignment = FVector::DotProduct(incomingDirection, outgoingDirection);
+bool AeonixPathFinder::SearchToGoals(const AeonixLink& Start, const FVector& StartPos, FAeonixNavigationPath& Path, FAeonixPathFailureInfo* OutFailureInfo)
+{
+	BeginSearch(Start, StartPos);
+	return StepSearch(MAX_int32, Path, OutFailureInfo) != EAeonixPathFindStatus::Failed;
+}
 
-		// Convert alignment to penalty (0 = same direction, 2 = opposite direction)
-		float directionPenalty = (1.0f - alignment);
+void AeonixPathFinder::BeginPath(const AeonixLink& aStart, const TArray<AeonixLink>& aGoals, const FVector& aStartPos, const TArray<FVector>& aTargetPositions)
+{
+	OpenHeap.Reset();
+	OpenSetLookup.Reset();
 
-		// Apply velocity bias and weight
-		float baseDistance = (startPos - targetPos).Size();
-		float velocityPenalty = directionPenalty * Settings.HeuristicSettings.VelocityBias * baseDistance;
-		totalScore += velocityPenalty * Settings.HeuristicSettings.VelocityWeight;
+	if (aGoals.Num() == 0 || aGoals.Num() != aTargetPositions.Num())
+	{
+		UE_LOG(LogAeonixNavigation, Error, TEXT("BeginPath: Need one target position per goal link (%d links, %d positions)"), aGoals.Num(), aTargetPositions.Num());
+		GoalLinks.Reset();
+		GoalPositions.Reset();
+		return;
+	}
+
+	GoalLinks = aGoals;
+	GoalPositions = aTargetPositions;
+	BeginSearch(aStart, aStartPos);
+}
+
+EAeonixPathFindStatus AeonixPathFinder::StepPath(int32 aIterationBudget, FAeonixNavigationPath& oPath, FAeonixPathFailureInfo* OutFailureInfo)
+{
+	if (GoalLinks.Num() == 0)
+	{
+		return EAeonixPathFindStatus::Failed;
+	}
+
+	return StepSearch(aIterationBudget, oPath, OutFailureInfo);
+}
+
+bool AeonixPathFinder::HasSearchReachedLeaves(const TSet<nodeindex_t>& aLeaves) const
+{
+	if (aLeaves.Num() == 0)
+	{
+		return false;
+	}
+
+	// Every generated link has an entry, open or closed
+	for (const TPair<AeonixLink, AeonixLink>& entry : CameFrom)
+	{
+		if (entry.Key.GetLayerIndex() == 0 && aLeaves.Contains(entry.Key.GetNodeIndex()))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+EAeonixPathFindStatus AeonixPathFinder::EndPathPartial(const TSet<nodeindex_t>& aAvoidLeaves, FAeonixNavigationPath& oPath)
+{
+	// Closest first, usually the first candidate's way back is clear
+	TArray<TPair<float, AeonixLink>> candidates;
+	candidates.Reserve(ClosedSet.Num());
+	for (const AeonixLink& link : ClosedSet)
+	{
+		if (link == StartLink)
+		{
+			continue;
+		}
+
+		const FVector position = GetSearchPosition(link);
+		float distance = FLT_MAX;
+		for (const FVector& goalPosition : GoalPositions)
+		{
+			distance = FMath::Min(distance, FVector::DistSquared(position, goalPosition));
+		}
+		candidates.Emplace(distance, link);
+	}
+	candidates.Sort([](const TPair<float, AeonixLink>& A, const TPair<float, AeonixLink>& B) { return A.Key < B.Key; });
+
+	auto crossesAvoidLeaves = [this, &aAvoidLeaves](AeonixLink link)
+	{
+		for (; !(link == StartLink); link = CameFrom[link])
+		{
+			if (link.GetLayerIndex() == 0 && aAvoidLeaves.Contains(link.GetNodeIndex()))
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	for (const TPair<float, AeonixLink>& candidate : candidates)
+	{
+		if (aAvoidLeaves.Num() > 0 && crossesAvoidLeaves(candidate.Value))
+		{
+			continue;
+		}
+
+		FVector partialEnd;
+		NavigationData.GetLinkPosition(candidate.Value, partialEnd);
+		GoalLink = candidate.Value;
+		BuildPath(CameFrom, candidate.Value, StartPosition, partialEnd, oPath);
+		oPath.SetIsPartial(true);
+
+		UE_LOG(LogAeonixNavigation, Log, TEXT("Search ended early, returning partial path ending %.1f units from the target"), FMath::Sqrt(candidate.Key));
+		return EAeonixPathFindStatus::Partial;
+	}
+
+	return EAeonixPathFindStatus::Failed;
+}
+
+void AeonixPathFinder::BeginSearch(const AeonixLink& Start, const FVector& StartPos)
+{
+	// Reset rather than Empty, so a pathfinder reused across searches keeps its allocations
+	OpenHeap.Reset();
+	OpenSetLookup.Reset();
+	ClosedSet.Reset();
+	CameFrom.Reset();
+	FScore.Reset();
+	GScore.Reset();
+	GridParent.Reset();
+	ClosedLeafRegions.Reset();
+	CurrentLink = AeonixLink();
+	// Until a goal is reached, diagnostics refer to the first one
+	GoalLink = GoalLinks[0];
+	StartLink = Start;
+	StartPosition = StartPos;
+	TargetPosition = GoalPositions[0];
+
+	GoalLinkPositions.Reset();
+	for (const AeonixLink& goal : GoalLinks)
+	{
+		NavigationData.GetLinkPosition(goal, GoalLinkPositions.AddDefaulted_GetRef());
+	}
+
+	CameFrom.Add(Start, Start);
+	GScore.Add(Start, 0);
+	FScore.Add(Start, CalculateGoalHeuristic(Start)); // Distance to target
+
+	// Add start to open set using heap
+	OpenHeap.Add(Start);
+	OpenSetLookup.Add(Start);
+
+	SearchIterations = 0;
+	LastIterationCount = 0;
+	Diagnostics.Reset();
+	BestPartialLink = AeonixLink();
+	BestPartialDistance = FLT_MAX;
+}
+
+EAeonixPathFindStatus AeonixPathFinder::StepSearch(int32 aIterationBudget, FAeonixNavigationPath& Path, FAeonixPathFailureInfo* OutFailureInfo)
+{
+	// Iteration count this call has to stop at, the search carries on from here next call
+	const int32 sliceEnd = aIterationBudget >= MAX_int32 - SearchIterations ? MAX_int32 : SearchIterations + aIterationBudget;
+	FScoreHeapPredicate HeapPredicate(FScore);
+
+	while (OpenHeap.Num() > 0)
+	{
+		if (SearchIterations >= sliceEnd)
+		{
+			LastIterationCount = SearchIterations;
+			return EAeonixPathFindStatus::InProgress;
+		}
+
+		// Pop the node with lowest FScore from the heap - O(log n) instead of O(n)
+		OpenHeap.HeapPop(CurrentLink, HeapPredicate);
+		OpenSetLookup.Remove(CurrentLink);
+
+		// Skip if already processed (can happen with lazy deletion approach)
+		if (ClosedSet.Contains(CurrentLink))
+		{
+			Diagnostics.DuplicatePopCount++;
+			continue;
+		}
+
+		// Track unique nodes processed
+		Diagnostics.UniqueNodesProcessed.Add(CurrentLink);
+		ClosedSet.Add(CurrentLink);
+
+		if (Settings.bReturnPartialPath)
+		{
+			UpdateBestPartialLink();
+		}
+
+		if (Settings.bUseAnyAnglePathfinding)
+		{
+			ValidateAnyAngleParent();
+		}
+
+		// With several goals the first one popped is the nearest
+		const int32 goalIndex = GoalLinks.Find(CurrentLink);
+		if (goalIndex != INDEX_NONE)
+		{
+			GoalLink = CurrentLink;
+			TargetPosition = GoalPositions[goalIndex];
+			BuildPath(CameFrom, CurrentLink, StartPosition, TargetPosition, Path);
+			UE_LOG(LogAeonixNavigation, Display, TEXT("Pathfinding complete, iterations : %i"), SearchIterations);
+
+			LastIterationCount = SearchIterations;
+			return EAeonixPathFindStatus::Complete;
+		}
+
+		const AeonixNode& currentNode = NavigationData.OctreeData.GetNode(CurrentLink);
+
+		TArray<AeonixLink>& neighbours = NeighbourScratch;
+		neighbours.Reset();
+
+		if (CurrentLink.GetLayerIndex() == 0 && currentNode.FirstChild.IsValid())
+		{
+			// Layer 0 node with leaf subdivision - use GetLeafNeighbours
+			// This returns ~6 neighbors (one per direction) instead of up to 96
+			// An empty leaf is expanded once as a whole, the same as a region, and steps out to one subnode per region it faces rather than all 16 per face
+			const bool bEmptyLeaf = ShouldCollapseEmptyLeaves() && NavigationData.OctreeData.GetLeafNode(currentNode.FirstChild.GetNodeIndex()).IsEmpty();
+			uint64 region = 0;
+			if ((ShouldExpandLeafRegions() || bEmptyLeaf) && !CloseLeafRegion(CurrentLink, region))
+			{
+				// Another subnode already expanded this whole region, so nothing new can be reached from here
+				Diagnostics.DuplicatePopCount++;
+				continue;
+			}
+
+			if (region)
+			{
+				GetLeafRegionNeighbours(CurrentLink, region, neighbours);
+			}
+			else if (Settings.bUseLeafJumpPointSearch && !ShouldFilterByClearance())
+			{
+				NavigationData.OctreeData.GetLeafJumpNeighbours(CurrentLink, GetGoalInLeaf(CurrentLink), neighbours);
+			}
+			else
+			{
+				NavigationData.OctreeData.GetLeafNeighbours(CurrentLink, neighbours);
+			}
+
+			if (bEmptyLeaf)
+			{
+				Diagnostics.EmptyLeafNeighbourCount++;
+			}
+			else
+			{
+				Diagnostics.NonEmptyLeafNeighbourCount++;
+			}
+		}
+		else
+		{
+			NavigationData.GetNeighbours(CurrentLink, neighbours);
+			Diagnostics.HigherLayerNeighbourCount++;
+
+			if (ShouldCollapseEmptyLeaves())
+			{
+				CollapseEmptyLeafNeighbours(neighbours);
+			}
+		}
+
+		if (ShouldFilterByClearance())
+		{
+			FilterByClearance(neighbours);
+		}
+
+		// Any-angle costs run from the assumed parent rather than the current link, so those go one at a time
+		if (Settings.bVectorizeNeighbourExpansion && !Settings.bUseAnyAnglePathfinding)
+		{
+			ExpandNeighbours(neighbours);
+		}
+		else
+		{
+			// Early filtering: skip neighbors already in closed set
+			for (const AeonixLink& neighbour : neighbours)
+			{
+				if (!ClosedSet.Contains(neighbour))
+				{
+					ProcessLink(neighbour);
+				}
+			}
+		}
+
+		// Track neighbor generation statistics
+		Diagnostics.TotalNeighborsGenerated += neighbours.Num();
+		Diagnostics.MaxNeighborsInSingleIteration = FMath::Max(Diagnostics.MaxNeighborsInSingleIteration, neighbours.Num());
+
+		// Periodic diagnostic logging every 100 iterations
+		if (SearchIterations > 0 && SearchIterations % 100 == 0)
+		{
+			FVector CurrentPos;
+			NavigationData.GetLinkPosition(CurrentLink, CurrentPos);
+			const float DistToGoal = FVector::Dist(CurrentPos, TargetPosition);
+
+			UE_LOG(LogAeonixNavigation, Verbose, TEXT("Iteration %d: Heap=%d, Unique=%d, Dups=%d, Neighbors=%d, MaxNeighbors=%d, DistToGoal=%.1f"),
+				SearchIterations, OpenHeap.Num(), Diagnostics.UniqueNodesProcessed.Num(), Diagnostics.DuplicatePopCount,
+				Diagnostics.TotalNeighborsGenerated, Diagnostics.MaxNeighborsInSingleIteration, DistToGoal);
+		}
+
+		SearchIterations++;
+
+		if (SearchIterations > Settings.MaxIterations)
+		{
+			const float Distance = FVector::Dist(StartPosition, TargetPosition);
+			FVector CurrentPos;
+			NavigationData.GetLinkPosition(CurrentLink, CurrentPos);
+			const float DistToGoal = FVector::Dist(CurrentPos, TargetPosition);
+
+			UE_LOG(LogAeonixNavigation, Warning, TEXT("Pathfinding aborted - hit iteration limit %i. Distance: %.2f units. Start: %s, Target: %s, StartLink: (L:%d N:%d S:%d), GoalLink: (L:%d N:%d S:%d), CurrentLink: (L:%d N:%d S:%d)"),
+				SearchIterations,
+				Distance,
+				*StartPosition.ToCompactString(),
+				*TargetPosition.ToCompactString(),
+				StartLink.GetLayerIndex(), StartLink.GetNodeIndex(), StartLink.GetSubnodeIndex(),
+				GoalLink.GetLayerIndex(), GoalLink.GetNodeIndex(), GoalLink.GetSubnodeIndex(),
+				CurrentLink.GetLayerIndex(), CurrentLink.GetNodeIndex(), CurrentLink.GetSubnodeIndex());
+
+			// Detailed diagnostic information
+			UE_LOG(LogAeonixNavigation, Warning, TEXT("  Diagnostics: HeapSize=%d, UniqueNodes=%d, DuplicatePops=%d, TotalNeighbors=%d, MaxNeighbors=%d, DistToGoal=%.1f"),
+				OpenHeap.Num(), Diagnostics.UniqueNodesProcessed.Num(), Diagnostics.DuplicatePopCount,
+				Diagnostics.TotalNeighborsGenerated, Diagnostics.MaxNeighborsInSingleIteration, DistToGoal);
+
+			// Calculate average neighbors per iteration
+			const float AvgNeighbors = SearchIterations > 0 ? static_cast<float>(Diagnostics.TotalNeighborsGenerated) / SearchIterations : 0.0f;
+			UE_LOG(LogAeonixNavigation, Warning, TEXT("  AvgNeighborsPerIteration=%.1f, DuplicatePopRate=%.1f%%"),
+				AvgNeighbors, SearchIterations > 0 ? (Diagnostics.DuplicatePopCount * 100.0f) / (SearchIterations + Diagnostics.DuplicatePopCount) : 0.0f);
+
+			// Report which neighbor generation paths were taken
+			UE_LOG(LogAeonixNavigation, Warning, TEXT("  NeighborGenPaths: EmptyLeaf=%d, NonEmptyLeaf=%d, HigherLayer=%d"),
+				Diagnostics.EmptyLeafNeighbourCount, Diagnostics.NonEmptyLeafNeighbourCount, Diagnostics.HigherLayerNeighbourCount);
+
+			// Populate failure info if requested
+			if (OutFailureInfo)
+			{
+				OutFailureInfo->bFailedDueToMaxIterations = true;
+				OutFailureInfo->StartPosition = StartPosition;
+				OutFailureInfo->TargetPosition = TargetPosition;
+				OutFailureInfo->StartLink = StartLink;
+				OutFailureInfo->GoalLink = GoalLink;
+				OutFailureInfo->LastProcessedLink = CurrentLink;
+				OutFailureInfo->IterationCount = SearchIterations;
+				OutFailureInfo->StraightLineDistance = Distance;
+			}
+
+			LastIterationCount = SearchIterations;
+
+			// Rather than waste the iterations, hand back the way to wherever got closest so the agent can make progress
+			if (Settings.bReturnPartialPath && BestPartialLink.IsValid() && !(BestPartialLink == StartLink))
+			{
+				FVector partialEnd;
+				NavigationData.GetLinkPosition(BestPartialLink, partialEnd);
+				GoalLink = BestPartialLink;
+				BuildPath(CameFrom, BestPartialLink, StartPosition, partialEnd, Path);
+				Path.SetIsPartial(true);
+
+				UE_LOG(LogAeonixNavigation, Log, TEXT("Returning partial path ending %.1f units from the target"), BestPartialDistance);
+				return EAeonixPathFindStatus::Partial;
+			}
+
+			return EAeonixPathFindStatus::Failed;
+		}
+	}
+
+	UE_LOG(LogAeonixNavigation, Display, TEXT("Pathfinding failed, iterations : %i"), SearchIterations);
+	LastIterationCount = SearchIterations;
+	return EAeonixPathFindStatus::Failed;
+}
+
+float AeonixPathFinder::CalculateHeuristic(const AeonixLink& aStart, const AeonixLink& aTarget, const AeonixLink& aParent)
+{
+	float totalScore = 0.0f;
+
+	FVector startPos, targetPos;
+	NavigationData.GetLinkPosition(aStart, startPos);
+	NavigationData.GetLinkPosition(aTarget, targetPos);
+
+	// The landmark bound is only worth having while it never overestimates, so none of the weights below apply to it
+	if (ShouldUseLandmarks())
+	{
+		return FMath::Max((startPos - targetPos).Size(), NavigationData.GetLandmarks().GetLowerBound(aStart, aTarget));
+	}
+
+	// 1. Euclidean distance component
+	if (Settings.HeuristicSettings.EuclideanWeight > 0.0f)
+	{
+		float euclideanDistance = (startPos - targetPos).Size();
+		totalScore += euclideanDistance * Settings.HeuristicSettings.EuclideanWeight;
+	}
+
+	// 2. Velocity component (requires valid parent)
+	if (Settings.HeuristicSettings.VelocityWeight > 0.0f && aParent.IsValid() && !(aParent == aStart))
+	{
+		// Get direction from parent to current node (incoming direction)
+		FVector incomingDirection = GetDirectionVector(aParent, aStart);
+
+		// Get direction from current node to target (desired direction)
+		FVector outgoingDirection = GetDirectionVector(aStart, aTarget);
+
+		// Calculate alignment using dot product (-1 to 1, where 1 = same direction)
+		float alignment = FVector::DotProduct(incomingDirection, outgoingDirection);
+
+		// Convert alignment to penalty (0 = same direction, 2 = opposite direction)
+		float directionPenalty = (1.0f - alignment);
+
+		// Apply velocity bias and weight
+		float baseDistance = (startPos - targetPos).Size();
+		float velocityPenalty = directionPenalty * Settings.HeuristicSettings.VelocityBias * baseDistance;
+		totalScore += velocityPenalty * Settings.HeuristicSettings.VelocityWeight;
+	}
+
+	// 3. Node size component (applies to all components)
+	if (Settings.HeuristicSettings.NodeSizeWeight > 0.0f)
+	{
+		// Higher layer index = larger voxel = should have lower score to be preferred
+		float nodeSizeMultiplier = (1.0f - (static_cast<float>(aTarget.GetLayerIndex()) / static_cast<float>(NavigationData.OctreeData.GetNumLayers())) * Settings.HeuristicSettings.NodeSizeWeight);
+		totalScore *= nodeSizeMultiplier;
+	}
+
+	// Apply global weight
+	totalScore *= Settings.HeuristicSettings.GlobalWeight;
+
+	return totalScore;
+}
+
+float AeonixPathFinder::CalculateGoalHeuristic(const AeonixLink& aLink, const AeonixLink& aParent)
+{
+	// The smallest of several admissible estimates is still admissible
+	float bestScore = FLT_MAX;
+	for (const AeonixLink& goal : GoalLinks)
+	{
+		bestScore = FMath::Min(bestScore, CalculateHeuristic(aLink, goal, aParent));
+	}
+	return bestScore;
+}
+
+AeonixLink AeonixPathFinder::GetGoalInLeaf(const AeonixLink& aLink) const
+{
+	// Jump point runs only stop for a goal in the same leaf, so that's the one that matters
+	for (const AeonixLink& goal : GoalLinks)
+	{
+		if (goal.GetLayerIndex() == 0 && goal.GetNodeIndex() == aLink.GetNodeIndex())
+		{
+			return goal;
+		}
+	}
+	return GoalLinks[0];
+}
+
+FVector AeonixPathFinder::GetDirectionVector(const AeonixLink& aStart, const AeonixLink& aTarget)
+{
+	FVector startPos, targetPos;
+	NavigationData.GetLinkPosition(aStart, startPos);
+	NavigationData.GetLinkPosition(aTarget, targetPos);
+
+	FVector direction = targetPos - startPos;
+	return direction.GetSafeNormal();
+}
+
+float AeonixPathFinder::GetCost(const AeonixLink& aStart, const AeonixLink& aTarget)
+{
+	float cost = 0.f;
+
+	// Unit cost implementation
+	if (Settings.bUseUnitCost)
+	{
+		cost = Settings.UnitCost;
+	}
+	else
+	{
+
+		FVector startPos(0.f), endPos(0.f);
+		const AeonixNode& startNode = NavigationData.OctreeData.GetNode(aStart);
+		const AeonixNode& endNode = NavigationData.OctreeData.GetNode(aTarget);
+		NavigationData.GetLinkPosition(aStart, startPos);
+		NavigationData.GetLinkPosition(aTarget, endPos);
+		cost = (startPos - endPos).Size();
+
+		// Validate distance for leaf-to-leaf transitions
+		if (aStart.GetLayerIndex() == 0 && aTarget.GetLayerIndex() == 0)
+		{
+			// Both are leaf nodes - check if they're navigating between what should be adjacent nodes
+			// Jumps within a single leaf can legitimately span several subnodes, so only check transitions between leaves
+			if (startNode.FirstChild.IsValid() && endNode.FirstChild.IsValid() && aStart.GetNodeIndex() != aTarget.GetNodeIndex())
+			{
+				// Normal leaf-to-leaf: navigating at sub-voxel level
+				// Leaf voxel size is 1/4 of the layer 0 voxel size
+				float leafVoxelSize = NavigationData.GetVoxelSize(0) * 0.25f;
+				// Maximum distance would be diagonal between adjacent leaf voxels
+				float maxExpectedDistance = leafVoxelSize * 2.0f; // Allow for diagonal neighbors
+
+				if (cost > maxExpectedDistance)
+				{
+					UE_LOG(LogAeonixNavigation, Error, TEXT("WARNING: Pathfinder attempting to navigate between distant leaf nodes! Distance: %.2f, Max Expected: %.2f"),
+						cost, maxExpectedDistance);
+					UE_LOG(LogAeonixNavigation, Error, TEXT("  Start Position: %s (Layer: %d, Node: %d, Subnode: %d)"),
+						*startPos.ToString(), aStart.GetLayerIndex(), aStart.GetNodeIndex(), aStart.GetSubnodeIndex());
+					UE_LOG(LogAeonixNavigation, Error, TEXT("  End Position: %s (Layer: %d, Node: %d, Subnode: %d)"),
+						*endPos.ToString(), aTarget.GetLayerIndex(), aTarget.GetNodeIndex(), aTarget.GetSubnodeIndex());
+				}
+			}
+		}
+	}
+
+	if (ShouldWeightVisibility())
+	{
+		cost *= GetVisibilityCostScale(aTarget);
+	}
+
+	return cost;
+}
+
+void AeonixPathFinder::ProcessLink(const AeonixLink& aNeighbour)
+{
+	if (aNeighbour.IsValid())
+	{
+		if (ClosedSet.Contains(aNeighbour))
+			return;
+
+		// Lazy Theta* optimistically connects to our parent, line of sight is only checked once the neighbour is expanded
+		const AeonixLink sourceLink = Settings.bUseAnyAnglePathfinding ? CameFrom[CurrentLink] : CurrentLink;
+
+		float t_gScore = FLT_MAX;
+		if (Settings.bUseAnyAnglePathfinding)
+			t_gScore = GScore[sourceLink] + FVector::Dist(GetSearchPosition(sourceLink), GetSearchPosition(aNeighbour));
+		else if (GScore.Contains(CurrentLink))
+			t_gScore = GScore[CurrentLink] + GetCost(CurrentLink, aNeighbour);
+		else
+			GScore.Add(CurrentLink, FLT_MAX);
+
+		if (t_gScore >= (GScore.Contains(aNeighbour) ? GScore[aNeighbour] : FLT_MAX))
+			return;
+
+		CameFrom.Add(aNeighbour, sourceLink);
+		GScore.Add(aNeighbour, t_gScore);
+
+		if (Settings.bUseAnyAnglePathfinding)
+		{
+			GridParent.Add(aNeighbour, CurrentLink);
+		}
+
+		// Calculate heuristic using unified function with parent information when available
+		AeonixLink parentLink = CameFrom.Contains(CurrentLink) ? CameFrom[CurrentLink] : AeonixLink();
+		float heuristicScore = CalculateGoalHeuristic(aNeighbour, parentLink);
+
+		FScore.Add(aNeighbour, GScore[aNeighbour] + heuristicScore);
+
+		// Only add to heap if this is a NEW node (prevents 80%+ duplicate waste)
+		// This eliminates the massive duplicate pop problem observed in stress testing
+		if (!OpenSetLookup.Contains(aNeighbour))
+		{
+			OpenSetLookup.Add(aNeighbour);
+
+			// Push to heap with calculated FScore
+			FScoreHeapPredicate HeapPredicate(FScore);
+			OpenHeap.HeapPush(aNeighbour, HeapPredicate);
+
+			if (Settings.bDebugOpenNodes)
+			{
+				FVector pos;
+				NavigationData.GetLinkPosition(aNeighbour, pos);
+				Settings.DebugPoints.Add(pos);
+			}
+		}
+	}
+}
+
+void AeonixPathFinder::FNeighbourLanes::SetNum(int32 aNumLanes)
+{
+	X.SetNumUninitialized(aNumLanes, EAllowShrinking::No);
+	Y.SetNumUninitialized(aNumLanes, EAllowShrinking::No);
+	Z.SetNumUninitialized(aNumLanes, EAllowShrinking::No);
+	VelocityMask.SetNumUninitialized(aNumLanes, EAllowShrinking::No);
+	Cost.SetNumUninitialized(aNumLanes, EAllowShrinking::No);
+	GoalDistance.SetNumUninitialized(aNumLanes, EAllowShrinking::No);
+	Heuristic.SetNumUninitialized(aNumLanes, EAllowShrinking::No);
+}
+
+void AeonixPathFinder::ExpandNeighbours(const TArray<AeonixLink>& aNeighbours)
+{
+	const float* currentGScore = GScore.Find(CurrentLink);
+	if (!currentGScore)
+	{
+		// As ProcessLink, nothing can improve on a link that was never scored
+		GScore.Add(CurrentLink, FLT_MAX);
+		return;
+	}
+	const float currentG = *currentGScore;
+
+	FNeighbourLanes& lanes = NeighbourLanes;
+	lanes.Links.Reset();
+	for (const AeonixLink& neighbour : aNeighbours)
+	{
+		if (neighbour.IsValid() && !ClosedSet.Contains(neighbour))
+		{
+			lanes.Links.Add(neighbour);
+		}
+	}
+
+	const int32 numLinks = lanes.Links.Num();
+	if (numLinks == 0)
+	{
+		return;
+	}
+
+	const int32 numLanes = Align(numLinks, 4);
+	lanes.SetNum(numLanes);
+
+	FVector currentPos;
+	NavigationData.GetLinkPosition(CurrentLink, currentPos);
+
+	const FAeonixHeuristicSettings& heuristic = Settings.HeuristicSettings;
+	const AeonixLink* parentLink = CameFrom.Find(CurrentLink);
+	const bool bUseVelocity = heuristic.VelocityWeight > 0.0f && parentLink && parentLink->IsValid();
+	FVector parentPos = currentPos;
+	if (bUseVelocity)
+	{
+		NavigationData.GetLinkPosition(*parentLink, parentPos);
+	}
+
+	// Gather, padding lanes sit on the current link and are never read back
+	for (int32 i = 0; i < numLanes; i++)
+	{
+		FVector position = currentPos;
+		float velocityMask = 0.0f;
+		if (i < numLinks)
+		{
+			NavigationData.GetLinkPosition(lanes.Links[i], position);
+			velocityMask = bUseVelocity && !(*parentLink == lanes.Links[i]) ? 1.0f : 0.0f;
+		}
+		lanes.X[i] = position.X;
+		lanes.Y[i] = position.Y;
+		lanes.Z[i] = position.Z;
+		lanes.VelocityMask[i] = velocityMask;
+		lanes.Heuristic[i] = FLT_MAX;
+	}
+
+	// Costs, the distance from the current link or the unit cost
+	if (Settings.bUseUnitCost)
+	{
+		for (int32 i = 0; i < numLanes; i++)
+		{
+			lanes.Cost[i] = Settings.UnitCost;
+		}
+	}
+	else
+	{
+		const VectorRegister4Float currentX = VectorSetFloat1(currentPos.X);
+		const VectorRegister4Float currentY = VectorSetFloat1(currentPos.Y);
+		const VectorRegister4Float currentZ = VectorSetFloat1(currentPos.Z);
+		for (int32 i = 0; i < numLanes; i += 4)
+		{
+			const VectorRegister4Float dx = VectorSubtract(VectorLoadAligned(&lanes.X[i]), currentX);
+			const VectorRegister4Float dy = VectorSubtract(VectorLoadAligned(&lanes.Y[i]), currentY);
+			const VectorRegister4Float dz = VectorSubtract(VectorLoadAligned(&lanes.Z[i]), currentZ);
+			const VectorRegister4Float distSq = VectorMultiplyAdd(dx, dx, VectorMultiplyAdd(dy, dy, VectorMultiply(dz, dz)));
+			VectorStoreAligned(VectorSqrt(distSq), &lanes.Cost[i]);
+		}
+	}
+
+	// The field is a hash lookup per neighbour, so it stays scalar
+	if (ShouldWeightVisibility())
+	{
+		for (int32 i = 0; i < numLinks; i++)
+		{
+			lanes.Cost[i] *= GetVisibilityCostScale(lanes.Links[i]);
+		}
+	}
+
+	// Heuristics, CalculateGoalHeuristic for four neighbours at a time
+	const bool bUseLandmarks = ShouldUseLandmarks();
+	const float numLayers = static_cast<float>(NavigationData.OctreeData.GetNumLayers());
+	const VectorRegister4Float zero = VectorZeroFloat();
+	const VectorRegister4Float one = VectorOneFloat();
+	const VectorRegister4Float smallNumber = VectorSetFloat1(SMALL_NUMBER);
+	const VectorRegister4Float euclideanWeight = VectorSetFloat1(FMath::Max(heuristic.EuclideanWeight, 0.0f));
+	const VectorRegister4Float velocityScale = VectorSetFloat1(heuristic.VelocityBias * heuristic.VelocityWeight);
+	const VectorRegister4Float parentX = VectorSetFloat1(parentPos.X);
+	const VectorRegister4Float parentY = VectorSetFloat1(parentPos.Y);
+	const VectorRegister4Float parentZ = VectorSetFloat1(parentPos.Z);
+
+	for (int32 goalIndex = 0; goalIndex < GoalLinks.Num(); goalIndex++)
+	{
+		const FVector& goalPos = GoalLinkPositions[goalIndex];
+		const VectorRegister4Float goalX = VectorSetFloat1(goalPos.X);
+		const VectorRegister4Float goalY = VectorSetFloat1(goalPos.Y);
+		const VectorRegister4Float goalZ = VectorSetFloat1(goalPos.Z);
+
+		// The node size multiplier goes by the goal's layer, and the global weight applies to everything
+		float goalScale = heuristic.GlobalWeight;
+		if (heuristic.NodeSizeWeight > 0.0f)
+		{
+			goalScale *= 1.0f - (static_cast<float>(GoalLinks[goalIndex].GetLayerIndex()) / numLayers) * heuristic.NodeSizeWeight;
+		}
+		const VectorRegister4Float goalScaleLanes = VectorSetFloat1(goalScale);
+
+		for (int32 i = 0; i < numLanes; i += 4)
+		{
+			const VectorRegister4Float dx = VectorSubtract(goalX, VectorLoadAligned(&lanes.X[i]));
+			const VectorRegister4Float dy = VectorSubtract(goalY, VectorLoadAligned(&lanes.Y[i]));
+			const VectorRegister4Float dz = VectorSubtract(goalZ, VectorLoadAligned(&lanes.Z[i]));
+			const VectorRegister4Float distSq = VectorMultiplyAdd(dx, dx, VectorMultiplyAdd(dy, dy, VectorMultiply(dz, dz)));
+			VectorStoreAligned(VectorSqrt(distSq), &lanes.GoalDistance[i]);
+		}
+
+		// The landmark bound is a table lookup per neighbour, so it stays scalar. Unweighted, as in CalculateHeuristic
+		if (bUseLandmarks)
+		{
+			for (int32 i = 0; i < numLinks; i++)
+			{
+				const float bound = FMath::Max(lanes.GoalDistance[i], NavigationData.GetLandmarks().GetLowerBound(lanes.Links[i], GoalLinks[goalIndex]));
+				lanes.Heuristic[i] = FMath::Min(lanes.Heuristic[i], bound);
+			}
+			continue;
+		}
+
+		for (int32 i = 0; i < numLanes; i += 4)
+		{
+			const VectorRegister4Float x = VectorLoadAligned(&lanes.X[i]);
+			const VectorRegister4Float y = VectorLoadAligned(&lanes.Y[i]);
+			const VectorRegister4Float z = VectorLoadAligned(&lanes.Z[i]);
+
+			VectorRegister4Float score = VectorMultiply(VectorLoadAligned(&lanes.GoalDistance[i]), euclideanWeight);
+
+			if (bUseVelocity)
+			{
+				// Alignment of the incoming direction, parent to neighbour, with the outgoing one, neighbour to goal
+				const VectorRegister4Float inX = VectorSubtract(x, parentX);
+				const VectorRegister4Float inY = VectorSubtract(y, parentY);
+				const VectorRegister4Float inZ = VectorSubtract(z, parentZ);
+				const VectorRegister4Float outX = VectorSubtract(goalX, x);
+				const VectorRegister4Float outY = VectorSubtract(goalY, y);
+				const VectorRegister4Float outZ = VectorSubtract(goalZ, z);
+
+				const VectorRegister4Float inLengthSq = VectorMultiplyAdd(inX, inX, VectorMultiplyAdd(inY, inY, VectorMultiply(inZ, inZ)));
+				const VectorRegister4Float outLengthSq = VectorMultiplyAdd(outX, outX, VectorMultiplyAdd(outY, outY, VectorMultiply(outZ, outZ)));
+				const VectorRegister4Float dot = VectorMultiplyAdd(inX, outX, VectorMultiplyAdd(inY, outY, VectorMultiply(inZ, outZ)));
+				const VectorRegister4Float outLength = VectorSqrt(outLengthSq);
+
+				// GetSafeNormal gives zero for tiny vectors, which makes the alignment zero
+				const VectorRegister4Float bothValid = VectorBitwiseAnd(VectorCompareGT(inLengthSq, smallNumber), VectorCompareGT(outLengthSq, smallNumber));
+				const VectorRegister4Float alignment = VectorSelect(bothValid, VectorDivide(dot, VectorMultiply(VectorSqrt(inLengthSq), outLength)), zero);
+
+				// (1 - alignment) * bias * distance, with the distance being the plain straight line to the goal
+				const VectorRegister4Float penalty = VectorMultiply(VectorMultiply(VectorSubtract(one, alignment), outLength), velocityScale);
+				score = VectorMultiplyAdd(penalty, VectorLoadAligned(&lanes.VelocityMask[i]), score);
+			}
+
+			score = VectorMultiply(score, goalScaleLanes);
+			VectorStoreAligned(VectorMin(score, VectorLoadAligned(&lanes.Heuristic[i])), &lanes.Heuristic[i]);
+		}
+	}
+
+	// Push the improved neighbours, in the order they came so ties break as they do in ProcessLink
+	FScoreHeapPredicate HeapPredicate(FScore);
+	for (int32 i = 0; i < numLinks; i++)
+	{
+		const AeonixLink& neighbour = lanes.Links[i];
+		const float gScore = currentG + lanes.Cost[i];
+
+		const float* existingGScore = GScore.Find(neighbour);
+		if (existingGScore && gScore >= *existingGScore)
+		{
+			continue;
+		}
+
+		CameFrom.Add(neighbour, CurrentLink);
+		GScore.Add(neighbour, gScore);
+		FScore.Add(neighbour, gScore + lanes.Heuristic[i]);
+
+		if (!OpenSetLookup.Contains(neighbour))
+		{
+			OpenSetLookup.Add(neighbour);
+			OpenHeap.HeapPush(neighbour, HeapPredicate);
+
+			if (Settings.bDebugOpenNodes)
+			{
+				FVector pos;
+				NavigationData.GetLinkPosition(neighbour, pos);
+				Settings.DebugPoints.Add(pos);
+			}
+		}
+	}
+}
+
+void AeonixPathFinder::UpdateBestPartialLink()
+{
+	const FVector position = GetSearchPosition(CurrentLink);
+
+	float distance = FLT_MAX;
+	for (const FVector& goalPosition : GoalPositions)
+	{
+		distance = FMath::Min(distance, FVector::DistSquared(position, goalPosition));
+	}
+	distance = FMath::Sqrt(distance);
+
+	if (distance < BestPartialDistance)
+	{
+		BestPartialDistance = distance;
+		BestPartialLink = CurrentLink;
+	}
+}
+
+FVector AeonixPathFinder::GetSearchPosition(const AeonixLink& aLink) const
+{
+	if (aLink == StartLink)
+	{
+		return StartPosition;
+	}
+	const int32 goalIndex = GoalLinks.Find(aLink);
+	if (goalIndex != INDEX_NONE)
+	{
+		return GoalPositions[goalIndex];
+	}
+
+	FVector position;
+	NavigationData.GetLinkPosition(aLink, position);
+	return position;
+}
+
+void AeonixPathFinder::ValidateAnyAngleParent()
+{
+	const AeonixLink* gridParent = GridParent.Find(CurrentLink);
+	if (!gridParent)
+	{
+		// The start link has no parent to validate
+		return;
+	}
+
+	const AeonixLink& parentLink = CameFrom[CurrentLink];
+	if (parentLink == *gridParent || NavigationData.IsSegmentClear(GetSearchPosition(parentLink), GetSearchPosition(CurrentLink)))
+	{
+		return;
+	}
+
+	// No line of sight, so take the cheapest way in from an expanded neighbour. The node that generated us is one of them, but not always the best,
+	// and a neighbour is always in sight. The neighbours are read again straight after for the expansion, so the scratch array is free
+	const FVector currentPos = GetSearchPosition(CurrentLink);
+	AeonixLink bestParent = *gridParent;
+	float bestG = GScore[*gridParent] + FVector::Dist(GetSearchPosition(*gridParent), currentPos);
+
+	GetSearchNeighbours(CurrentLink, NeighbourScratch);
+	for (const AeonixLink& neighbour : NeighbourScratch)
+	{
+		if (!ClosedSet.Contains(neighbour))
+		{
+			continue;
+		}
+
+		const float neighbourG = GScore.FindRef(neighbour, FLT_MAX) + FVector::Dist(GetSearchPosition(neighbour), currentPos);
+		if (neighbourG < bestG)
+		{
+			bestG = neighbourG;
+			bestParent = neighbour;
+		}
+	}
+
+	CameFrom.Add(CurrentLink, bestParent);
+	GScore.Add(CurrentLink, bestG);
+}
+
+void AeonixPathFinder::GetSearchNeighbours(const AeonixLink& aLink, TArray<AeonixLink>& oNeighbours) const
+{
+	oNeighbours.Reset();
+
+	const AeonixNode& node = NavigationData.OctreeData.GetNode(aLink);
+	if (aLink.GetLayerIndex() == 0 && node.FirstChild.IsValid())
+	{
+		NavigationData.OctreeData.GetLeafNeighbours(aLink, oNeighbours);
+	}
+	else
+	{
+		NavigationData.GetNeighbours(aLink, oNeighbours);
 	}
 
-	// 3. Node size component (applies to all components)
-	if (Settings.HeuristicSettings.NodeSizeWeight > 0.0f)
+	if (ShouldFilterByClearance())
 	{
-		// Higher layer index = larger voxel = should have lower score to be preferred
-		float nodeSizeMultiplier = (1.0f - (static_cast<float>(aTarget.GetLayerIndex()) / static_cast<float>(NavigationData.OctreeData.GetNumLayers())) * Settings.HeuristicSettings.NodeSizeWeight);
-		totalScore *= nodeSizeMultiplier;
+		FilterByClearance(oNeighbours);
 	}
+}
 
-	// Apply global weight
-	totalScore *= Settings.HeuristicSettings.GlobalWeight;
+float AeonixPathFinder::GetVisibilityCostScale(const AeonixLink& aLink) const
+{
+	return Settings.VisibilityField->GetLinkVisibility(aLink) == EAeonixVisibility::Visible ? Settings.VisibleCostMultiplier : 1.f;
+}
 
-	return totalScore;
+void AeonixPathFinder::FilterByClearance(TArray<AeonixLink>& ioNeighbours) const
+{
+	ioNeighbours.RemoveAll([this](const AeonixLink& aNeighbour)
+	{
+		return NavigationData.GetLinkClearance(aNeighbour) < Settings.AgentRadius && !GoalLinks.Contains(aNeighbour);
+	});
 }
 
+bool AeonixPathFinder::IsLinkBlocked(const AeonixLink& aLink) const
+{
+	if (aLink.GetLayerIndex() != 0)
+	{
+		return false;
+	}
 
-FVector AeonixPathFinder::GetDirectionVector(const AeonixLink& aStart, const AeonixLink& aTarget)
+	const AeonixNode& node = NavigationData.OctreeData.GetNode(aLink);
+	return node.FirstChild.IsValid() && NavigationData.OctreeData.GetLeafNode(node.FirstChild.GetNodeIndex()).GetNode(aLink.GetSubnodeIndex());
+}
+
+bool AeonixPathFinder::CloseLeafRegion(const AeonixLink& aLink, uint64& oRegion)
 {
-	FVector startPos, targetPos;
-	NavigationData.GetLinkPosition(aStart, startPos);
-	NavigationData.GetLinkPosition(aTarget, targetPos);
+	const AeonixNode& node = NavigationData.OctreeData.GetNode(aLink);
+	oRegion = NavigationData.GetLeafRegionMask(node.FirstChild.GetNodeIndex(), aLink.GetSubnodeIndex());
+	if (!oRegion)
+	{
+		return true;
+	}
 
-	FVector direction = targetPos - startPos;
-	return direction.GetSafeNormal();
+	bool bAlreadyClosed = false;
+	ClosedLeafRegions.Add(AeonixLink(0, aLink.GetNodeIndex(), static_cast<uint8>(FMath::CountTrailingZeros64(oRegion))), &bAlreadyClosed);
+	return !bAlreadyClosed;
 }
 
-float AeonixPathFinder::GetCost(const AeonixLink& aStart, const AeonixLink& aTarget)
+void AeonixPathFinder::GetLeafRegionNeighbours(const AeonixLink& aLink, uint64 aRegion, TArray<AeonixLink>& oNeighbours) const
 {
-	float cost = 0.f;
+	const FAeonixOctreeData& octreeData = NavigationData.OctreeData;
+	const AeonixNode& node = octreeData.GetNode(aLink);
 
-	// Unit cost implementation
-	if (Settings.bUseUnitCost)
+	// Goals inside the region are stepped to directly, the subnodes between are filled in when the path is built
+	for (const AeonixLink& goal : GoalLinks)
 	{
-		cost = Settings.UnitCost;
+		if (goal.GetLayerIndex() == 0 && goal.GetNodeIndex() == aLink.GetNodeIndex() && !(goal == aLink) && (aRegion & (1ull << goal.GetSubnodeIndex())))
+		{
+			oNeighbours.Add(goal);
+		}
 	}
-	else
+
+	uint_fast32_t x = 0, y = 0, z = 0;
+	morton3D_64_decode(aLink.GetSubnodeIndex(), x, y, z);
+	const int32 coords[3] = {static_cast<int32>(x), static_cast<int32>(y), static_cast<int32>(z)};
+
+	TArray<AeonixLink> leafNeighbours;
+	for (int32 direction = 0; direction < 6; direction++)
 	{
+		const uint64 regionFace = aRegion & AeonixLeafNode::GetFaceMask(direction);
+		const AeonixLink& neighbourLink = node.myNeighbours[direction];
+		if (!regionFace || !neighbourLink.IsValid())
+		{
+			continue;
+		}
 
-		FVector startPos(0.f), endPos(0.f);
-		const AeonixNode& startNode = NavigationData.OctreeData.GetNode(aStart);
-		const AeonixNode& endNode = NavigationData.OctreeData.GetNode(aTarget);
-		NavigationData.GetLinkPosition(aStart, startPos);
-		NavigationData.GetLinkPosition(aTarget, endPos);
-		cost = (startPos - endPos).Size();
+		const AeonixNode& neighbourNode = octreeData.GetNode(neighbourLink);
+		if (!neighbourNode.HasChildren())
+		{
+			oNeighbours.Add(neighbourLink);
+			continue;
+		}
 
-		// Validate distance for leaf-to-leaf transitions
-		if (aStart.GetLayerIndex() == 0 && aTarget.GetLayerIndex() == 0)
+		if (neighbourLink.GetLayerIndex() != 0)
 		{
-			// Both are leaf nodes - check if they're navigating between what should be adjacent nodes
-			if (startNode.FirstChild.IsValid() && endNode.FirstChild.IsValid())
+			// Subdivided space above layer 0, fall back to asking for each face subnode's neighbours
+			for (uint64 bits = regionFace; bits; bits &= bits - 1)
 			{
-				// Normal leaf-to-leaf: navigating at sub-voxel level
-				// Leaf voxel size is 1/4 of the layer 0 voxel size
-				float leafVoxelSize = NavigationData.GetVoxelSize(0) * 0.25f;
-				// Maximum distance would be diagonal between adjacent leaf voxels
-				float maxExpectedDistance = leafVoxelSize * 2.0f; // Allow for diagonal neighbors
+				leafNeighbours.Reset();
+				octreeData.GetLeafNeighbours(AeonixLink(0, aLink.GetNodeIndex(), static_cast<uint8>(FMath::CountTrailingZeros64(bits))), leafNeighbours);
+				for (const AeonixLink& leafNeighbour : leafNeighbours)
+				{
+					if (leafNeighbour.GetLayerIndex() != 0 || leafNeighbour.GetNodeIndex() != aLink.GetNodeIndex())
+					{
+						oNeighbours.AddUnique(leafNeighbour);
+					}
+				}
+			}
+			continue;
+		}
 
-				if (cost > maxExpectedDistance)
+		// Move our face onto the opposite face of the neighbouring leaf, and keep the subnodes there that are free
+		const int32 axis = direction / 2;
+		const int32 shift = 9 << axis;
+		const nodeindex_t neighbourLeaf = neighbourNode.FirstChild.GetNodeIndex();
+		uint64 open = ((direction & 1) ? regionFace << shift : regionFace >> shift) & ~static_cast<uint64>(octreeData.GetLeafNode(neighbourLeaf).VoxelGrid);
+
+		// Enter each region of the neighbouring leaf once, at the subnode nearest the one this region was entered at
+		while (open)
+		{
+			const uint64 entries = open & NavigationData.GetLeafRegionMask(neighbourLeaf, static_cast<subnodeindex_t>(FMath::CountTrailingZeros64(open)));
+			open &= ~entries;
+
+			int32 bestSubnode = INDEX_NONE;
+			int32 bestDistance = MAX_int32;
+			for (uint64 bits = entries; bits; bits &= bits - 1)
+			{
+				const int32 subnode = FMath::CountTrailingZeros64(bits);
+				uint_fast32_t eX = 0, eY = 0, eZ = 0;
+				morton3D_64_decode(subnode, eX, eY, eZ);
+				int32 delta[3] = {static_cast<int32>(eX) - coords[0], static_cast<int32>(eY) - coords[1], static_cast<int32>(eZ) - coords[2]};
+				delta[axis] += (direction & 1) ? -4 : 4;
+
+				const int32 distance = delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+				if (distance < bestDistance)
 				{
-					UE_LOG(LogAeonixNavigation, Error, TEXT("WARNING: Pathfinder attempting to navigate between distant leaf nodes! Distance: %.2f, Max Expected: %.2f"),
-						cost, maxExpectedDistance);
-					UE_LOG(LogAeonixNavigation, Error, TEXT("  Start Position: %s (Layer: %d, Node: %d, Subnode: %d)"),
-						*startPos.ToString(), aStart.GetLayerIndex(), aStart.GetNodeIndex(), aStart.GetSubnodeIndex());
-					UE_LOG(LogAeonixNavigation, Error, TEXT("  End Position: %s (Layer: %d, Node: %d, Subnode: %d)"),
-						*endPos.ToString(), aTarget.GetLayerIndex(), aTarget.GetNodeIndex(), aTarget.GetSubnodeIndex());
+					bestDistance = distance;
+					bestSubnode = subnode;
 				}
 			}
+
+			if (bestSubnode != INDEX_NONE)
+			{
+				oNeighbours.Emplace(0, neighbourLeaf, static_cast<uint8>(bestSubnode));
+			}
 		}
 	}
+}
 
-	return cost;
+void AeonixPathFinder::CollapseEmptyLeafNeighbours(TArray<AeonixLink>& ioNeighbours) const
+{
+	const FAeonixOctreeData& octreeData = NavigationData.OctreeData;
+	const FVector currentPosition = GetSearchPosition(CurrentLink);
+
+	// Node index of each empty leaf seen so far, with the index of its kept entry and how far that is from us
+	TArray<TPair<uint_fast32_t, int32>, TInlineAllocator<8>> emptyLeafEntries;
+	TArray<float, TInlineAllocator<8>> entryDistances;
+
+	int32 numKept = 0;
+	for (int32 i = 0; i < ioNeighbours.Num(); i++)
+	{
+		const AeonixLink neighbour = ioNeighbours[i];
+		const AeonixNode& node = octreeData.GetNode(neighbour);
+		if (neighbour.GetLayerIndex() != 0 || !node.HasChildren() || !octreeData.GetLeafNode(node.FirstChild.GetNodeIndex()).IsEmpty() || GoalLinks.Contains(neighbour))
+		{
+			ioNeighbours[numKept++] = neighbour;
+			continue;
+		}
+
+		FVector position;
+		NavigationData.GetLinkPosition(neighbour, position);
+		const float distance = FVector::DistSquared(position, currentPosition);
+
+		const int32 entry = emptyLeafEntries.IndexOfByPredicate([&neighbour](const TPair<uint_fast32_t, int32>& aEntry) { return aEntry.Key == neighbour.GetNodeIndex(); });
+		if (entry == INDEX_NONE)
+		{
+			emptyLeafEntries.Emplace(neighbour.GetNodeIndex(), numKept);
+			entryDistances.Add(distance);
+			ioNeighbours[numKept++] = neighbour;
+		}
+		else if (distance < entryDistances[entry])
+		{
+			// Enter at the facing subnode nearest us, the leaf is crossed as a whole from there
+			entryDistances[entry] = distance;
+			ioNeighbours[emptyLeafEntries[entry].Value] = neighbour;
+		}
+	}
+
+	ioNeighbours.SetNum(numKept, EAllowShrinking::No);
 }
 
-void AeonixPathFinder::ProcessLink(const AeonixLink& aNeighbour)
+void AeonixPathFinder::ResolveLeafRegionLinks(const TArray<AeonixLink>& aLinks, TArray<AeonixLink>& oLinks) const
 {
-	if (aNeighbour.IsValid())
+	const FAeonixOctreeData& octreeData = NavigationData.OctreeData;
+
+	uint64 leafShell = 0;
+	for (int32 direction = 0; direction < 6; direction++)
 	{
-		if (ClosedSet.Contains(aNeighbour))
-			return;
+		leafShell |= AeonixLeafNode::GetFaceMask(direction);
+	}
 
-		float t_gScore = FLT_MAX;
-		if (GScore.Contains(CurrentLink))
-			t_gScore = GScore[CurrentLink] + GetCost(CurrentLink, aNeighbour);
-		else
-			GScore.Add(CurrentLink, FLT_MAX);
+	TArray<AeonixLink> leafNeighbours;
+	TArray<uint64, TInlineAllocator<8>> rings;
+	TArray<subnodeindex_t, TInlineAllocator<8>> route;
 
-		if (t_gScore >= (GScore.Contains(aNeighbour) ? GScore[aNeighbour] : FLT_MAX))
-			return;
+	oLinks.Reset();
+	for (int32 i = 0; i < aLinks.Num(); i++)
+	{
+		const AeonixLink& link = aLinks[i];
+		oLinks.Add(link);
 
-		CameFrom.Add(aNeighbour, CurrentLink);
-		GScore.Add(aNeighbour, t_gScore);
+		if (i + 1 == aLinks.Num() || link.GetLayerIndex() != 0 || !octreeData.GetNode(link).HasChildren())
+		{
+			continue;
+		}
 
-		// Calculate heuristic using unified function with parent information when available
-		AeonixLink parentLink = CameFrom.Contains(CurrentLink) ? CameFrom[CurrentLink] : AeonixLink();
-		float heuristicScore = CalculateHeuristic(aNeighbour, GoalLink, parentLink);
+		const AeonixLink& next = aLinks[i + 1];
+		const uint64 region = NavigationData.GetLeafRegionMask(octreeData.GetNode(link).FirstChild.GetNodeIndex(), link.GetSubnodeIndex());
+		const bool bEmptyLeaf = region == MAX_uint64;
 
-		FScore.Add(aNeighbour, GScore[aNeighbour] + heuristicScore);
+		// Without region expansion only empty leaves are crossed in one step
+		if (!bEmptyLeaf && !ShouldExpandLeafRegions())
+		{
+			continue;
+		}
 
-		// Only add to heap if this is a NEW node (prevents 80%+ duplicate waste)
-		// This eliminates the massive duplicate pop problem observed in stress testing
-		if (!OpenSetLookup.Contains(aNeighbour))
+		// Subnodes of the region the next link is one step from
+		uint64 exits = 0;
+		if (next.GetLayerIndex() == 0 && next.GetNodeIndex() == link.GetNodeIndex())
 		{
-			OpenSetLookup.Add(aNeighbour);
+			exits = region & (1ull << next.GetSubnodeIndex());
+		}
+		else
+		{
+			for (uint64 bits = region & leafShell; bits; bits &= bits - 1)
+			{
+				const subnodeindex_t subnode = static_cast<subnodeindex_t>(FMath::CountTrailingZeros64(bits));
+				leafNeighbours.Reset();
+				octreeData.GetLeafNeighbours(AeonixLink(0, link.GetNodeIndex(), subnode), leafNeighbours);
+				if (leafNeighbours.Contains(next))
+				{
+					exits |= 1ull << subnode;
+				}
+			}
+		}
 
-			// Push to heap with calculated FScore
-			FScoreHeapPredicate HeapPredicate(FScore);
-			OpenHeap.HeapPush(aNeighbour, HeapPredicate);
+		const uint64 entry = 1ull << link.GetSubnodeIndex();
+		if (!exits || (exits & entry))
+		{
+			continue;
+		}
 
-			if (Settings.bDebugOpenNodes)
+		// An empty leaf is convex, so heading straight for the exit never clips anything
+		if (bEmptyLeaf)
+		{
+			const AeonixLink exitLink(0, link.GetNodeIndex(), static_cast<uint8>(FMath::CountTrailingZeros64(exits)));
+			if (!(exitLink == next))
 			{
-				FVector pos;
-				NavigationData.GetLinkPosition(aNeighbour, pos);
-				Settings.DebugPoints.Add(pos);
+				oLinks.Add(exitLink);
+			}
+			continue;
+		}
+
+		// Breadth first rings out from the entry subnode, until one reaches an exit
+		rings.Reset();
+		rings.Add(entry);
+		uint64 visited = entry;
+		while (!(rings.Last() & exits))
+		{
+			const uint64 ring = AeonixLeafNode::DilateMask(rings.Last()) & region & ~visited;
+			if (!ring)
+			{
+				break;
+			}
+			visited |= ring;
+			rings.Add(ring);
+		}
+
+		if (!(rings.Last() & exits))
+		{
+			continue;
+		}
+
+		// Walk back in through the rings, each step to a subnode beside the last
+		route.Reset();
+		uint64 step = rings.Last() & exits;
+		step &= ~step + 1;
+		for (int32 ring = rings.Num() - 1; ring > 0; ring--)
+		{
+			route.Add(static_cast<subnodeindex_t>(FMath::CountTrailingZeros64(step)));
+			const uint64 previous = AeonixLeafNode::DilateMask(step) & rings[ring - 1];
+			step = previous & (~previous + 1);
+		}
+
+		for (int32 r = route.Num() - 1; r >= 0; r--)
+		{
+			const AeonixLink subnodeLink(0, link.GetNodeIndex(), route[r]);
+			if (!(subnodeLink == next))
+			{
+				oLinks.Add(subnodeLink);
 			}
 		}
 	}
 }
 
+void AeonixPathFinder::BuildPathFromLinks(const TArray<AeonixLink>& aLinks, const FVector& aStartPos, const FVector& aTargetPos, FAeonixNavigationPath& oPath)
+{
+	// FinalizePath takes its points target first
+	TArray<FAeonixPathPoint> points;
+	for (int32 i = aLinks.Num() - 1; i >= 0; --i)
+	{
+		FAeonixPathPoint& point = points.Emplace_GetRef();
+		NavigationData.GetLinkPosition(aLinks[i], point.Position);
+		point.Layer = GetPathPointLayer(aLinks[i]);
+	}
+
+	points[0].Position = aTargetPos;
+	if (points.Num() > 1)
+	{
+		points.Last().Position = aStartPos;
+	}
+	else
+	{
+		points.Emplace(aStartPos, aLinks[0].GetLayerIndex());
+	}
+
+	FinalizePath(points, true, oPath);
+}
+
+int32 AeonixPathFinder::GetPathPointLayer(const AeonixLink& aLink) const
+{
+	// Layer 0 node with leaf subdivision - use actual sub-voxel position, everything else is offset by one
+	if (aLink.GetLayerIndex() == 0 && NavigationData.OctreeData.GetNode(aLink).HasChildren())
+	{
+		return 0;
+	}
+
+	return aLink.GetLayerIndex() + 1;
+}
+
 void AeonixPathFinder::BuildPath(TMap<AeonixLink, AeonixLink>& aCameFrom, AeonixLink aCurrent, const FVector& aStartPos, const FVector& aTargetPos, FAeonixNavigationPath& oPath)
 {
 	FAeonixPathPoint pos;
 
 	TArray<FAeonixPathPoint> points;
 
+	// Any-angle parents can be a long way from the goal, and the visibility pull steps through the goal's neighbour, so keep the goal itself
+	// rather than letting the target position stand in for its parent
+	if ((Settings.bUseAnyAnglePathfinding || (Settings.bUseStringPulling && Settings.bUseVisibilityStringPulling)) && !(aCurrent == StartLink))
+	{
+		points.Emplace(aTargetPos, GetPathPointLayer(aCurrent));
+	}
+
+	// Region steps skip across leaves, so gather the links start first and fill in the subnodes each region was crossed by
+	if (ShouldExpandLeafRegions() || ShouldCollapseEmptyLeaves())
+	{
+		TArray<AeonixLink> links;
+		links.Add(aCurrent);
+		while (aCameFrom.Contains(aCurrent) && !(aCurrent == aCameFrom[aCurrent]))
+		{
+			aCurrent = aCameFrom[aCurrent];
+			links.Insert(aCurrent, 0);
+		}
+
+		TArray<AeonixLink> resolvedLinks;
+		ResolveLeafRegionLinks(links, resolvedLinks);
+		BuildPathFromLinks(resolvedLinks, aStartPos, aTargetPos, oPath);
+		return;
+	}
+
 	// Initial path building from the A* results
 	while (aCameFrom.Contains(aCurrent) && !(aCurrent == aCameFrom[aCurrent]))
 	{
 		aCurrent = aCameFrom[aCurrent];
 		NavigationData.GetLinkPosition(aCurrent, pos.Position);
 
+		pos.Layer = GetPathPointLayer(aCurrent);
 		points.Add(pos);
-		const AeonixNode& node = NavigationData.OctreeData.GetNode(aCurrent);
-
-		if (aCurrent.GetLayerIndex() == 0)
-		{
-			if (!node.HasChildren())
-			{
-				points[points.Num() - 1].Layer = 1;
-			}
-			else
-			{
-				// Layer 0 node with leaf subdivision - use actual sub-voxel position
-				points[points.Num() - 1].Layer = 0;
-			}
-		}
-		else
-		{
-			points[points.Num() - 1].Layer = aCurrent.GetLayerIndex() + 1;
-		}
 	}
 
 	if (points.Num() > 1)
@@ -374,6 +1743,12 @@ void AeonixPathFinder::BuildPath(TMap<AeonixLink, AeonixLink>& aCameFrom, Aeonix
 		points.Emplace(aStartPos, StartLink.GetLayerIndex());
 	}
 
+	// Any-angle paths are already straight, and moving their points off the line of sight checks could clip geometry
+	FinalizePath(points, !Settings.bUseAnyAnglePathfinding, oPath);
+}
+
+void AeonixPathFinder::FinalizePath(TArray<FAeonixPathPoint>& points, bool bRefinePath, FAeonixNavigationPath& oPath)
+{
 #if WITH_EDITOR
 	// Store the original path for debug visualization before any optimizations
 	TArray<FDebugVoxelInfo> debugVoxelInfo;
@@ -393,20 +1768,33 @@ void AeonixPathFinder::BuildPath(TMap<AeonixLink, AeonixLink>& aCameFrom, Aeonix
 	oPath.SetDebugVoxelInfo(debugVoxelInfo);
 #endif
 
+	// Line of sight pulling leaves only points joined by clear segments, which moving them afterwards could break. It runs on the node centres
+	// before anything moves them, and if it can't join them up the path is refined as usual
+	LastVisibilityTestCount = 0;
+	bool bVisibilityPull = Settings.bUseStringPulling && Settings.bUseVisibilityStringPulling && bRefinePath;
+	if (bVisibilityPull)
 	{
-		SCOPE_CYCLE_COUNTER(STAT_AeonixPathChaikinSmoothing);
-		Smooth_Chaikin(points, Settings.SmoothingIterations);
+		SCOPE_CYCLE_COUNTER(STAT_AeonixPathStringPulling);
+		bVisibilityPull = VisibilityPullPath(points);
 	}
 
-	// Apply string pulling if enabled
-	if (Settings.bUseStringPulling)
+	if (!bVisibilityPull)
 	{
-		SCOPE_CYCLE_COUNTER(STAT_AeonixPathStringPulling);
-		StringPullPath(points);
+		{
+			SCOPE_CYCLE_COUNTER(STAT_AeonixPathChaikinSmoothing);
+			Smooth_Chaikin(points, Settings.SmoothingIterations);
+		}
+
+		// Apply string pulling if enabled
+		if (Settings.bUseStringPulling && bRefinePath)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_AeonixPathStringPulling);
+			StringPullPath(points);
+		}
 	}
 
 	// Smooth the path by adjusting positions within voxel bounds
-	if (Settings.bSmoothPositions)
+	if (Settings.bSmoothPositions && bRefinePath && !bVisibilityPull)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_AeonixPathPositionSmoothing);
 		SmoothPathPositions(points);
@@ -414,7 +1802,7 @@ void AeonixPathFinder::BuildPath(TMap<AeonixLink, AeonixLink>& aCameFrom, Aeonix
 
 	// For the intermediate type, for voxels on the same layer, we use the average of the two positions, this smooths out zigzags in diagonal paths.
 	// a proper string pulling algorithm would do better, but this is quick and easy for now!
-	if (Settings.PathPointType == EAeonixPathPointType::INTERMEDIATE)
+	if (Settings.PathPointType == EAeonixPathPointType::INTERMEDIATE && bRefinePath && !bVisibilityPull)
 	{
 		for (int i = points.Num() - 1; i >= 0; i--)
 		{
@@ -587,6 +1975,91 @@ void AeonixPathFinder::StringPullPath(TArray<FAeonixPathPoint>& pathPoints)
 	       pathPoints.Num() - pathPoints.FilterByPredicate([](const FAeonixPathPoint& Point){ return Point.bCullFlag; }).Num());
 }
 
+bool AeonixPathFinder::VisibilityPullPath(TArray<FAeonixPathPoint>& pathPoints)
+{
+	if (pathPoints.Num() < 2)
+	{
+		return true;
+	}
+
+	// The ends were moved from their voxel centres to the start and target, so step through the centres as well. The segment between the centres
+	// of two face neighbours never leaves them, so only an end outside its own voxel leaves a step that can be blocked
+	TArray<FAeonixPathPoint> points;
+	points.Reserve(pathPoints.Num() + 2);
+	points.Add(pathPoints[0]);
+
+	FVector centre;
+	if (GoalLink.IsValid() && NavigationData.GetLinkPosition(GoalLink, centre) && !centre.Equals(points.Last().Position))
+	{
+		points.Emplace(centre, GetPathPointLayer(GoalLink));
+	}
+
+	points.Append(pathPoints.GetData() + 1, pathPoints.Num() - 2);
+
+	if (StartLink.IsValid() && NavigationData.GetLinkPosition(StartLink, centre) && !centre.Equals(points.Last().Position) && !centre.Equals(pathPoints.Last().Position))
+	{
+		points.Emplace(centre, GetPathPointLayer(StartLink));
+	}
+
+	points.Add(pathPoints.Last());
+
+	auto CanSee = [&](int32 aFrom, int32 aTo)
+	{
+		LastVisibilityTestCount++;
+		return NavigationData.IsSegmentClear(points[aFrom].Position, points[aTo].Position);
+	};
+
+	// Every kept segment is tested clear. Visibility along a path isn't monotonic, so the binary search finds a point that can be seen
+	// rather than always the furthest one
+	TArray<FAeonixPathPoint> kept;
+	kept.Reserve(points.Num());
+	kept.Add(points[0]);
+
+	const int32 lastIdx = points.Num() - 1;
+	int32 apexIdx = 0;
+	while (apexIdx < lastIdx)
+	{
+		// Most pulled paths end in one long straight run, so try the last point before searching
+		int32 visibleIdx = apexIdx;
+		if (CanSee(apexIdx, lastIdx))
+		{
+			visibleIdx = lastIdx;
+		}
+		else
+		{
+			// Narrow the gap between a point that's been seen and one known not to be
+			int32 blockedIdx = lastIdx;
+			while (blockedIdx - visibleIdx > 1)
+			{
+				const int32 midIdx = visibleIdx + (blockedIdx - visibleIdx) / 2;
+				if (CanSee(apexIdx, midIdx))
+				{
+					visibleIdx = midIdx;
+				}
+				else
+				{
+					blockedIdx = midIdx;
+				}
+			}
+		}
+
+		// Even the next point is out of sight, there's no clear way on from here
+		if (visibleIdx == apexIdx)
+		{
+			UE_LOG(LogAeonixNavigation, Log, TEXT("Visibility string pulling: Step from point %d of %d is blocked, leaving the path to the regular string pulling"), apexIdx, points.Num());
+			return false;
+		}
+
+		kept.Add(points[visibleIdx]);
+		apexIdx = visibleIdx;
+	}
+
+	UE_LOG(LogAeonixNavigation, Log, TEXT("Visibility string pulling: Original points: %d, Kept points: %d, Visibility tests: %d"), points.Num(), kept.Num(), LastVisibilityTestCount);
+
+	pathPoints = MoveTemp(kept);
+	return true;
+}
+
 void AeonixPathFinder::Smooth_Chaikin(TArray<FAeonixPathPoint>& somePoints, int aNumIterations)
 {
 	for (int i = 0; i < aNumIterations; i++)
@@ -50,18 +50,20 @@ FAeonixPathfindBenchmarkSummary FAeonixPathfindBenchmark::RunBenchmark(
 	Summary.TotalRuns = NumRuns;
 	Summary.Results.Reserve(NumRuns);
 
-	// Collect all navigable nodes
-	TArray<AeonixLink> NavigableNodes;
-	CollectNavigableNodes(NavData, NavigableNodes);
+	// Endpoints are drawn uniformly from the free space, the totals are only missing if the data was never generated or loaded here
+	if (!NavData.GetFreeVolume().IsValid())
+	{
+		NavData.BuildFreeVolume();
+	}
 
-	if (NavigableNodes.Num() < 2)
+	if (NavData.GetFreeVolume().GetTotalSubnodes() < 2)
 	{
-		UE_LOG(LogAeonixNavigation, Error, TEXT("Benchmark failed: Need at least 2 navigable nodes, found %d"),
-			NavigableNodes.Num());
+		UE_LOG(LogAeonixNavigation, Error, TEXT("Benchmark failed: Need at least 2 free subnodes, found %llu"),
+			NavData.GetFreeVolume().GetTotalSubnodes());
 		return Summary;
 	}
 
-	UE_LOG(LogAeonixNavigation, Display, TEXT("Benchmark: Found %d navigable nodes"), NavigableNodes.Num());
+	UE_LOG(LogAeonixNavigation, Display, TEXT("Benchmark: Sampling from %llu free subnodes"), NavData.GetFreeVolume().GetTotalSubnodes());
 
 	// Initialize random stream with seed
 	FRandomStream RandomStream(Seed);
@@ -77,22 +79,17 @@ FAeonixPathfindBenchmarkSummary FAeonixPathfindBenchmark::RunBenchmark(
 	{
 		FAeonixPathfindBenchmarkResult Result;
 
-		// Randomly select start and end nodes (ensure they're different)
-		int32 StartIdx = RandomStream.RandRange(0, NavigableNodes.Num() - 1);
-		int32 EndIdx = RandomStream.RandRange(0, NavigableNodes.Num() - 1);
+		// Randomly select start and end points (try for different voxels, a volume of one free node only has the one)
+		AeonixLink StartLink;
+		AeonixLink EndLink;
+		NavData.GetRandomNavigablePoint(RandomStream, StartLink, Result.StartPos);
+		NavData.GetRandomNavigablePoint(RandomStream, EndLink, Result.EndPos);
 
-		// Ensure different nodes
-		while (EndIdx == StartIdx && NavigableNodes.Num() > 1)
+		for (int32 Attempt = 0; EndLink == StartLink && Attempt < 8; ++Attempt)
 		{
-			EndIdx = RandomStream.RandRange(0, NavigableNodes.Num() - 1);
+			NavData.GetRandomNavigablePoint(RandomStream, EndLink, Result.EndPos);
 		}
 
-		AeonixLink StartLink = NavigableNodes[StartIdx];
-		AeonixLink EndLink = NavigableNodes[EndIdx];
-
-		// Get positions
-		NavData.GetLinkPosition(StartLink, Result.StartPos);
-		NavData.GetLinkPosition(EndLink, Result.EndPos);
 		Result.DirectDistance = FVector::Dist(Result.StartPos, Result.EndPos);
 
 		// Time the pathfinding
@@ -133,70 +130,6 @@ FAeonixPathfindBenchmarkSummary FAeonixPathfindBenchmark::RunBenchmark(
 	return Summary;
 }
 
-void FAeonixPathfindBenchmark::CollectNavigableNodes(FAeonixData& NavData, TArray<AeonixLink>& OutNodes)
-{
-	OutNodes.Empty();
-
-	// For Layer 0 nodes, we need to check leaf data to find actually navigable nodes
-	const TArray<AeonixNode>& Layer0 = NavData.OctreeData.GetLayer(0);
-
-	for (int32 NodeIdx = 0; NodeIdx < Layer0.Num(); ++NodeIdx)
-	{
-		const AeonixNode& Node = Layer0[NodeIdx];
-
-		if (Node.FirstChild.IsValid())
-		{
-			const AeonixLeafNode& Leaf = NavData.OctreeData.GetLeafNode(Node.FirstChild.GetNodeIndex());
-
-			// Skip completely blocked nodes
-			if (Leaf.IsCompletelyBlocked())
-			{
-				continue;
-			}
-
-			if (Leaf.IsEmpty())
-			{
-				// Empty leaf - any subnode is navigable, use 0
-				OutNodes.Add(AeonixLink(0, NodeIdx, 0));
-			}
-			else
-			{
-				// Partial leaf - find an unblocked subnode
-				for (int32 SubIdx = 0; SubIdx < 64; ++SubIdx)
-				{
-					if (!Leaf.GetNode(SubIdx))
-					{
-						OutNodes.Add(AeonixLink(0, NodeIdx, SubIdx));
-						break;
-					}
-				}
-			}
-		}
-		else
-		{
-			// No leaf data - treat as fully navigable
-			OutNodes.Add(AeonixLink(0, NodeIdx, 0));
-		}
-	}
-
-	// Also include higher layer leaf nodes (nodes without children)
-	for (int32 LayerIdx = 1; LayerIdx < NavData.OctreeData.NumLayers; ++LayerIdx)
-	{
-		const TArray<AeonixNode>& Layer = NavData.OctreeData.GetLayer(LayerIdx);
-
-		for (int32 NodeIdx = 0; NodeIdx < Layer.Num(); ++NodeIdx)
-		{
-			const AeonixNode& Node = Layer[NodeIdx];
-
-			// Only include leaf nodes (nodes without children)
-			if (!Node.HasChildren())
-			{
-				OutNodes.Add(AeonixLink(LayerIdx, NodeIdx, 0));
-			}
-		}
-	}
-}
-
 void FAeonixPathfindBenchmark::CalculateSummary(FAeonixPathfindBenchmarkSummary& Summary)
 {
 	if (Summary.SuccessfulRuns == 0)
@@ -17,6 +17,7 @@
 #include "Data/AeonixThreading.h"
 #include "Settings/AeonixSettings.h"
 
+#include "Algo/BinarySearch.h"
 #include "HAL/PlatformProcess.h"
 #include "DrawDebugHelpers.h"
 
@@ -24,19 +25,28 @@ void UAeonixSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	RandomPointStream.GenerateNewSeed();
+
 	// Get settings
 	const UAeonixSettings* Settings = GetDefault<UAeonixSettings>();
 	const int32 NumWorkerThreads = Settings ? Settings->PathfindingWorkerThreads : 2;
 
-	// Initialize worker pool
-	WorkerPool.Initialize(NumWorkerThreads);
+	// Initialize worker pool, without one every async request is time sliced on the game thread
+	if (NumWorkerThreads > 0)
+	{
+		WorkerPool.Initialize(NumWorkerThreads);
+	}
 
 	// Update max concurrent pathfinds from settings
 	if (Settings)
 	{
 		MaxConcurrentPathfinds = Settings->MaxConcurrentPathfinds;
+		TimeSlicedIterationsPerFrame = Settings->TimeSlicedIterationsPerFrame;
 	}
 
+	PathCache.SetCapacity(Settings ? Settings->PathCacheSize : 0);
+	FloodFillCache.SetCapacity(Settings ? Settings->FloodFillCacheSize : 0);
+
 	UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem initialized: %d worker threads, max %d concurrent pathfinds"),
 		NumWorkerThreads, MaxConcurrentPathfinds);
 }
@@ -73,6 +83,10 @@ void UAeonixSubsystem::UnRegisterVolume(AAeonixBoundingVolume* Volume)
 
 			RegisteredVolumes.RemoveSingle(Handle);
 
+			// Entries for this volume can never be looked up again, don't leave them taking up space
+			PathCache.Empty();
+			FloodFillCache.Empty();
+
 			// Notify listeners that registration changed
 			OnRegistrationChanged.Broadcast();
 			return;
@@ -291,7 +305,446 @@ const AAeonixBoundingVolume* UAeonixSubsystem::GetVolumeForPosition(const FVecto
 	return nullptr;
 }
 
-bool UAeonixSubsystem::FindPathImmediateAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, FAeonixNavigationPath& OutPath)
+bool UAeonixSubsystem::IsSegmentClear(const FVector& Start, const FVector& End)
+{
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForPosition(Start);
+	if (!NavVolume)
+	{
+		return false;
+	}
+
+	FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+	return NavVolume->GetNavData().IsSegmentClear(Start, End);
+}
+
+bool UAeonixSubsystem::RaycastNav(const FVector& Start, const FVector& End, FAeonixNavRaycastHit& OutHit)
+{
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForPosition(Start);
+	if (!NavVolume)
+	{
+		OutHit = FAeonixNavRaycastHit();
+		OutHit.bBlockingHit = true;
+		OutHit.Time = 0.f;
+		OutHit.Location = Start;
+		return true;
+	}
+
+	FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+	return NavVolume->GetNavData().RaycastNav(Start, End, OutHit);
+}
+
+bool UAeonixSubsystem::ProjectPointToNavigation(const FVector& Point, float MaxDistance, FVector& OutPoint)
+{
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForPosition(Point);
+	if (!NavVolume)
+	{
+		return false;
+	}
+
+	FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+	AeonixLink Link;
+	return AeonixMediator::ProjectToNavigation(Point, *NavVolume, MaxDistance, Link, OutPoint);
+}
+
+bool UAeonixSubsystem::GetRandomNavigablePoint(FVector& OutPoint)
+{
+	// Each volume is picked in proportion to its free space, so the point is uniform across all of them
+	TArray<const AAeonixBoundingVolume*, TInlineAllocator<8>> Volumes;
+	TArray<double, TInlineAllocator<8>> CumulativeVolume;
+	for (const FAeonixBoundingVolumeHandle& Handle : RegisteredVolumes)
+	{
+		const AAeonixBoundingVolume* NavVolume = Handle.VolumeHandle;
+		if (!NavVolume || !NavVolume->HasData())
+		{
+			continue;
+		}
+
+		FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+		const FAeonixData& NavData = NavVolume->GetNavData();
+		const double Volume = NavData.GetFreeVolume().GetTotalSubnodes() * FMath::Cube(static_cast<double>(NavData.GetVoxelSize(0) * 0.25f));
+		if (Volume > 0.0)
+		{
+			Volumes.Add(NavVolume);
+			CumulativeVolume.Add((CumulativeVolume.Num() > 0 ? CumulativeVolume.Last() : 0.0) + Volume);
+		}
+	}
+
+	if (Volumes.Num() == 0)
+	{
+		return false;
+	}
+
+	const double Pick = RandomPointStream.GetFraction() * CumulativeVolume.Last();
+	const AAeonixBoundingVolume* NavVolume = Volumes[FMath::Min(Algo::UpperBound(CumulativeVolume, Pick), Volumes.Num() - 1)];
+
+	FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+	AeonixLink Link;
+	return NavVolume->GetNavData().GetRandomNavigablePoint(RandomPointStream, Link, OutPoint);
+}
+
+bool UAeonixSubsystem::GetRandomReachablePoint(const FVector& Origin, FVector& OutPoint)
+{
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForPosition(Origin);
+	if (!NavVolume)
+	{
+		return false;
+	}
+
+	FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+	AeonixLink OriginLink;
+	AeonixLink Link;
+	return AeonixMediator::GetNavigableLinkFromPosition(Origin, *NavVolume, OriginLink)
+		&& NavVolume->GetNavData().GetRandomReachablePoint(OriginLink, RandomPointStream, Link, OutPoint);
+}
+
+bool UAeonixSubsystem::GetRandomNavigablePointInBox(const FBox& Box, FVector& OutPoint)
+{
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForPosition(Box.GetCenter());
+	if (!NavVolume)
+	{
+		return false;
+	}
+
+	FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+	AeonixLink Link;
+	return NavVolume->GetNavData().GetRandomNavigablePointInBox(Box, RandomPointStream, Link, OutPoint);
+}
+
+bool UAeonixSubsystem::GetFloodFillPoints(const FVector& Origin, float Radius, int32 MaxSteps, float MinSpacing, TArray<FVector>& OutPoints)
+{
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForPosition(Origin);
+	if (!NavVolume || !NavVolume->HasData())
+	{
+		return false;
+	}
+
+	// EQS queries can run on background threads while dynamic regeneration is modifying the octree on the game thread
+	FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+	const FAeonixData& NavData = NavVolume->GetNavData();
+
+	AeonixLink StartLink;
+	if (!AeonixMediator::GetLinkFromPosition(Origin, *NavVolume, StartLink))
+	{
+		return false;
+	}
+
+	FAeonixFloodFillCacheKey Key;
+	Key.Volume = NavVolume;
+	Key.Origin = StartLink;
+	Key.Radius = Radius;
+	Key.MaxSteps = MaxSteps;
+	Key.MinSpacing = MinSpacing;
+
+	auto GetVersion = [this](const FGuid& RegionId) { return GetRegionVersion(RegionId); };
+	if (FloodFillCache.Find(Key, NavData.GetGenerationId(), GetVersion, OutPoints))
+	{
+		return true;
+	}
+
+	// Measured from the voxel rather than the exact origin, so every query from the voxel gives the same points
+	FVector Centre;
+	NavData.GetLinkPosition(StartLink, Centre);
+
+	// Only regions overlapping the radius can change what the flood reaches
+	const FBox Reach(Centre - FVector(Radius), Centre + FVector(Radius));
+	TMap<FGuid, uint32> RegionVersions;
+	for (const TPair<FGuid, FBox>& Region : NavData.GetParams().DynamicRegionBoxes)
+	{
+		if (Region.Value.Intersect(Reach))
+		{
+			RegionVersions.Add(Region.Key, GetVersion(Region.Key));
+		}
+	}
+
+	TArray<FVector> Reached;
+	NavData.FloodFill(StartLink, Centre, Radius, MaxSteps, Reached);
+
+	OutPoints.Reset();
+	if (MinSpacing > 0.0f)
+	{
+		// One point per spatial bucket, sized for optimal sphere packing
+		const float InvBucketSize = 1.0f / (MinSpacing * 0.866f);
+		TSet<FIntVector> OccupiedBuckets;
+		OccupiedBuckets.Reserve(Reached.Num());
+		for (const FVector& Point : Reached)
+		{
+			bool bAlreadyOccupied = false;
+			OccupiedBuckets.Add(FIntVector(FMath::FloorToInt(Point.X * InvBucketSize), FMath::FloorToInt(Point.Y * InvBucketSize), FMath::FloorToInt(Point.Z * InvBucketSize)), &bAlreadyOccupied);
+			if (!bAlreadyOccupied)
+			{
+				OutPoints.Add(Point);
+			}
+		}
+	}
+	else
+	{
+		OutPoints = MoveTemp(Reached);
+	}
+
+	FloodFillCache.Add(Key, NavData.GetGenerationId(), OutPoints, MoveTemp(RegionVersions));
+	return true;
+}
+
+bool UAeonixSubsystem::GetPathDistances(const FVector& Origin, TConstArrayView<FVector> Points, float MaxDistance, const FAeonixPathFinderSettings& Settings, TArray<float>& OutDistances)
+{
+	OutDistances.Init(-1.f, Points.Num());
+
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForPosition(Origin);
+	if (!NavVolume || !NavVolume->HasData())
+	{
+		return false;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_AeonixPathDistances);
+
+	// The lookups and the search all see the same octree, whatever dynamic regeneration does on the game thread meanwhile
+	FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+	const FAeonixData& NavData = NavVolume->GetNavData();
+
+	AeonixLink StartLink;
+	if (!AeonixMediator::GetLinkFromPosition(Origin, *NavVolume, StartLink))
+	{
+		return false;
+	}
+
+	TArray<FAeonixPointClassification> Classifications;
+	NavData.ClassifyPoints(Points, 0.0f, Classifications);
+
+	TArray<AeonixLink> Targets;
+	Targets.Reserve(Points.Num());
+	for (const FAeonixPointClassification& Classification : Classifications)
+	{
+		Targets.Add(Classification.State == EAeonixPointState::Free ? Classification.Link : AeonixLink::GetInvalidLink());
+	}
+
+	// The search runs between voxel centres, so the legs from Origin to its voxel and from each point's voxel to the point are added on
+	FVector StartPosition;
+	NavData.GetLinkPosition(StartLink, StartPosition);
+	const float StartLeg = FVector::Dist(Origin, StartPosition);
+
+	AeonixPathFinder PathFinder(NavData, Settings);
+	TArray<float> LinkDistances;
+	PathFinder.FindPathDistances(StartLink, MaxDistance - StartLeg, Targets, LinkDistances);
+
+	for (int32 i = 0; i < Points.Num(); i++)
+	{
+		FVector TargetPosition;
+		if (LinkDistances[i] < 0.0f || !NavData.GetLinkPosition(Targets[i], TargetPosition))
+		{
+			continue;
+		}
+
+		const float Distance = StartLeg + LinkDistances[i] + FVector::Dist(TargetPosition, Points[i]);
+		if (Distance <= MaxDistance)
+		{
+			OutDistances[i] = Distance;
+		}
+	}
+	return true;
+}
+
+TSharedPtr<const FAeonixVisibilityField> UAeonixSubsystem::BuildVisibilityField(const FVector& Target, float Radius)
+{
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForPosition(Target);
+	if (!NavVolume || !NavVolume->HasData())
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FAeonixVisibilityField> Field = MakeShared<FAeonixVisibilityField>();
+	{
+		FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+		Field->Build(NavVolume->GetNavData(), Target, Radius);
+	}
+	return Field;
+}
+
+bool UAeonixSubsystem::GetPointVisibility(const FVector& Target, TConstArrayView<FVector> Points, float Radius, TArray<EAeonixVisibility>& OutVisibility)
+{
+	OutVisibility.Init(EAeonixVisibility::Unknown, Points.Num());
+
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForPosition(Target);
+	if (!NavVolume || !NavVolume->HasData())
+	{
+		return false;
+	}
+
+	// The field and the point lookups have to agree on the octree, so both happen under one lock
+	FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+	const FAeonixData& NavData = NavVolume->GetNavData();
+
+	FAeonixVisibilityField Field;
+	Field.Build(NavData, Target, Radius);
+
+	TArray<FAeonixPointClassification> Classifications;
+	NavData.ClassifyPoints(Points, 0.0f, Classifications);
+	for (int32 i = 0; i < Points.Num(); i++)
+	{
+		if (Classifications[i].State == EAeonixPointState::Free)
+		{
+			OutVisibility[i] = Field.GetLinkVisibility(Classifications[i].Link);
+		}
+	}
+	return true;
+}
+
+bool UAeonixSubsystem::FindNearestObstacle(const FVector& Position, float MaxDistance, FAeonixNearestObstacle& OutObstacle)
+{
+	OutObstacle = FAeonixNearestObstacle();
+
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForPosition(Position);
+	if (!NavVolume || !NavVolume->HasData())
+	{
+		return false;
+	}
+
+	FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+	return NavVolume->GetNavData().FindNearestObstacle(Position, MaxDistance, OutObstacle);
+}
+
+void UAeonixSubsystem::FindNearestObstacles(TConstArrayView<FVector> Positions, float MaxDistance, TArray<FAeonixNearestObstacle>& OutObstacles)
+{
+	OutObstacles.Init(FAeonixNearestObstacle(), Positions.Num());
+
+	TArray<const AAeonixBoundingVolume*> PositionVolumes;
+	PositionVolumes.SetNumUninitialized(Positions.Num());
+	for (int32 i = 0; i < Positions.Num(); i++)
+	{
+		PositionVolumes[i] = GetVolumeForPosition(Positions[i]);
+	}
+
+	TArray<FVector> VolumePositions;
+	TArray<int32> VolumeIndices;
+	TArray<FAeonixNearestObstacle> VolumeObstacles;
+	for (const FAeonixBoundingVolumeHandle& Handle : RegisteredVolumes)
+	{
+		const AAeonixBoundingVolume* NavVolume = Handle.VolumeHandle;
+		if (!NavVolume || !NavVolume->HasData() || !PositionVolumes.Contains(NavVolume))
+		{
+			continue;
+		}
+
+		VolumePositions.Reset();
+		VolumeIndices.Reset();
+		for (int32 i = 0; i < Positions.Num(); i++)
+		{
+			if (PositionVolumes[i] == NavVolume)
+			{
+				VolumePositions.Add(Positions[i]);
+				VolumeIndices.Add(i);
+			}
+		}
+
+		{
+			FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+			NavVolume->GetNavData().FindNearestObstacles(VolumePositions, MaxDistance, VolumeObstacles);
+		}
+
+		for (int32 i = 0; i < VolumeIndices.Num(); i++)
+		{
+			OutObstacles[VolumeIndices[i]] = VolumeObstacles[i];
+		}
+	}
+}
+
+void UAeonixSubsystem::IsSegmentClearBatch(TConstArrayView<TPair<FVector, FVector>> Segments, TArray<bool>& OutClear)
+{
+	OutClear.Init(false, Segments.Num());
+
+	TArray<const AAeonixBoundingVolume*> SegmentVolumes;
+	SegmentVolumes.SetNumUninitialized(Segments.Num());
+	for (int32 i = 0; i < Segments.Num(); i++)
+	{
+		SegmentVolumes[i] = GetVolumeForPosition(Segments[i].Key);
+	}
+
+	TArray<TPair<FVector, FVector>> VolumeSegments;
+	TArray<int32> VolumeIndices;
+	TArray<bool> VolumeClear;
+	for (const FAeonixBoundingVolumeHandle& Handle : RegisteredVolumes)
+	{
+		const AAeonixBoundingVolume* NavVolume = Handle.VolumeHandle;
+		if (!NavVolume || !SegmentVolumes.Contains(NavVolume))
+		{
+			continue;
+		}
+
+		VolumeSegments.Reset();
+		VolumeIndices.Reset();
+		for (int32 i = 0; i < Segments.Num(); i++)
+		{
+			if (SegmentVolumes[i] == NavVolume)
+			{
+				VolumeSegments.Add(Segments[i]);
+				VolumeIndices.Add(i);
+			}
+		}
+
+		{
+			FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+			NavVolume->GetNavData().IsSegmentClearBatch(VolumeSegments, VolumeClear);
+		}
+
+		for (int32 i = 0; i < VolumeIndices.Num(); i++)
+		{
+			OutClear[VolumeIndices[i]] = VolumeClear[i];
+		}
+	}
+}
+
+void UAeonixSubsystem::RaycastNavBatch(TConstArrayView<TPair<FVector, FVector>> Segments, TArray<FAeonixNavRaycastHit>& OutHits)
+{
+	OutHits.SetNum(Segments.Num());
+
+	TArray<const AAeonixBoundingVolume*> SegmentVolumes;
+	SegmentVolumes.SetNumUninitialized(Segments.Num());
+	for (int32 i = 0; i < Segments.Num(); i++)
+	{
+		SegmentVolumes[i] = GetVolumeForPosition(Segments[i].Key);
+		if (!SegmentVolumes[i])
+		{
+			OutHits[i] = FAeonixNavRaycastHit();
+			OutHits[i].bBlockingHit = true;
+			OutHits[i].Time = 0.f;
+			OutHits[i].Location = Segments[i].Key;
+		}
+	}
+
+	TArray<TPair<FVector, FVector>> VolumeSegments;
+	TArray<int32> VolumeIndices;
+	TArray<FAeonixNavRaycastHit> VolumeHits;
+	for (const FAeonixBoundingVolumeHandle& Handle : RegisteredVolumes)
+	{
+		const AAeonixBoundingVolume* NavVolume = Handle.VolumeHandle;
+		if (!NavVolume || !SegmentVolumes.Contains(NavVolume))
+		{
+			continue;
+		}
+
+		VolumeSegments.Reset();
+		VolumeIndices.Reset();
+		for (int32 i = 0; i < Segments.Num(); i++)
+		{
+			if (SegmentVolumes[i] == NavVolume)
+			{
+				VolumeSegments.Add(Segments[i]);
+				VolumeIndices.Add(i);
+			}
+		}
+
+		{
+			FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+			NavVolume->GetNavData().RaycastNavBatch(VolumeSegments, VolumeHits);
+		}
+
+		for (int32 i = 0; i < VolumeIndices.Num(); i++)
+		{
+			OutHits[VolumeIndices[i]] = VolumeHits[i];
+		}
+	}
+}
+
+bool UAeonixSubsystem::FindPathImmediateAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, FAeonixNavigationPath& OutPath, int32 MaxIterations)
 {
 	const AAeonixBoundingVolume* NavVolume = GetVolumeForAgent(NavigationComponent);
 
@@ -304,20 +757,53 @@ bool UAeonixSubsystem::FindPathImmediateAgent(UAeonixNavAgentComponent* Navigati
 	AeonixLink TargetNavLink;
 
 	// Get the nav link from our volume
-	if (!AeonixMediator::GetLinkFromPosition(NavigationComponent->GetPathfindingStartPosition(), *NavVolume, StartNavLink))
+	if (!GetNavigableLink(*NavVolume, NavigationComponent->GetPathfindingStartPosition(), StartNavLink))
 	{
 		UE_LOG(LogAeonixNavigation, Error, TEXT("Path finder failed to find start nav link"));
 		return false;
 	}
 
-	if (!AeonixMediator::GetLinkFromPosition(NavigationComponent->GetPathfindingEndPosition(End), *NavVolume, TargetNavLink))
+	// A goal in blocked space is moved to where the path can actually end
+	FVector EndPosition;
+	if (!GetNavigableLink(*NavVolume, NavigationComponent->GetPathfindingEndPosition(End), TargetNavLink, EndPosition))
 	{
 		UE_LOG(LogAeonixNavigation, Error, TEXT("Path finder failed to find target nav link"));
 		return false;
 	}
 
+	// Start and target in different connected components can never be joined, skip the search entirely
+	{
+		FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+		if (!NavVolume->GetNavData().AreLinksConnected(StartNavLink, TargetNavLink))
+		{
+			UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Target is not reachable from start, rejected without searching"));
+			LoadMetrics.UnreachableRejectedTotal.fetch_add(1);
+			return false;
+		}
+	}
+
+	FAeonixPathCacheKey CacheKey;
+	const bool bUseCache = MakePathCacheKey(NavVolume, StartNavLink, TargetNavLink, NavigationComponent->PathfinderSettings, CacheKey);
+	if (bUseCache && FindCachedPath(CacheKey, NavVolume, NavigationComponent->GetPathfindingStartPosition(), EndPosition, OutPath))
+	{
+		OutPath.SetIsReady(true);
+		UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Cached path with %d points, marked as ready"), OutPath.GetPathPoints().Num());
+		return true;
+	}
+
 	OutPath.ResetForRepath();
 
+	// A budget for this call ends the search early with the way to wherever it got closest, the same path the agent's own limit would give with bReturnPartialPath.
+	// A complete path is no different for it, so the cache key stays the agent's settings
+	FAeonixPathFinderSettings BudgetedSettings;
+	const bool bBudgeted = MaxIterations > 0 && MaxIterations < NavigationComponent->PathfinderSettings.MaxIterations;
+	if (bBudgeted)
+	{
+		BudgetedSettings = NavigationComponent->PathfinderSettings;
+		BudgetedSettings.MaxIterations = MaxIterations;
+		BudgetedSettings.bReturnPartialPath = true;
+	}
+
 	// Acquire read lock for thread-safe octree access during pathfinding
 	bool Result;
 	FAeonixPathFailureInfo FailureInfo;
@@ -325,8 +811,8 @@ bool UAeonixSubsystem::FindPathImmediateAgent(UAeonixNavAgentComponent* Navigati
 		FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
 		SCOPE_CYCLE_COUNTER(STAT_AeonixPathfindingSync);
 
-		AeonixPathFinder pathFinder(NavVolume->GetNavData(), NavigationComponent->PathfinderSettings);
-		Result = pathFinder.FindPath(StartNavLink, TargetNavLink, NavigationComponent->GetPathfindingStartPosition(), NavigationComponent->GetPathfindingEndPosition(End), OutPath, &FailureInfo);
+		AeonixPathFinder pathFinder(NavVolume->GetNavData(), bBudgeted ? BudgetedSettings : NavigationComponent->PathfinderSettings);
+		Result = pathFinder.FindPath(StartNavLink, TargetNavLink, NavigationComponent->GetPathfindingStartPosition(), EndPosition, OutPath, &FailureInfo);
 	}
 
 	// CRITICAL FIX: Track regions BEFORE marking path ready
@@ -334,6 +820,18 @@ bool UAeonixSubsystem::FindPathImmediateAgent(UAeonixNavAgentComponent* Navigati
 	if (Result)
 	{
 		TrackPathRegions(OutPath, NavVolume);
+
+		// A partial path only stands in until the agent gets further, it's no answer for anyone else
+		if (bUseCache && !OutPath.IsPartial())
+		{
+			// Searches on the game thread can't overlap a regen, so the current versions are the ones the path was found against
+			TMap<FGuid, uint32> RegionVersions;
+			for (const FGuid& RegionId : OutPath.GetTraversedRegionIds())
+			{
+				RegionVersions.Add(RegionId, GetRegionVersion(RegionId));
+			}
+			AddCachedPath(CacheKey, NavVolume->GetNavData().GetGenerationId(), OutPath, RegionVersions);
+		}
 	}
 	else if (FailureInfo.bFailedDueToMaxIterations)
 	{
@@ -360,77 +858,704 @@ bool UAeonixSubsystem::FindPathImmediateAgent(UAeonixNavAgentComponent* Navigati
 	return Result;
 }
 
-FAeonixPathFindRequestCompleteDelegate& UAeonixSubsystem::FindPathAsyncAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, FAeonixNavigationPath& OutPath)
+bool UAeonixSubsystem::FindPathIncrementalAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, FAeonixIncrementalSearch& IoSearch, FAeonixNavigationPath& OutPath)
 {
-	AeonixLink StartNavLink;
-	AeonixLink TargetNavLink;
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForAgent(NavigationComponent);
 
-	// Create request with enhanced metadata
-	TUniquePtr<FAeonixPathFindRequest> Request = MakeUnique<FAeonixPathFindRequest>();
-	FAeonixPathFindRequest* RequestPtr = Request.Get();
+	if (!NavVolume)
+	{
+		return false;
+	}
+
+	const FVector StartPosition = NavigationComponent->GetPathfindingStartPosition();
+
+	AeonixLink StartNavLink;
+	AeonixLink TargetNavLink;
+	if (!GetNavigableLink(*NavVolume, StartPosition, StartNavLink))
+	{
+		UE_LOG(LogAeonixNavigation, Error, TEXT("Path finder failed to find start nav link"));
+		return false;
+	}
+
+	FVector EndPosition;
+	if (!GetNavigableLink(*NavVolume, NavigationComponent->GetPathfindingEndPosition(End), TargetNavLink, EndPosition))
+	{
+		UE_LOG(LogAeonixNavigation, Error, TEXT("Path finder failed to find target nav link"));
+		return false;
+	}
+
+	OutPath.ResetForRepath();
+
+	bool Result;
+	{
+		FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+		SCOPE_CYCLE_COUNTER(STAT_AeonixPathfindingSync);
+
+		// No connectivity early out here, a failed search keeps its state and repairing it is how we find out the target became reachable again
+		AeonixPathFinder pathFinder(NavVolume->GetNavData(), NavigationComponent->PathfinderSettings);
+		Result = pathFinder.FindPathIncremental(IoSearch, StartNavLink, TargetNavLink, StartPosition, EndPosition, OutPath);
+	}
+
+	if (Result)
+	{
+		TrackPathRegions(OutPath, NavVolume);
+	}
+
+	UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Incremental %s expanded %d nodes"), IoSearch.WasLastSearchRepair() ? TEXT("repair") : TEXT("search"), IoSearch.GetLastExpansions());
+
+	OutPath.SetIsReady(true);
+	return Result;
+}
+
+FAeonixPathFindRequestCompleteDelegate& UAeonixSubsystem::FindPathIncrementalAsyncAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, const TSharedRef<FAeonixIncrementalSearch>& Search, FAeonixNavigationPath& OutPath)
+{
+	TUniquePtr<FAeonixPathFindRequest> Request = MakeUnique<FAeonixPathFindRequest>();
+	FAeonixPathFindRequest* RequestPtr = Request.Get();
+
+	RequestPtr->SubmitTime = FPlatformTime::Seconds();
+	RequestPtr->RequestingAgent = NavigationComponent;
+	RequestPtr->Priority = EAeonixRequestPriority::Normal;
+	RequestPtr->IncrementalSearch = Search;
+
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForAgent(NavigationComponent);
+	const FVector StartPosition = NavigationComponent->GetPathfindingStartPosition();
+
+	AeonixLink StartNavLink;
+	AeonixLink TargetNavLink;
+	FVector EndPosition;
+	if (!NavVolume
+		|| !GetNavigableLink(*NavVolume, StartPosition, StartNavLink)
+		|| !GetNavigableLink(*NavVolume, NavigationComponent->GetPathfindingEndPosition(End), TargetNavLink, EndPosition))
+	{
+		UE_LOG(LogAeonixNavigation, Error, TEXT("Incremental path finder failed to find a volume or nav links for the agent"));
+		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Failed);
+		LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+
+		FScopeLock Lock(&PathRequestsLock);
+		PathRequests.Add(MoveTemp(Request));
+		return RequestPtr->OnPathFindRequestComplete;
+	}
+
+	if (WorkerPool.GetNumWorkers() == 0)
+	{
+		// The search state can't be sliced, with no workers it has to run here
+		const bool bPathFound = FindPathIncrementalAgent(NavigationComponent, End, *Search, OutPath);
+		RequestPtr->PathFindPromise.SetValue(bPathFound ? EAeonixPathFindStatus::Complete : EAeonixPathFindStatus::Failed);
+		if (bPathFound)
+		{
+			LoadMetrics.CompletedPathfindsTotal.fetch_add(1);
+		}
+		else
+		{
+			LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+		}
+
+		FScopeLock Lock(&PathRequestsLock);
+		PathRequests.Add(MoveTemp(Request));
+		return RequestPtr->OnPathFindRequestComplete;
+	}
+
+	// No connectivity early out, as with FindPathIncrementalAgent
+	TArray<AeonixLink> GoalLinks{ TargetNavLink };
+	TArray<FVector> GoalPositions{ EndPosition };
+	return DispatchPathfindRequest(MoveTemp(Request), NavVolume, NavigationComponent->PathfinderSettings, StartNavLink,
+		StartPosition, MoveTemp(GoalLinks), MoveTemp(GoalPositions), OutPath);
+}
+
+FAeonixPathFindRequestCompleteDelegate& UAeonixSubsystem::FindPathAsyncAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, FAeonixNavigationPath& OutPath)
+{
+	return RequestPathAgent(NavigationComponent, NavigationComponent->GetPathfindingStartPosition(), End, OutPath, false);
+}
+
+FAeonixPathFindRequestCompleteDelegate& UAeonixSubsystem::FindPathTimeSlicedAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, FAeonixNavigationPath& OutPath)
+{
+	return RequestPathAgent(NavigationComponent, NavigationComponent->GetPathfindingStartPosition(), End, OutPath, true);
+}
+
+FAeonixPathFindRequestCompleteDelegate& UAeonixSubsystem::FindPathFromAsyncAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& Start, const FVector& End, FAeonixNavigationPath& OutPath)
+{
+	return RequestPathAgent(NavigationComponent, Start, End, OutPath, false);
+}
+
+void UAeonixSubsystem::CancelPathRequests(const FAeonixNavigationPath& Path)
+{
+	FScopeLock Lock(&PathRequestsLock);
+	for (TUniquePtr<FAeonixPathFindRequest>& Request : PathRequests)
+	{
+		if (Request->DestinationPath == &Path)
+		{
+			// Workers see this through IsStale, and with no destination a result that's already in is dropped
+			Request->bCancelled = true;
+			Request->DestinationPath = nullptr;
+			Request->OnPathFindRequestComplete.Unbind();
+		}
+	}
+}
+
+FAeonixPathFindRequestCompleteDelegate& UAeonixSubsystem::RequestPathAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& Start, const FVector& End, FAeonixNavigationPath& OutPath, bool bTimeSliced)
+{
+	AeonixLink StartNavLink;
+	AeonixLink TargetNavLink;
+
+	// Create request with enhanced metadata
+	TUniquePtr<FAeonixPathFindRequest> Request = MakeUnique<FAeonixPathFindRequest>();
+	FAeonixPathFindRequest* RequestPtr = Request.Get();
+
+	// Set request metadata
+	RequestPtr->SubmitTime = FPlatformTime::Seconds();
+	RequestPtr->RequestingAgent = NavigationComponent;
+	RequestPtr->Priority = EAeonixRequestPriority::Normal; // Can be customized per agent
+	RequestPtr->bTimeSliced = bTimeSliced;
+
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForAgent(NavigationComponent);
+
+	if (!NavVolume)
+	{
+		UE_LOG(LogAeonixNavigation, Error, TEXT("Nav Agent Not In A Volume"));
+		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Failed);
+		LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+
+		// Add to requests array so we can return the delegate
+		FScopeLock Lock(&PathRequestsLock);
+		PathRequests.Add(MoveTemp(Request));
+		return RequestPtr->OnPathFindRequestComplete;
+	}
+
+	// Get the nav link from our volume
+	if (!GetNavigableLink(*NavVolume, Start, StartNavLink))
+	{
+		UE_LOG(LogAeonixNavigation, Error, TEXT("Path finder failed to find start nav link"));
+		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Failed);
+		LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+
+		FScopeLock Lock(&PathRequestsLock);
+		PathRequests.Add(MoveTemp(Request));
+		return RequestPtr->OnPathFindRequestComplete;
+	}
+
+	FVector EndPosition;
+	if (!GetNavigableLink(*NavVolume, NavigationComponent->GetPathfindingEndPosition(End), TargetNavLink, EndPosition))
+	{
+		UE_LOG(LogAeonixNavigation, Error, TEXT("Path finder failed to find target nav link"));
+		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Failed);
+		LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+
+		FScopeLock Lock(&PathRequestsLock);
+		PathRequests.Add(MoveTemp(Request));
+		return RequestPtr->OnPathFindRequestComplete;
+	}
+
+	// Start and target in different connected components can never be joined, fail before taking up a worker
+	bool bReachable;
+	{
+		FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+		bReachable = NavVolume->GetNavData().AreLinksConnected(StartNavLink, TargetNavLink);
+	}
+
+	if (!bReachable)
+	{
+		UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Target is not reachable from start, rejected without searching"));
+		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Failed);
+		LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+		LoadMetrics.UnreachableRejectedTotal.fetch_add(1);
+
+		FScopeLock Lock(&PathRequestsLock);
+		PathRequests.Add(MoveTemp(Request));
+		return RequestPtr->OnPathFindRequestComplete;
+	}
+
+	if (TargetNavLink == StartNavLink)
+	{
+		// Same voxel - create direct path with start and end points
+		OutPath.ResetForRepath();
+
+		OutPath.AddPoint(FAeonixPathPoint(Start, StartNavLink.GetLayerIndex()));
+		OutPath.AddPoint(FAeonixPathPoint(EndPosition, StartNavLink.GetLayerIndex()));
+
+		OutPath.SetIsReady(true);
+		UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Same voxel path - direct path with 2 points"));
+		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Complete);
+		LoadMetrics.CompletedPathfindsTotal.fetch_add(1);
+
+		FScopeLock Lock(&PathRequestsLock);
+		PathRequests.Add(MoveTemp(Request));
+		return RequestPtr->OnPathFindRequestComplete;
+	}
+
+	FAeonixPathCacheKey CacheKey;
+	const bool bUseCache = MakePathCacheKey(NavVolume, StartNavLink, TargetNavLink, NavigationComponent->PathfinderSettings, CacheKey);
+	if (bUseCache && FindCachedPath(CacheKey, NavVolume, Start, EndPosition, OutPath))
+	{
+		OutPath.SetIsReady(true);
+		UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Cached path with %d points, marked as ready"), OutPath.GetPathPoints().Num());
+		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Complete);
+		LoadMetrics.CompletedPathfindsTotal.fetch_add(1);
+
+		FScopeLock Lock(&PathRequestsLock);
+		PathRequests.Add(MoveTemp(Request));
+		return RequestPtr->OnPathFindRequestComplete;
+	}
+
+	// Remember what to cache once the path is delivered
+	if (bUseCache)
+	{
+		RequestPtr->PathCacheKey = CacheKey;
+		RequestPtr->PathCacheGenerationId = NavVolume->GetNavData().GetGenerationId();
+		RequestPtr->bAddToPathCache = true;
+	}
+
+	TArray<AeonixLink> GoalLinks{ TargetNavLink };
+	TArray<FVector> GoalPositions{ EndPosition };
+	return DispatchPathfindRequest(MoveTemp(Request), NavVolume, NavigationComponent->PathfinderSettings, StartNavLink,
+		Start, MoveTemp(GoalLinks), MoveTemp(GoalPositions), OutPath);
+}
+
+bool UAeonixSubsystem::GetNavigableLink(const AAeonixBoundingVolume& NavVolume, const FVector& Position, AeonixLink& OutLink) const
+{
+	FReadScopeLock ReadLock(NavVolume.GetOctreeDataLock());
+	return AeonixMediator::GetNavigableLinkFromPosition(Position, NavVolume, OutLink);
+}
+
+bool UAeonixSubsystem::GetNavigableLink(const AAeonixBoundingVolume& NavVolume, const FVector& Position, AeonixLink& OutLink, FVector& OutPosition) const
+{
+	FReadScopeLock ReadLock(NavVolume.GetOctreeDataLock());
+	return AeonixMediator::GetNavigableLinkFromPosition(Position, NavVolume, OutLink, OutPosition);
+}
+
+bool UAeonixSubsystem::ResolveGoalLinks(const AAeonixBoundingVolume* NavVolume, UAeonixNavAgentComponent* NavigationComponent, const AeonixLink& StartNavLink, const TArray<FVector>& Ends,
+	TArray<AeonixLink>& OutGoalLinks, TArray<FVector>& OutGoalPositions, TArray<int32>& OutGoalIndices)
+{
+	OutGoalLinks.Reset(Ends.Num());
+	OutGoalPositions.Reset(Ends.Num());
+	OutGoalIndices.Reset(Ends.Num());
+
+	FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+	const FAeonixData& NavData = NavVolume->GetNavData();
+
+	bool bAnyUnreachable = false;
+	for (int32 EndIndex = 0; EndIndex < Ends.Num(); ++EndIndex)
+	{
+		AeonixLink GoalLink;
+		FVector EndPosition;
+		if (!AeonixMediator::GetNavigableLinkFromPosition(NavigationComponent->GetPathfindingEndPosition(Ends[EndIndex]), *NavVolume, GoalLink, EndPosition))
+		{
+			UE_LOG(LogAeonixNavigation, Verbose, TEXT("AeonixSubsystem: Goal %d has no nav link, skipping"), EndIndex);
+			continue;
+		}
+
+		// Goals in another component would only make the search exhaust the start's component
+		if (!NavData.AreLinksConnected(StartNavLink, GoalLink))
+		{
+			bAnyUnreachable = true;
+			continue;
+		}
+
+		OutGoalLinks.Add(GoalLink);
+		OutGoalPositions.Add(EndPosition);
+		OutGoalIndices.Add(EndIndex);
+	}
+
+	if (OutGoalLinks.IsEmpty() && bAnyUnreachable)
+	{
+		UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: No goal is reachable from start, rejected without searching"));
+		LoadMetrics.UnreachableRejectedTotal.fetch_add(1);
+	}
+
+	return !OutGoalLinks.IsEmpty();
+}
+
+bool UAeonixSubsystem::FindPathToNearestImmediateAgent(UAeonixNavAgentComponent* NavigationComponent, const TArray<FVector>& Ends, FAeonixNavigationPath& OutPath, int32& OutGoalIndex)
+{
+	OutGoalIndex = INDEX_NONE;
+
+	if (Ends.Num() == 1)
+	{
+		const bool bResult = FindPathImmediateAgent(NavigationComponent, Ends[0], OutPath);
+		OutGoalIndex = bResult && !OutPath.IsPartial() ? 0 : INDEX_NONE;
+		return bResult;
+	}
+
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForAgent(NavigationComponent);
+
+	if (!NavVolume)
+	{
+		return false;
+	}
+
+	AeonixLink StartNavLink;
+	if (!GetNavigableLink(*NavVolume, NavigationComponent->GetPathfindingStartPosition(), StartNavLink))
+	{
+		UE_LOG(LogAeonixNavigation, Error, TEXT("Path finder failed to find start nav link"));
+		return false;
+	}
+
+	TArray<AeonixLink> GoalLinks;
+	TArray<FVector> GoalPositions;
+	TArray<int32> GoalIndices;
+	if (!ResolveGoalLinks(NavVolume, NavigationComponent, StartNavLink, Ends, GoalLinks, GoalPositions, GoalIndices))
+	{
+		UE_LOG(LogAeonixNavigation, Error, TEXT("Path finder failed to find any reachable target nav link"));
+		return false;
+	}
+
+	OutPath.ResetForRepath();
+
+	bool Result;
+	int32 GoalIndex = INDEX_NONE;
+	{
+		FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+		SCOPE_CYCLE_COUNTER(STAT_AeonixPathfindingSync);
+
+		AeonixPathFinder pathFinder(NavVolume->GetNavData(), NavigationComponent->PathfinderSettings);
+		Result = pathFinder.FindPathToNearestGoal(StartNavLink, GoalLinks, NavigationComponent->GetPathfindingStartPosition(), GoalPositions, OutPath, GoalIndex);
+	}
+
+	if (Result)
+	{
+		TrackPathRegions(OutPath, NavVolume);
+		// A partial path didn't reach any of them
+		OutGoalIndex = GoalIndices.IsValidIndex(GoalIndex) ? GoalIndices[GoalIndex] : INDEX_NONE;
+	}
+
+	OutPath.SetIsReady(true);
+	UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Path to nearest of %d goals found with %d points, marked as ready"), Ends.Num(), OutPath.GetPathPoints().Num());
+
+	return Result;
+}
+
+FAeonixPathFindRequestCompleteDelegate& UAeonixSubsystem::FindPathToNearestAsyncAgent(UAeonixNavAgentComponent* NavigationComponent, const TArray<FVector>& Ends, FAeonixNavigationPath& OutPath, int32& OutGoalIndex)
+{
+	OutGoalIndex = INDEX_NONE;
+
+	TUniquePtr<FAeonixPathFindRequest> Request = MakeUnique<FAeonixPathFindRequest>();
+	FAeonixPathFindRequest* RequestPtr = Request.Get();
+
+	RequestPtr->SubmitTime = FPlatformTime::Seconds();
+	RequestPtr->RequestingAgent = NavigationComponent;
+	RequestPtr->Priority = EAeonixRequestPriority::Normal;
+	RequestPtr->DestinationGoalIndex = &OutGoalIndex;
+
+	const AAeonixBoundingVolume* NavVolume = GetVolumeForAgent(NavigationComponent);
+
+	AeonixLink StartNavLink;
+	TArray<AeonixLink> GoalLinks;
+	TArray<FVector> GoalPositions;
+	if (!NavVolume
+		|| !GetNavigableLink(*NavVolume, NavigationComponent->GetPathfindingStartPosition(), StartNavLink)
+		|| !ResolveGoalLinks(NavVolume, NavigationComponent, StartNavLink, Ends, GoalLinks, GoalPositions, RequestPtr->RequestedGoalIndices))
+	{
+		UE_LOG(LogAeonixNavigation, Error, TEXT("Path finder failed to find start or any reachable target nav link"));
+		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Failed);
+		LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+
+		FScopeLock Lock(&PathRequestsLock);
+		PathRequests.Add(MoveTemp(Request));
+		return RequestPtr->OnPathFindRequestComplete;
+	}
+
+	const int32 StartGoal = GoalLinks.Find(StartNavLink);
+	if (StartGoal != INDEX_NONE)
+	{
+		// A goal shares the start voxel, nothing can be nearer
+		OutPath.ResetForRepath();
+		OutPath.AddPoint(FAeonixPathPoint(NavigationComponent->GetPathfindingStartPosition(), StartNavLink.GetLayerIndex()));
+		OutPath.AddPoint(FAeonixPathPoint(GoalPositions[StartGoal], StartNavLink.GetLayerIndex()));
+		OutPath.SetIsReady(true);
+		OutGoalIndex = RequestPtr->RequestedGoalIndices[StartGoal];
+
+		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Complete);
+		LoadMetrics.CompletedPathfindsTotal.fetch_add(1);
+
+		FScopeLock Lock(&PathRequestsLock);
+		PathRequests.Add(MoveTemp(Request));
+		return RequestPtr->OnPathFindRequestComplete;
+	}
+
+	return DispatchPathfindRequest(MoveTemp(Request), NavVolume, NavigationComponent->PathfinderSettings, StartNavLink,
+		NavigationComponent->GetPathfindingStartPosition(), MoveTemp(GoalLinks), MoveTemp(GoalPositions), OutPath);
+}
+
+void UAeonixSubsystem::FindPathBatchAsyncAgents(const TArray<FAeonixBatchPathRequest>& Requests, TArray<FAeonixPathFindRequestCompleteDelegate*>& OutDelegates, bool bParallel)
+{
+	OutDelegates.Reset(Requests.Num());
+
+	// Handed to PathRequests together at the end, so the request lock is only taken once
+	TArray<TUniquePtr<FAeonixPathFindRequest>> NewRequests;
+	NewRequests.Reserve(Requests.Num());
+
+	auto FailRequest = [this](FAeonixPathFindRequest* RequestPtr)
+	{
+		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Failed);
+		LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+	};
+
+	auto CompleteRequest = [this](FAeonixPathFindRequest* RequestPtr)
+	{
+		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Complete);
+		LoadMetrics.CompletedPathfindsTotal.fetch_add(1);
+	};
+
+	// Agents in a batch mostly share their settings, so each distinct set is copied once. The hash only narrows it down, the settings must match in full
+	TArray<TSharedPtr<const FAeonixPathFinderSettings>, TInlineAllocator<4>> SharedSettings;
+	TArray<uint32, TInlineAllocator<4>> SharedSettingsHashes;
+	auto ShareSettings = [&SharedSettings, &SharedSettingsHashes](const FAeonixPathFinderSettings& Settings)
+	{
+		const uint32 Hash = GetTypeHash(Settings);
+		for (int32 Index = 0; Index < SharedSettings.Num(); ++Index)
+		{
+			if (SharedSettingsHashes[Index] == Hash && *SharedSettings[Index] == Settings)
+			{
+				return SharedSettings[Index];
+			}
+		}
+
+		SharedSettingsHashes.Add(Hash);
+		return SharedSettings.Add_GetRef(MakeShared<const FAeonixPathFinderSettings>(Settings));
+	};
+
+	// Resolve every request's links first, grouping the searches by volume
+	TMap<const AAeonixBoundingVolume*, TArray<FAeonixBatchPathfind>> VolumePathfinds;
+	for (int32 RequestIndex = 0; RequestIndex < Requests.Num(); ++RequestIndex)
+	{
+		const FAeonixBatchPathRequest& BatchRequest = Requests[RequestIndex];
+		UAeonixNavAgentComponent* NavigationComponent = BatchRequest.NavigationComponent;
+
+		FAeonixPathFindRequest* RequestPtr = NewRequests.Add_GetRef(MakeUnique<FAeonixPathFindRequest>()).Get();
+		RequestPtr->SubmitTime = FPlatformTime::Seconds();
+		RequestPtr->RequestingAgent = NavigationComponent;
+		RequestPtr->Priority = EAeonixRequestPriority::Normal;
+		OutDelegates.Add(&RequestPtr->OnPathFindRequestComplete);
+
+		const AAeonixBoundingVolume* NavVolume = NavigationComponent ? GetVolumeForAgent(NavigationComponent) : nullptr;
+		if (!NavVolume || !BatchRequest.OutPath)
+		{
+			UE_LOG(LogAeonixNavigation, Error, TEXT("AeonixSubsystem: Batch request %d has no nav volume or no path to fill"), RequestIndex);
+			FailRequest(RequestPtr);
+			continue;
+		}
+
+		FAeonixBatchPathfind Pathfind;
+		Pathfind.Request = RequestPtr;
+		Pathfind.StartPosition = NavigationComponent->GetPathfindingStartPosition();
+
+		AeonixLink GoalLink;
+		FVector EndPosition;
+		bool bFoundLinks;
+		{
+			FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+			bFoundLinks = AeonixMediator::GetNavigableLinkFromPosition(Pathfind.StartPosition, *NavVolume, Pathfind.StartLink)
+				&& AeonixMediator::GetNavigableLinkFromPosition(NavigationComponent->GetPathfindingEndPosition(BatchRequest.End), *NavVolume, GoalLink, EndPosition);
+		}
+
+		if (!bFoundLinks)
+		{
+			UE_LOG(LogAeonixNavigation, Error, TEXT("Path finder failed to find start or target nav link for batch request %d"), RequestIndex);
+			FailRequest(RequestPtr);
+			continue;
+		}
+
+		RequestPtr->DestinationPath = BatchRequest.OutPath;
+		Pathfind.Settings = ShareSettings(NavigationComponent->PathfinderSettings);
+		Pathfind.GoalLinks.Add(GoalLink);
+		Pathfind.GoalPositions.Add(EndPosition);
+		VolumePathfinds.FindOrAdd(NavVolume).Add(MoveTemp(Pathfind));
+	}
+
+	TWeakObjectPtr<UAeonixSubsystem> WeakSubsystem = this;
+
+	for (TPair<const AAeonixBoundingVolume*, TArray<FAeonixBatchPathfind>>& VolumeBatch : VolumePathfinds)
+	{
+		const AAeonixBoundingVolume* NavVolume = VolumeBatch.Key;
+		TArray<FAeonixBatchPathfind>& Pathfinds = VolumeBatch.Value;
+
+		// Start and target in different connected components can never be joined, one lock covers the check for the whole batch
+		TBitArray<> Reachable(false, Pathfinds.Num());
+		{
+			FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+			const FAeonixData& NavData = NavVolume->GetNavData();
+			for (int32 Index = 0; Index < Pathfinds.Num(); ++Index)
+			{
+				Reachable[Index] = NavData.AreLinksConnected(Pathfinds[Index].StartLink, Pathfinds[Index].GoalLinks[0]);
+			}
+		}
+
+		// Region versions belong to the volume, so one snapshot covers every search in it
+		TMap<FGuid, uint32> CapturedRegionVersions;
+		for (const auto& RegionPair : NavVolume->GenerationParameters.DynamicRegionBoxes)
+		{
+			CapturedRegionVersions.Add(RegionPair.Key, GetRegionVersion(RegionPair.Key));
+		}
+
+		TArray<FAeonixBatchPathfind> WorkerPathfinds;
+		WorkerPathfinds.Reserve(Pathfinds.Num());
+		for (int32 Index = 0; Index < Pathfinds.Num(); ++Index)
+		{
+			FAeonixBatchPathfind& Pathfind = Pathfinds[Index];
+			FAeonixPathFindRequest* RequestPtr = Pathfind.Request;
+			FAeonixNavigationPath& OutPath = *RequestPtr->DestinationPath;
+
+			if (!Reachable[Index])
+			{
+				UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Target is not reachable from start, rejected without searching"));
+				LoadMetrics.UnreachableRejectedTotal.fetch_add(1);
+				FailRequest(RequestPtr);
+				continue;
+			}
+
+			if (Pathfind.GoalLinks[0] == Pathfind.StartLink)
+			{
+				// Same voxel - direct path with start and end points
+				OutPath.ResetForRepath();
+				OutPath.AddPoint(FAeonixPathPoint(Pathfind.StartPosition, Pathfind.StartLink.GetLayerIndex()));
+				OutPath.AddPoint(FAeonixPathPoint(Pathfind.GoalPositions[0], Pathfind.StartLink.GetLayerIndex()));
+				OutPath.SetIsReady(true);
+				CompleteRequest(RequestPtr);
+				continue;
+			}
+
+			FAeonixPathCacheKey CacheKey;
+			if (MakePathCacheKey(NavVolume, Pathfind.StartLink, Pathfind.GoalLinks[0], *Pathfind.Settings, CacheKey))
+			{
+				if (FindCachedPath(CacheKey, NavVolume, Pathfind.StartPosition, Pathfind.GoalPositions[0], OutPath))
+				{
+					OutPath.SetIsReady(true);
+					CompleteRequest(RequestPtr);
+					continue;
+				}
+
+				RequestPtr->PathCacheKey = CacheKey;
+				RequestPtr->PathCacheGenerationId = NavVolume->GetNavData().GetGenerationId();
+				RequestPtr->bAddToPathCache = true;
+			}
+
+			OutPath.ResetForRepath();
+			OutPath.SetIsReady(false);
+			RequestPtr->RegionVersionSnapshot = CapturedRegionVersions;
+
+			if (WorkerPool.GetNumWorkers() == 0)
+			{
+				// No workers to batch onto, fall back to time slicing as single requests do
+				LoadMetrics.ActivePathfinds.fetch_add(1);
+				RequestPtr->bTimeSliced = true;
+
+				TUniquePtr<FAeonixSlicedPathfind> SlicedPathfind = MakeUnique<FAeonixSlicedPathfind>();
+				SlicedPathfind->Request = RequestPtr;
+				SlicedPathfind->NavVolume = NavVolume;
+				SlicedPathfind->Settings = *Pathfind.Settings;
+				SlicedPathfind->StartLink = Pathfind.StartLink;
+				SlicedPathfind->StartPosition = Pathfind.StartPosition;
+				SlicedPathfind->GoalLinks = MoveTemp(Pathfind.GoalLinks);
+				SlicedPathfind->GoalPositions = MoveTemp(Pathfind.GoalPositions);
+				SlicedPathfinds.Add(MoveTemp(SlicedPathfind));
+				continue;
+			}
+
+			WorkerPathfinds.Add(MoveTemp(Pathfind));
+		}
+
+		if (WorkerPathfinds.IsEmpty())
+		{
+			continue;
+		}
+
+		LoadMetrics.PendingPathfinds.fetch_add(WorkerPathfinds.Num());
+
+		const int32 NumJobs = bParallel ? FMath::Clamp(WorkerPool.GetNumWorkers(), 1, WorkerPathfinds.Num()) : 1;
+		const int32 JobSize = FMath::DivideAndRoundUp(WorkerPathfinds.Num(), NumJobs);
+		TWeakObjectPtr<const AAeonixBoundingVolume> WeakNavVolume = NavVolume;
+
+		for (int32 First = 0; First < WorkerPathfinds.Num(); First += JobSize)
+		{
+			TArray<FAeonixBatchPathfind> JobPathfinds;
+			JobPathfinds.Reserve(FMath::Min(JobSize, WorkerPathfinds.Num() - First));
+			for (int32 Index = First; Index < First + JobSize && Index < WorkerPathfinds.Num(); ++Index)
+			{
+				JobPathfinds.Add(MoveTemp(WorkerPathfinds[Index]));
+			}
+
+			WorkerPool.EnqueueWork([WeakNavVolume, WeakSubsystem, JobPathfinds = MoveTemp(JobPathfinds), CapturedRegionVersions]()
+			{
+				SCOPE_CYCLE_COUNTER(STAT_AeonixPathfindingBatch);
 
-	// Set request metadata
-	RequestPtr->SubmitTime = FPlatformTime::Seconds();
-	RequestPtr->RequestingAgent = NavigationComponent;
-	RequestPtr->Priority = EAeonixRequestPriority::Normal; // Can be customized per agent
+				UAeonixSubsystem* Subsystem = WeakSubsystem.Get();
 
-	const AAeonixBoundingVolume* NavVolume = GetVolumeForAgent(NavigationComponent);
+				const AAeonixBoundingVolume* NavVolume = WeakNavVolume.Get();
+				if (!NavVolume)
+				{
+					UE_LOG(LogAeonixNavigation, Warning, TEXT("AeonixSubsystem: Nav volume destroyed during batched async pathfinding"));
+					for (const FAeonixBatchPathfind& Pathfind : JobPathfinds)
+					{
+						Pathfind.Request->PathFindPromise.SetValue(EAeonixPathFindStatus::Failed);
+					}
 
-	if (!NavVolume)
-	{
-		UE_LOG(LogAeonixNavigation, Error, TEXT("Nav Agent Not In A Volume"));
-		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Failed);
-		LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+					if (Subsystem)
+					{
+						Subsystem->LoadMetrics.PendingPathfinds.fetch_sub(JobPathfinds.Num());
+						Subsystem->LoadMetrics.FailedPathfindsTotal.fetch_add(JobPathfinds.Num());
+					}
+					return;
+				}
 
-		// Add to requests array so we can return the delegate
-		FScopeLock Lock(&PathRequestsLock);
-		PathRequests.Add(MoveTemp(Request));
-		return RequestPtr->OnPathFindRequestComplete;
-	}
+				// A pathfinder for each distinct settings, reused by every search with them so its containers are only allocated once per job.
+				// Settings were made unique on the game thread, so the shared copy identifies them
+				TArray<TPair<const FAeonixPathFinderSettings*, TUniquePtr<AeonixPathFinder>>, TInlineAllocator<2>> PathFinders;
 
-	// Get the nav link from our volume
-	if (!AeonixMediator::GetLinkFromPosition(NavigationComponent->GetPathfindingStartPosition(), *NavVolume, StartNavLink))
-	{
-		UE_LOG(LogAeonixNavigation, Error, TEXT("Path finder failed to find start nav link"));
-		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Failed);
-		LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+				for (const FAeonixBatchPathfind& Pathfind : JobPathfinds)
+				{
+					const double StartTime = FPlatformTime::Seconds();
 
-		FScopeLock Lock(&PathRequestsLock);
-		PathRequests.Add(MoveTemp(Request));
-		return RequestPtr->OnPathFindRequestComplete;
-	}
+					if (Pathfind.Request->IsStale())
+					{
+						Pathfind.Request->PathFindPromise.SetValue(EAeonixPathFindStatus::Cancelled);
 
-	if (!AeonixMediator::GetLinkFromPosition(NavigationComponent->GetPathfindingEndPosition(End), *NavVolume, TargetNavLink))
-	{
-		UE_LOG(LogAeonixNavigation, Error, TEXT("Path finder failed to find target nav link"));
-		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Failed);
-		LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+						if (Subsystem)
+						{
+							Subsystem->LoadMetrics.PendingPathfinds.fetch_sub(1);
+							Subsystem->LoadMetrics.CancelledPathfindsTotal.fetch_add(1);
+						}
+						continue;
+					}
 
-		FScopeLock Lock(&PathRequestsLock);
-		PathRequests.Add(MoveTemp(Request));
-		return RequestPtr->OnPathFindRequestComplete;
-	}
+					if (Subsystem)
+					{
+						Subsystem->LoadMetrics.PendingPathfinds.fetch_sub(1);
+						Subsystem->LoadMetrics.ActivePathfinds.fetch_add(1);
+					}
 
-	if (TargetNavLink == StartNavLink)
-	{
-		// Same voxel - create direct path with start and end points
-		OutPath.ResetForRepath();
+					const FAeonixPathFinderSettings* Settings = Pathfind.Settings.Get();
+					TPair<const FAeonixPathFinderSettings*, TUniquePtr<AeonixPathFinder>>* PathFinder = PathFinders.FindByPredicate([Settings](const TPair<const FAeonixPathFinderSettings*, TUniquePtr<AeonixPathFinder>>& Entry) { return Entry.Key == Settings; });
+					if (!PathFinder)
+					{
+						// References the shared settings, which live as long as the job
+						PathFinder = &PathFinders.Emplace_GetRef(Settings, MakeUnique<AeonixPathFinder>(NavVolume->GetNavData(), *Settings));
+					}
 
-		FVector StartPosition = NavigationComponent->GetPathfindingStartPosition();
-		FVector EndPosition = NavigationComponent->GetPathfindingEndPosition(End);
+					// Locked per search rather than for the whole job, so a regen waits for one search at most
+					FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+					RunWorkerPathfind(WeakSubsystem, *PathFinder->Value, Pathfind.Request, Pathfind.StartLink, Pathfind.StartPosition, Pathfind.GoalLinks, Pathfind.GoalPositions, CapturedRegionVersions, StartTime);
 
-		OutPath.AddPoint(FAeonixPathPoint(StartPosition, StartNavLink.GetLayerIndex()));
-		OutPath.AddPoint(FAeonixPathPoint(EndPosition, StartNavLink.GetLayerIndex()));
+					if (Subsystem)
+					{
+						Subsystem->LoadMetrics.ActivePathfinds.fetch_sub(1);
+					}
+				}
+			});
+		}
 
-		OutPath.SetIsReady(true);
-		UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Same voxel path - direct path with 2 points"));
-		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Complete);
-		LoadMetrics.CompletedPathfindsTotal.fetch_add(1);
+		UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Batched %d searches into %d worker job(s)"), WorkerPathfinds.Num(), FMath::DivideAndRoundUp(WorkerPathfinds.Num(), JobSize));
+	}
 
-		FScopeLock Lock(&PathRequestsLock);
+	FScopeLock Lock(&PathRequestsLock);
+	for (TUniquePtr<FAeonixPathFindRequest>& Request : NewRequests)
+	{
 		PathRequests.Add(MoveTemp(Request));
-		return RequestPtr->OnPathFindRequestComplete;
 	}
+}
+
+FAeonixPathFindRequestCompleteDelegate& UAeonixSubsystem::DispatchPathfindRequest(TUniquePtr<FAeonixPathFindRequest>&& Request, const AAeonixBoundingVolume* NavVolume, const FAeonixPathFinderSettings& PathfinderSettings,
+	const AeonixLink& StartNavLink, const FVector& StartPosition, TArray<AeonixLink>&& GoalLinks, TArray<FVector>&& GoalPositions, FAeonixNavigationPath& OutPath)
+{
+	FAeonixPathFindRequest* RequestPtr = Request.Get();
 
 	// Make sure the path isn't flagged ready
 	OutPath.ResetForRepath();
@@ -442,9 +1567,7 @@ FAeonixPathFindRequestCompleteDelegate& UAeonixSubsystem::FindPathAsyncAgent(UAe
 	// Copy necessary data to avoid dangling references in async task
 	TWeakObjectPtr<const AAeonixBoundingVolume> WeakNavVolume = NavVolume;
 	TWeakObjectPtr<UAeonixSubsystem> WeakSubsystem = this;
-	FAeonixPathFinderSettings PathfinderSettingsCopy = NavigationComponent->PathfinderSettings;
-	FVector StartPosition = NavigationComponent->GetPathfindingStartPosition();
-	FVector EndPosition = NavigationComponent->GetPathfindingEndPosition(End);
+	FAeonixPathFinderSettings PathfinderSettingsCopy = PathfinderSettings;
 
 	// Capture region versions BEFORE pathfinding starts
 	// We'll validate these at the end to detect if regions were regenerated mid-calculation
@@ -455,13 +1578,35 @@ FAeonixPathFindRequestCompleteDelegate& UAeonixSubsystem::FindPathAsyncAgent(UAe
 		CapturedRegionVersions.Add(RegionPair.Key, GetRegionVersion(RegionPair.Key));
 	}
 
+	RequestPtr->RegionVersionSnapshot = CapturedRegionVersions;
+
+	if (RequestPtr->bTimeSliced || WorkerPool.GetNumWorkers() == 0)
+	{
+		LoadMetrics.ActivePathfinds.fetch_add(1);
+
+		// Searched a slice at a time by UpdateSlicedPathfinds, so the game thread never pays for more than the frame's budget
+		TUniquePtr<FAeonixSlicedPathfind> Pathfind = MakeUnique<FAeonixSlicedPathfind>();
+		Pathfind->Request = RequestPtr;
+		Pathfind->NavVolume = NavVolume;
+		Pathfind->Settings = PathfinderSettings;
+		Pathfind->StartLink = StartNavLink;
+		Pathfind->StartPosition = StartPosition;
+		Pathfind->GoalLinks = MoveTemp(GoalLinks);
+		Pathfind->GoalPositions = MoveTemp(GoalPositions);
+		SlicedPathfinds.Add(MoveTemp(Pathfind));
+
+		FScopeLock Lock(&PathRequestsLock);
+		PathRequests.Add(MoveTemp(Request));
+		return RequestPtr->OnPathFindRequestComplete;
+	}
+
 	// Update metrics
 	LoadMetrics.PendingPathfinds.fetch_add(1);
 
 	// Enqueue work to worker pool
 	// CRITICAL: No &OutPath capture - workers write to RequestPtr->WorkerPath instead
 	// Game thread will move results to DestinationPath in UpdateRequests()
-	WorkerPool.EnqueueWork([RequestPtr, WeakNavVolume, WeakSubsystem, PathfinderSettingsCopy, StartNavLink, TargetNavLink, StartPosition, EndPosition, CapturedRegionVersions]()
+	WorkerPool.EnqueueWork([RequestPtr, WeakNavVolume, WeakSubsystem, PathfinderSettingsCopy, StartNavLink, StartPosition, GoalLinks = MoveTemp(GoalLinks), GoalPositions = MoveTemp(GoalPositions), CapturedRegionVersions]()
 	{
 		SCOPE_CYCLE_COUNTER(STAT_AeonixPathfindingAsync);
 
@@ -506,106 +1651,132 @@ FAeonixPathFindRequestCompleteDelegate& UAeonixSubsystem::FindPathAsyncAgent(UAe
 		FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
 
 		AeonixPathFinder PathFinder(NavVolume->GetNavData(), PathfinderSettingsCopy);
+		RunWorkerPathfind(WeakSubsystem, PathFinder, RequestPtr, StartNavLink, StartPosition, GoalLinks, GoalPositions, CapturedRegionVersions, StartTime);
 
-		// Write to request-owned path (SAFE - survives component destruction)
-		RequestPtr->WorkerPath.ResetForRepath();
-		FAeonixPathFailureInfo FailureInfo;
-		if (PathFinder.FindPath(StartNavLink, TargetNavLink, StartPosition, EndPosition, RequestPtr->WorkerPath, &FailureInfo))
+		if (Subsystem)
 		{
-			// Validate that regions didn't change during pathfinding calculation
-			// If any region was regenerated while we were calculating, mark path as invalidated
-			bool bPathStale = false;
-			if (Subsystem)
-			{
-				for (const auto& RegionVersionPair : CapturedRegionVersions)
-				{
-					const uint32 CurrentVersion = Subsystem->GetRegionVersion(RegionVersionPair.Key);
-					if (CurrentVersion != RegionVersionPair.Value)
-					{
-						UE_LOG(LogAeonixNavigation, Warning,
-							TEXT("AeonixSubsystem: Path calculated with stale data - region %s changed from version %d to %d during pathfinding"),
-							*RegionVersionPair.Key.ToString(), RegionVersionPair.Value, CurrentVersion);
-						bPathStale = true;
-						break;
-					}
-				}
-			}
+			Subsystem->LoadMetrics.ActivePathfinds.fetch_sub(1);
+		}
+	});
 
-			if (bPathStale)
-			{
-				// Path was calculated based on outdated navigation data
-				RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Invalidated);
+	// Add to requests array
+	FScopeLock Lock(&PathRequestsLock);
+	PathRequests.Add(MoveTemp(Request));
+	return RequestPtr->OnPathFindRequestComplete;
+}
 
-				if (Subsystem)
-				{
-					Subsystem->LoadMetrics.CancelledPathfindsTotal.fetch_add(1);
-				}
+void UAeonixSubsystem::RunWorkerPathfind(const TWeakObjectPtr<UAeonixSubsystem>& WeakSubsystem, AeonixPathFinder& PathFinder, FAeonixPathFindRequest* RequestPtr, const AeonixLink& StartNavLink, const FVector& StartPosition,
+	const TArray<AeonixLink>& GoalLinks, const TArray<FVector>& GoalPositions, const TMap<FGuid, uint32>& CapturedRegionVersions, double StartTime)
+{
+	UAeonixSubsystem* Subsystem = WeakSubsystem.Get();
 
-				UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Async path invalidated (region changed during calculation)"));
-			}
-			else
-			{
-				// Path is valid - signal ready for game thread delivery
-				RequestPtr->bPathReady.store(true, std::memory_order_release);
-				UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Async path found with %d points"), RequestPtr->WorkerPath.GetPathPoints().Num());
+	// Write to request-owned path (SAFE - survives component destruction)
+	RequestPtr->WorkerPath.ResetForRepath();
+	FAeonixPathFailureInfo FailureInfo;
+	bool bPathFound;
+	if (RequestPtr->IncrementalSearch.IsValid())
+	{
+		FAeonixIncrementalSearch& Search = *RequestPtr->IncrementalSearch;
+		bPathFound = PathFinder.FindPathIncremental(Search, StartNavLink, GoalLinks[0], StartPosition, GoalPositions[0], RequestPtr->WorkerPath);
+		RequestPtr->WorkerGoalIndex = 0;
 
-				RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Complete);
+		UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Async incremental %s expanded %d nodes"), Search.WasLastSearchRepair() ? TEXT("repair") : TEXT("search"), Search.GetLastExpansions());
+	}
+	else if (GoalLinks.Num() == 1)
+	{
+		bPathFound = PathFinder.FindPath(StartNavLink, GoalLinks[0], StartPosition, GoalPositions[0], RequestPtr->WorkerPath, &FailureInfo);
+		RequestPtr->WorkerGoalIndex = RequestPtr->WorkerPath.IsPartial() ? INDEX_NONE : 0;
+	}
+	else
+	{
+		bPathFound = PathFinder.FindPathToNearestGoal(StartNavLink, GoalLinks, StartPosition, GoalPositions, RequestPtr->WorkerPath, RequestPtr->WorkerGoalIndex, &FailureInfo);
+	}
 
-				if (Subsystem)
+	if (bPathFound)
+	{
+		// Validate that regions didn't change during pathfinding calculation
+		// If any region was regenerated while we were calculating, mark path as invalidated
+		bool bPathStale = false;
+		if (Subsystem)
+		{
+			for (const auto& RegionVersionPair : CapturedRegionVersions)
+			{
+				const uint32 CurrentVersion = Subsystem->GetRegionVersion(RegionVersionPair.Key);
+				if (CurrentVersion != RegionVersionPair.Value)
 				{
-					Subsystem->LoadMetrics.CompletedPathfindsTotal.fetch_add(1);
-					const float ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0f;
-					Subsystem->LoadMetrics.UpdatePathfindTime(ElapsedMs);
+					UE_LOG(LogAeonixNavigation, Warning,
+						TEXT("AeonixSubsystem: Path calculated with stale data - region %s changed from version %d to %d during pathfinding"),
+						*RegionVersionPair.Key.ToString(), RegionVersionPair.Value, CurrentVersion);
+					bPathStale = true;
+					break;
 				}
 			}
 		}
-		else
+
+		if (bPathStale)
 		{
-			// Pathfinding failed
-			RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Failed);
+			// Path was calculated based on outdated navigation data
+			RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Invalidated);
 
 			if (Subsystem)
 			{
-				Subsystem->LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+				Subsystem->LoadMetrics.CancelledPathfindsTotal.fetch_add(1);
 			}
 
-			// Draw debug visualization if failed due to max iterations
-			if (FailureInfo.bFailedDueToMaxIterations)
-			{
-				// Queue debug visualization to game thread
-				AsyncTask(ENamedThreads::GameThread, [FailureInfo, WeakSubsystem]()
-				{
-					if (UAeonixSubsystem* Subsystem = WeakSubsystem.Get())
-					{
-						if (UWorld* World = Subsystem->GetWorld())
-						{
-							// Red line from start to target
-							DrawDebugLine(World, FailureInfo.StartPosition, FailureInfo.TargetPosition, FColor::Red, false, 10.0f, 0, 5.0f);
-
-							// Red sphere at start position
-							DrawDebugSphere(World, FailureInfo.StartPosition, 50.0f, 12, FColor::Red, false, 10.0f, 0, 3.0f);
+			UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Async path invalidated (region changed during calculation)"));
+		}
+		else
+		{
+			// Path is valid - signal ready for game thread delivery
+			RequestPtr->bPathReady.store(true, std::memory_order_release);
+			UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Async %s found with %d points"), RequestPtr->WorkerPath.IsPartial() ? TEXT("partial path") : TEXT("path"), RequestPtr->WorkerPath.GetPathPoints().Num());
 
-							// Magenta sphere at target position
-							DrawDebugSphere(World, FailureInfo.TargetPosition, 50.0f, 12, FColor::Magenta, false, 10.0f, 0, 3.0f);
+			RequestPtr->PathFindPromise.SetValue(RequestPtr->WorkerPath.IsPartial() ? EAeonixPathFindStatus::Partial : EAeonixPathFindStatus::Complete);
 
-							UE_LOG(LogAeonixNavigation, Warning, TEXT("Async pathfinding visualization: Max iterations (%d) reached. Distance: %.2f units. Check viewport for red line and spheres (10 sec duration)."),
-								FailureInfo.IterationCount, FailureInfo.StraightLineDistance);
-						}
-					}
-				});
+			if (Subsystem)
+			{
+				Subsystem->LoadMetrics.CompletedPathfindsTotal.fetch_add(1);
+				const float ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0f;
+				Subsystem->LoadMetrics.UpdatePathfindTime(ElapsedMs);
 			}
 		}
+	}
+	else
+	{
+		// Pathfinding failed
+		RequestPtr->PathFindPromise.SetValue(EAeonixPathFindStatus::Failed);
 
 		if (Subsystem)
 		{
-			Subsystem->LoadMetrics.ActivePathfinds.fetch_sub(1);
+			Subsystem->LoadMetrics.FailedPathfindsTotal.fetch_add(1);
 		}
-	});
 
-	// Add to requests array
-	FScopeLock Lock(&PathRequestsLock);
-	PathRequests.Add(MoveTemp(Request));
-	return RequestPtr->OnPathFindRequestComplete;
+		// Draw debug visualization if failed due to max iterations
+		if (FailureInfo.bFailedDueToMaxIterations)
+		{
+			// Queue debug visualization to game thread
+			AsyncTask(ENamedThreads::GameThread, [FailureInfo, WeakSubsystem]()
+			{
+				if (UAeonixSubsystem* Subsystem = WeakSubsystem.Get())
+				{
+					if (UWorld* World = Subsystem->GetWorld())
+					{
+						// Red line from start to target
+						DrawDebugLine(World, FailureInfo.StartPosition, FailureInfo.TargetPosition, FColor::Red, false, 10.0f, 0, 5.0f);
+
+						// Red sphere at start position
+						DrawDebugSphere(World, FailureInfo.StartPosition, 50.0f, 12, FColor::Red, false, 10.0f, 0, 3.0f);
+
+						// Magenta sphere at target position
+						DrawDebugSphere(World, FailureInfo.TargetPosition, 50.0f, 12, FColor::Magenta, false, 10.0f, 0, 3.0f);
+
+						UE_LOG(LogAeonixNavigation, Warning, TEXT("Async pathfinding visualization: Max iterations (%d) reached. Distance: %.2f units. Check viewport for red line and spheres (10 sec duration)."),
+							FailureInfo.IterationCount, FailureInfo.StraightLineDistance);
+					}
+				}
+			});
+		}
+	}
 }
 
 const AAeonixBoundingVolume* UAeonixSubsystem::GetVolumeForAgent(const UAeonixNavAgentComponent* NavigationComponent)
@@ -809,6 +1980,7 @@ void UAeonixSubsystem::ProcessDynamicObstacles(float DeltaTime)
 		{
 			Handle.VolumeHandle->TryProcessDirtyRegions();
 			Handle.VolumeHandle->ProcessPendingRegenResults(DeltaTime);
+			Handle.VolumeHandle->TryRebuildDerivedData();
 		}
 	}
 }
@@ -914,9 +2086,166 @@ void UAeonixSubsystem::Tick(float DeltaTime)
 	UpdateSpatialRelationships();
 	UpdateComponents();
 	ProcessDynamicObstacles(DeltaTime);
+	UpdateSlicedPathfinds();
 	UpdateRequests();
 }
 
+void UAeonixSubsystem::UpdateSlicedPathfinds()
+{
+	if (SlicedPathfinds.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_AeonixPathfindingSliced);
+
+	// Each search gets an even share of the budget, carrying on from wherever the last frame's round stopped
+	int32 BudgetRemaining = TimeSlicedIterationsPerFrame;
+	const int32 SliceBudget = FMath::Max(TimeSlicedIterationsPerFrame / SlicedPathfinds.Num(), 1);
+
+	for (int32 NumVisited = SlicedPathfinds.Num(); NumVisited > 0 && BudgetRemaining > 0 && SlicedPathfinds.Num() > 0; --NumVisited)
+	{
+		if (SlicedPathfindCursor >= SlicedPathfinds.Num())
+		{
+			SlicedPathfindCursor = 0;
+		}
+
+		int32 IterationsUsed = 0;
+		const EAeonixPathFindStatus Status = StepSlicedPathfind(*SlicedPathfinds[SlicedPathfindCursor], FMath::Min(SliceBudget, BudgetRemaining), IterationsUsed);
+		BudgetRemaining -= IterationsUsed;
+
+		if (Status == EAeonixPathFindStatus::InProgress)
+		{
+			SlicedPathfindCursor++;
+		}
+		else
+		{
+			SlicedPathfinds.RemoveAt(SlicedPathfindCursor);
+		}
+	}
+}
+
+EAeonixPathFindStatus UAeonixSubsystem::StepSlicedPathfind(FAeonixSlicedPathfind& Pathfind, int32 IterationBudget, int32& OutIterationsUsed)
+{
+	FAeonixPathFindRequest* Request = Pathfind.Request;
+	OutIterationsUsed = 0;
+
+	auto Finish = [this, Request](EAeonixPathFindStatus Status)
+	{
+		Request->PathFindPromise.SetValue(Status);
+		LoadMetrics.ActivePathfinds.fetch_sub(1);
+		return Status;
+	};
+
+	if (Request->IsStale())
+	{
+		LoadMetrics.CancelledPathfindsTotal.fetch_add(1);
+		return Finish(EAeonixPathFindStatus::Cancelled);
+	}
+
+	const AAeonixBoundingVolume* NavVolume = Pathfind.NavVolume.Get();
+	if (!NavVolume)
+	{
+		UE_LOG(LogAeonixNavigation, Warning, TEXT("AeonixSubsystem: Nav volume destroyed during time sliced pathfinding"));
+		LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+		return Finish(EAeonixPathFindStatus::Failed);
+	}
+
+	FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
+	const FAeonixData& NavData = NavVolume->GetNavData();
+
+	bool bBeginSearch = false;
+	bool bEndPartial = false;
+	TSet<nodeindex_t> ChangedLeaves;
+	if (!Pathfind.PathFinder.IsValid())
+	{
+		Pathfind.PathFinder = MakeUnique<AeonixPathFinder>(NavData, Pathfind.Settings);
+		Pathfind.GenerationId = NavData.GetGenerationId();
+		bBeginSearch = true;
+	}
+	else if (NavData.GetGenerationId() != Pathfind.GenerationId)
+	{
+		// The links we were given belong to the old octree
+		UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Time sliced path invalidated (navigation regenerated during calculation)"));
+		LoadMetrics.CancelledPathfindsTotal.fetch_add(1);
+		return Finish(EAeonixPathFindStatus::Invalidated);
+	}
+	else if (NavData.GetLeafChangeSerial() != Pathfind.LeafChangeSerial)
+	{
+		// A dynamic regen changed leaves since the last slice, what the search has explored is only wrong if it reached one of them
+		TArray<nodeindex_t> ChangedLeafList;
+		const bool bKnownChanges = NavData.GetLeafChangesSince(Pathfind.LeafChangeSerial, ChangedLeafList);
+		ChangedLeaves.Append(ChangedLeafList);
+		Pathfind.LeafChangeSerial = NavData.GetLeafChangeSerial();
+
+		if (!bKnownChanges || Pathfind.PathFinder->HasSearchReachedLeaves(ChangedLeaves))
+		{
+			if (Pathfind.NumRestarts >= MaxSlicedPathfindRestarts)
+			{
+				if (!bKnownChanges)
+				{
+					UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Time sliced path invalidated (too many regens during calculation)"));
+					LoadMetrics.CancelledPathfindsTotal.fetch_add(1);
+					return Finish(EAeonixPathFindStatus::Invalidated);
+				}
+
+				// Regens keep knocking it back, settle for as far as it got without crossing what changed
+				bEndPartial = true;
+			}
+			else
+			{
+				Pathfind.NumRestarts++;
+				bBeginSearch = true;
+			}
+		}
+	}
+
+	if (bBeginSearch)
+	{
+		Pathfind.LeafChangeSerial = NavData.GetLeafChangeSerial();
+		Pathfind.PathFinder->BeginPath(Pathfind.StartLink, Pathfind.GoalLinks, Pathfind.StartPosition, Pathfind.GoalPositions);
+
+		// The path will be found against the regions as they are now
+		for (TPair<FGuid, uint32>& RegionVersion : Request->RegionVersionSnapshot)
+		{
+			RegionVersion.Value = GetRegionVersion(RegionVersion.Key);
+		}
+	}
+
+	EAeonixPathFindStatus Status;
+	Request->WorkerPath.ResetForRepath();
+	if (bEndPartial)
+	{
+		UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Time sliced path restarted %d times for regens, ending it early"), Pathfind.NumRestarts);
+		Status = Pathfind.PathFinder->EndPathPartial(ChangedLeaves, Request->WorkerPath);
+		OutIterationsUsed = 1;
+	}
+	else
+	{
+		const int32 IterationsBefore = Pathfind.PathFinder->GetLastIterationCount();
+		Status = Pathfind.PathFinder->StepPath(IterationBudget, Request->WorkerPath);
+		// Always charge at least one, so a slice that ends without iterating still uses up budget
+		OutIterationsUsed = FMath::Max(Pathfind.PathFinder->GetLastIterationCount() - IterationsBefore, 1);
+	}
+
+	switch (Status)
+	{
+	case EAeonixPathFindStatus::InProgress:
+		return Status;
+	case EAeonixPathFindStatus::Complete:
+	case EAeonixPathFindStatus::Partial:
+		Request->WorkerGoalIndex = Pathfind.PathFinder->GetReachedGoalIndex();
+		Request->bPathReady.store(true, std::memory_order_release);
+		LoadMetrics.CompletedPathfindsTotal.fetch_add(1);
+		UE_LOG(LogAeonixNavigation, Log, TEXT("AeonixSubsystem: Time sliced %s found with %d points after %d iterations"), Status == EAeonixPathFindStatus::Partial ? TEXT("partial path") : TEXT("path"),
+			Request->WorkerPath.GetPathPoints().Num(), Pathfind.PathFinder->GetLastIterationCount());
+		return Finish(Status);
+	default:
+		LoadMetrics.FailedPathfindsTotal.fetch_add(1);
+		return Finish(EAeonixPathFindStatus::Failed);
+	}
+}
+
 void UAeonixSubsystem::UpdateRequests()
 {
 	FScopeLock Lock(&PathRequestsLock);
@@ -930,9 +2259,21 @@ void UAeonixSubsystem::UpdateRequests()
 		{
 			EAeonixPathFindStatus Status = Request->PathFindFuture.Get();
 
+			// Cache the result even if the requesting agent has gone, another agent may well ask for the same path
+			if (Status == EAeonixPathFindStatus::Complete &&
+			    Request->bAddToPathCache &&
+			    Request->bPathReady.load(std::memory_order_acquire))
+			{
+				if (const AAeonixBoundingVolume* NavVolume = Request->PathCacheKey.Volume.ResolveObjectPtr())
+				{
+					TrackPathRegions(Request->WorkerPath, NavVolume);
+					AddCachedPath(Request->PathCacheKey, Request->PathCacheGenerationId, Request->WorkerPath, Request->RegionVersionSnapshot);
+				}
+			}
+
 			// GAME THREAD DELIVERY: Move results from WorkerPath to DestinationPath
 			// This is safe because we're on game thread and can check UObject validity
-			if (Status == EAeonixPathFindStatus::Complete &&
+			if ((Status == EAeonixPathFindStatus::Complete || Status == EAeonixPathFindStatus::Partial) &&
 			    Request->bPathReady.load(std::memory_order_acquire) &&
 			    Request->RequestingAgent.IsValid() &&  // Game thread - safe to call IsValid()
 			    Request->DestinationPath)
@@ -941,6 +2282,12 @@ void UAeonixSubsystem::UpdateRequests()
 				*Request->DestinationPath = MoveTemp(Request->WorkerPath);
 				Request->DestinationPath->SetIsReady(true);
 
+				if (Request->DestinationGoalIndex)
+				{
+					// Worker indices are into the filtered goal list, map them back to the caller's
+					*Request->DestinationGoalIndex = Request->RequestedGoalIndices.IsValidIndex(Request->WorkerGoalIndex) ? Request->RequestedGoalIndices[Request->WorkerGoalIndex] : Request->WorkerGoalIndex;
+				}
+
 				// Track regions for invalidation (game thread only)
 				if (const AAeonixBoundingVolume* NavVolume = GetVolumeForAgent(Request->RequestingAgent.Get()))
 				{
@@ -951,6 +2298,8 @@ void UAeonixSubsystem::UpdateRequests()
 			}
 			// else: Component was destroyed or path not ready - just drop it
 
+			// Delivered, so the completion can ask for this path again without cancelling itself
+			Request->DestinationPath = nullptr;
 			Request->OnPathFindRequestComplete.ExecuteIfBound(Status);
 			PathRequests.RemoveAtSwap(i);
 			continue;
@@ -998,6 +2347,7 @@ void UAeonixSubsystem::CompleteAllPendingPathfindingTasks()
 		Request->OnPathFindRequestComplete.ExecuteIfBound(EAeonixPathFindStatus::Cancelled);
 	}
 	PathRequests.Empty();
+	SlicedPathfinds.Empty();
 }
 
 size_t UAeonixSubsystem::GetNumberOfPendingTasks() const
@@ -1250,6 +2600,57 @@ void UAeonixSubsystem::UnregisterComponentWithPath(UAeonixNavAgentComponent* Com
 	UE_LOG(LogAeonixNavigation, Verbose, TEXT("Unregistered component %s from path invalidation tracking"), *Component->GetName());
 }
 
+// Path cache
+
+bool UAeonixSubsystem::MakePathCacheKey(const AAeonixBoundingVolume* Volume, const AeonixLink& Start, const AeonixLink& Goal, const FAeonixPathFinderSettings& Settings, FAeonixPathCacheKey& OutKey) const
+{
+	// Debug open nodes are only gathered by running the search
+	if (!PathCache.IsEnabled() || !Volume || Settings.bDebugOpenNodes)
+	{
+		return false;
+	}
+
+	OutKey.Volume = Volume;
+	OutKey.Start = Start;
+	OutKey.Goal = Goal;
+	OutKey.SetSettings(Settings);
+	return true;
+}
+
+bool UAeonixSubsystem::FindCachedPath(const FAeonixPathCacheKey& Key, const AAeonixBoundingVolume* Volume, const FVector& StartPosition, const FVector& EndPosition, FAeonixNavigationPath& OutPath)
+{
+	FReadScopeLock ReadLock(Volume->GetOctreeDataLock());
+	const FAeonixData& NavData = Volume->GetNavData();
+	const bool bHit = PathCache.Find(Key, NavData.GetGenerationId(),
+		[this](const FGuid& RegionId) { return GetRegionVersion(RegionId); },
+		[&NavData](const FVector& SegmentStart, const FVector& SegmentEnd) { return NavData.IsSegmentClear(SegmentStart, SegmentEnd); },
+		StartPosition, EndPosition, OutPath);
+
+	if (bHit)
+	{
+		LoadMetrics.PathCacheHits.fetch_add(1);
+	}
+	else
+	{
+		LoadMetrics.PathCacheMisses.fetch_add(1);
+	}
+
+	return bHit;
+}
+
+void UAeonixSubsystem::AddCachedPath(const FAeonixPathCacheKey& Key, uint32 GenerationId, const FAeonixNavigationPath& Path, const TMap<FGuid, uint32>& RegionVersions)
+{
+	// Only the regions the path actually passes through can invalidate it
+	TMap<FGuid, uint32> TraversedRegionVersions;
+	for (const FGuid& RegionId : Path.GetTraversedRegionIds())
+	{
+		const uint32* Version = RegionVersions.Find(RegionId);
+		TraversedRegionVersions.Add(RegionId, Version ? *Version : 0);
+	}
+
+	PathCache.Add(Key, GenerationId, Path, MoveTemp(TraversedRegionVersions));
+}
+
 // Region versioning for invalidation detection
 
 uint32 UAeonixSubsystem::GetRegionVersion(const FGuid& RegionId) const
@@ -4,6 +4,7 @@
 #include "Actor/AeonixBoundingVolume.h"
 #include "Component/AeonixNavAgentComponent.h"
 #include "Pathfinding/AeonixNavigationPath.h"
+#include "Settings/AeonixSettings.h"
 #include "AeonixNavigation.h"
 
 #include "AIController.h"
@@ -138,6 +139,15 @@ void UAITask_AeonixMoveTo::OnPathFindComplete(EAeonixPathFindStatus Status)
 
 		RequestMove();
 	}
+	else if (Status == EAeonixPathFindStatus::Partial)
+	{
+		if (NavComponent)
+		{
+			NavComponent->RegisterPathForDebugRendering();
+		}
+
+		FollowPartialPath();
+	}
 	else if (Status == EAeonixPathFindStatus::Failed)
 	{
 		UE_LOG(LogAeonixNavigation, Warning, TEXT("AITask_AeonixMoveTo: Async pathfinding failed"));
@@ -150,6 +160,75 @@ void UAITask_AeonixMoveTo::OnPathFindComplete(EAeonixPathFindStatus Status)
 	}
 }
 
+void UAITask_AeonixMoveTo::OnContinuationPathFindComplete(EAeonixPathFindStatus Status)
+{
+	// Repaths cancel the continuation, so this only turns away one the task has stopped waiting for
+	if (!bAwaitingContinuation || !IsActive() || !NavComponent || !AeonixPath)
+	{
+		return;
+	}
+
+	bAwaitingContinuation = false;
+
+	if (Status != EAeonixPathFindStatus::Complete && Status != EAeonixPathFindStatus::Partial)
+	{
+		UE_LOG(LogAeonixNavigation, Warning, TEXT("AITask_AeonixMoveTo: Couldn't carry on from the end of the partial path, status %d"), static_cast<int32>(Status));
+		FinishMoveTask(EPathFollowingResult::Invalid);
+		return;
+	}
+
+	FAeonixNavigationPath& ContinuationPath = NavComponent->GetContinuationPath();
+	UPathFollowingComponent* PFComp = OwnerController ? OwnerController->GetPathFollowingComponent() : nullptr;
+
+	// Keep whatever is left of the partial path, then carry on along the continuation, whose first point is where the partial path ends
+	TArray<FAeonixPathPoint> SplicedPoints;
+	SplicedPoints.Add(FAeonixPathPoint(NavComponent->GetPathfindingStartPosition(), ContinuationPath.GetNumPoints() > 0 ? ContinuationPath.GetPathPoints()[0].Layer : 0));
+
+	const bool bStillMoving = PFComp && PFComp->GetStatus() != EPathFollowingStatus::Idle;
+	const int32 FirstRemainingIndex = bStillMoving ? PFComp->GetCurrentPathIndex() + 1 : AeonixPath->GetNumPoints();
+	for (int32 i = FirstRemainingIndex; i < AeonixPath->GetNumPoints() - 1; ++i)
+	{
+		SplicedPoints.Add(AeonixPath->GetPathPoints()[i]);
+	}
+	for (int32 i = 0; i < ContinuationPath.GetNumPoints(); ++i)
+	{
+		// Skip the continuation's start if we're already standing on it
+		if (i > 0 || bStillMoving)
+		{
+			SplicedPoints.Add(ContinuationPath.GetPathPoints()[i]);
+		}
+	}
+
+	AeonixPath->GetPathPoints() = MoveTemp(SplicedPoints);
+	AeonixPath->SetIsPartial(ContinuationPath.IsPartial());
+	for (const FGuid& RegionId : ContinuationPath.GetTraversedRegionIds())
+	{
+		AeonixPath->AddTraversedRegion(RegionId);
+	}
+
+	// Swap the move over without the old one's finish ending the task
+	if (PFComp && PathFinishDelegateHandle.IsValid())
+	{
+		PFComp->OnRequestFinished.Remove(PathFinishDelegateHandle);
+		PathFinishDelegateHandle.Reset();
+	}
+	if (bStillMoving && MoveRequestID.IsValid())
+	{
+		PFComp->AbortMove(*this, FPathFollowingResultFlags::NewRequest, MoveRequestID, EPathFollowingVelocityMode::Keep);
+	}
+	MoveRequestID = FAIRequestID::InvalidRequest;
+
+	if (Path.IsValid())
+	{
+		Path->ResetForRepath();
+	}
+
+	UE_LOG(LogAeonixNavigation, Log, TEXT("AITask_AeonixMoveTo: Continued partial path, now %d points%s"), AeonixPath->GetNumPoints(), AeonixPath->IsPartial() ? TEXT(" and still partial") : TEXT(""));
+
+	NavComponent->RegisterPathForDebugRendering();
+	AeonixPath->IsPartial() ? FollowPartialPath() : RequestMove();
+}
+
 void UAITask_AeonixMoveTo::FinishMoveTask(EPathFollowingResult::Type InResult)
 {
 	if (MoveRequestID.IsValid())
@@ -208,6 +287,7 @@ void UAITask_AeonixMoveTo::PerformMove()
 	ResetObservers();
 	ResetTimers();
 	ResetPaths();
+	CancelContinuation();
 
 	if (Result.Code == EAeonixPathfindingRequestResult::AlreadyAtGoal)
 	{
@@ -219,7 +299,16 @@ void UAITask_AeonixMoveTo::PerformMove()
 	// If we're ready to path, then request the path
 	if (Result.Code == EAeonixPathfindingRequestResult::ReadyToPath)
 	{
-		bUseAsyncPathfinding ? RequestPathAsync() : RequestPathSynchronous();
+		if (bUseIncrementalReplanning)
+		{
+			// Fresh move, the old search may be towards a different goal, and may still be out on a worker
+			IncrementalSearch = MakeShared<FAeonixIncrementalSearch>();
+			bUseAsyncPathfinding ? RequestPathIncrementalAsync() : RequestPathIncremental();
+		}
+		else
+		{
+			bUseAsyncPathfinding ? RequestPathAsync() : RequestPathSynchronous();
+		}
 
 		switch (Result.Code)
 		{
@@ -232,7 +321,7 @@ void UAITask_AeonixMoveTo::PerformMove()
 			{
 				UE_VLOG(GetGameplayTasksComponent(), LogGameplayTasks, Error, TEXT("%s> re-Activating Finished task!"), *GetName());
 			}
-			RequestMove(); // StartLink the move
+			AeonixPath->IsPartial() ? FollowPartialPath() : RequestMove(); // StartLink the move
 			break;
 		case EAeonixPathfindingRequestResult::Deferred: // Async...we're waiting on the task to return
 			MoveRequestID = Result.MoveId;
@@ -324,6 +413,16 @@ void UAITask_AeonixMoveTo::CheckPathPreConditions()
 			UE_LOG(LogAeonixNavigation, Error, TEXT("AeonixMoveTo: Destination is not valid! Goal(%s)"), TEXT_AI_LOCATION(MoveRequest.GetGoalLocation()));
 			bCanRequestMove = false;
 		}
+		else if (UAeonixSubsystem* Subsystem = Cast<UAeonixSubsystem>(AeonixSubsystem.GetInterface()))
+		{
+			// Goals inside geometry are moved out to the nearest free space, so the agent has somewhere it can actually arrive.
+			// Only the goal is moved, the path has to start where the agent stands. A blocked start is still searched from the nearest free voxel, as the subsystem projects both ends when it resolves their links
+			FVector ProjectedGoal;
+			if (Subsystem->ProjectPointToNavigation(MoveRequest.GetGoalLocation(), GetDefault<UAeonixSettings>()->NavigationProjectionRadius, ProjectedGoal))
+			{
+				MoveRequest.SetGoalLocation(ProjectedGoal);
+			}
+		}
 
 		bAlreadyAtGoal = bCanRequestMove && OwnerController->GetPathFollowingComponent()->HasReached(MoveRequest);
 	}
@@ -362,6 +461,54 @@ void UAITask_AeonixMoveTo::RequestPathSynchronous()
 	return;
 }
 
+void UAITask_AeonixMoveTo::RequestPathIncremental()
+{
+	Result.Code = EAeonixPathfindingRequestResult::Failed;
+
+	UAeonixSubsystem* Subsystem = Cast<UAeonixSubsystem>(AeonixSubsystem.GetInterface());
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	UE_VLOG(this, VLogAeonixNavigation, Log, TEXT("AeonixMoveTo: Requesting incremental pathfinding!"));
+
+	if (!IncrementalSearch.IsUnique())
+	{
+		// A repair from an earlier request is still running on the old state
+		IncrementalSearch = MakeShared<FAeonixIncrementalSearch>();
+	}
+
+	if (Subsystem->FindPathIncrementalAgent(NavComponent, MoveRequest.GetGoalLocation(), *IncrementalSearch, NavComponent->GetPath()))
+	{
+		Result.Code = EAeonixPathfindingRequestResult::Success;
+	}
+}
+
+void UAITask_AeonixMoveTo::RequestPathIncrementalAsync()
+{
+	Result.Code = EAeonixPathfindingRequestResult::Failed;
+
+	UAeonixSubsystem* Subsystem = Cast<UAeonixSubsystem>(AeonixSubsystem.GetInterface());
+	if (!Subsystem || !NavComponent)
+	{
+		return;
+	}
+
+	UE_VLOG(this, VLogAeonixNavigation, Log, TEXT("AeonixMoveTo: Requesting async incremental pathfinding!"));
+
+	if (!IncrementalSearch.IsUnique())
+	{
+		// Two workers can't repair the same state, start this one from scratch and leave the old one to finish
+		IncrementalSearch = MakeShared<FAeonixIncrementalSearch>();
+	}
+
+	FAeonixPathFindRequestCompleteDelegate& PathRequestCompleteDelegate = Subsystem->FindPathIncrementalAsyncAgent(NavComponent, MoveRequest.GetGoalLocation(), IncrementalSearch, NavComponent->GetPath());
+	PathRequestCompleteDelegate.BindDynamic(this, &UAITask_AeonixMoveTo::OnPathFindComplete);
+
+	Result.Code = EAeonixPathfindingRequestResult::Deferred;
+}
+
 void UAITask_AeonixMoveTo::RequestPathAsync()
 {
 	Result.Code = EAeonixPathfindingRequestResult::Failed;
@@ -417,6 +564,48 @@ void UAITask_AeonixMoveTo::RequestMove()
 	}
 }
 
+void UAITask_AeonixMoveTo::FollowPartialPath()
+{
+	UE_LOG(LogAeonixNavigation, Log, TEXT("AITask_AeonixMoveTo: Following partial path with %d points while searching on from its end"), AeonixPath->GetNumPoints());
+
+	RequestMove();
+
+	if (Result.Code == EAeonixPathfindingRequestResult::Success)
+	{
+		RequestContinuationPath();
+	}
+}
+
+void UAITask_AeonixMoveTo::RequestContinuationPath()
+{
+	UAeonixSubsystem* Subsystem = Cast<UAeonixSubsystem>(AeonixSubsystem.GetInterface());
+	if (!Subsystem || !NavComponent || AeonixPath->GetNumPoints() == 0)
+	{
+		return;
+	}
+
+	// An earlier continuation still in flight would deliver into the same path
+	CancelContinuation();
+	bAwaitingContinuation = true;
+
+	FAeonixNavigationPath& ContinuationPath = NavComponent->GetContinuationPath();
+	ContinuationPath.ResetForRepath();
+
+	FAeonixPathFindRequestCompleteDelegate& ContinuationCompleteDelegate = Subsystem->FindPathFromAsyncAgent(NavComponent, AeonixPath->GetPathPoints().Last().Position, MoveRequest.GetGoalLocation(), ContinuationPath);
+	ContinuationCompleteDelegate.BindDynamic(this, &UAITask_AeonixMoveTo::OnContinuationPathFindComplete);
+}
+
+void UAITask_AeonixMoveTo::CancelContinuation()
+{
+	bAwaitingContinuation = false;
+
+	UAeonixSubsystem* Subsystem = Cast<UAeonixSubsystem>(AeonixSubsystem.GetInterface());
+	if (Subsystem && NavComponent)
+	{
+		Subsystem->CancelPathRequests(NavComponent->GetContinuationPath());
+	}
+}
+
 void UAITask_AeonixMoveTo::ResetPaths()
 {
 	if (Path.IsValid())
@@ -551,6 +740,8 @@ void UAITask_AeonixMoveTo::OnDestroy(bool bInOwnerFinished)
 		}
 	}
 
+	CancelContinuation();
+
 	// Unregister component from path invalidation tracking
 	if (NavComponent && AeonixSubsystem.GetInterface())
 	{
@@ -569,6 +760,13 @@ void UAITask_AeonixMoveTo::OnDestroy(bool bInOwnerFinished)
 
 void UAITask_AeonixMoveTo::OnRequestFinished(FAIRequestID RequestId, const FPathFollowingResult& InResult)
 {
+	// Reached the end of a partial path, wait there for the rest of it
+	if (bAwaitingContinuation && InResult.IsSuccess())
+	{
+		UE_LOG(LogAeonixNavigation, Log, TEXT("AITask_AeonixMoveTo: Reached the end of the partial path, waiting for the continuation"));
+		return;
+	}
+
 	FinishMoveTask(InResult.Code);
 }
 
@@ -638,6 +836,7 @@ void UAITask_AeonixMoveTo::ConditionalUpdatePath()
 	{
 		AeonixPath->ResetForRepath();
 	}
+	CancelContinuation();
 
 	// Abort the existing move request first to avoid concurrent requests
 	if (MoveRequestID.IsValid())
@@ -666,16 +865,16 @@ void UAITask_AeonixMoveTo::ConditionalUpdatePath()
 		if (bUseAsyncPathfinding)
 		{
 			// Async pathfinding - completion callback will handle RequestMove
-			RequestPathAsync();
+			bUseIncrementalReplanning ? RequestPathIncrementalAsync() : RequestPathAsync();
 		}
 		else
 		{
 			// Synchronous pathfinding - need to handle result immediately
-			RequestPathSynchronous();
+			bUseIncrementalReplanning ? RequestPathIncremental() : RequestPathSynchronous();
 
 			if (Result.Code == EAeonixPathfindingRequestResult::Success)
 			{
-				RequestMove(); // Now safe - old request was aborted
+				AeonixPath->IsPartial() ? FollowPartialPath() : RequestMove(); // Now safe - old request was aborted
 			}
 			else
 			{
@@ -51,7 +51,7 @@ void UAeonixFindPathAsyncAction::Activate()
 
 void UAeonixFindPathAsyncAction::OnPathFindComplete(EAeonixPathFindStatus Status)
 {
-	if (Status == EAeonixPathFindStatus::Complete)
+	if (Status == EAeonixPathFindStatus::Complete || Status == EAeonixPathFindStatus::Partial)
 	{
 		OnSuccess.Broadcast(ResultPath.GetPathPoints());
 	}
@@ -0,0 +1,56 @@
+#include "Task/AeonixFindPathToNearestAsyncAction.h"
+#include "Component/AeonixNavAgentComponent.h"
+#include "Subsystem/AeonixSubsystem.h"
+#include "Engine/World.h"
+
+UAeonixFindPathToNearestAsyncAction* UAeonixFindPathToNearestAsyncAction::FindPathToNearestAsync(
+	UObject* WorldContextObject,
+	UAeonixNavAgentComponent* NavAgentComponent,
+	const TArray<FVector>& TargetLocations)
+{
+	UAeonixFindPathToNearestAsyncAction* Action = NewObject<UAeonixFindPathToNearestAsyncAction>();
+	Action->NavAgent = NavAgentComponent;
+	Action->Targets = TargetLocations;
+
+	if (WorldContextObject)
+	{
+		Action->WorldPtr = WorldContextObject->GetWorld();
+	}
+
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void UAeonixFindPathToNearestAsyncAction::Activate()
+{
+	if (!NavAgent.IsValid() || !WorldPtr.IsValid() || Targets.IsEmpty())
+	{
+		OnFailed.Broadcast();
+		return;
+	}
+
+	// Get the Aeonix subsystem
+	UAeonixSubsystem* Subsystem = WorldPtr->GetSubsystem<UAeonixSubsystem>();
+	if (!Subsystem)
+	{
+		OnFailed.Broadcast();
+		return;
+	}
+
+	// Request async pathfinding, the goal index is written alongside the path
+	FAeonixPathFindRequestCompleteDelegate& Delegate =
+		Subsystem->FindPathToNearestAsyncAgent(NavAgent.Get(), Targets, ResultPath, ResultGoalIndex);
+	Delegate.BindDynamic(this, &UAeonixFindPathToNearestAsyncAction::OnPathFindComplete);
+}
+
+void UAeonixFindPathToNearestAsyncAction::OnPathFindComplete(EAeonixPathFindStatus Status)
+{
+	if (Status == EAeonixPathFindStatus::Complete && Targets.IsValidIndex(ResultGoalIndex))
+	{
+		OnSuccess.Broadcast(ResultPath.GetPathPoints(), ResultGoalIndex, Targets[ResultGoalIndex]);
+	}
+	else
+	{
+		OnFailed.Broadcast();
+	}
+}
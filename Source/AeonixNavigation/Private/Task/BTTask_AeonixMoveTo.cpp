@@ -355,6 +355,7 @@ UAITask_AeonixMoveTo* UBTTask_AeonixMoveTo::PrepareMoveTask(UBehaviorTreeCompone
 	{
 		MoveTask->SetUp(MoveTask->GetAIController(), MoveRequest, bUseAsyncPathfinding);
 		MoveTask->bRepathOnInvalidation = bRepathOnInvalidation;
+		MoveTask->bUseIncrementalReplanning = bUseIncrementalReplanning;
 	}
 
 	return MoveTask;
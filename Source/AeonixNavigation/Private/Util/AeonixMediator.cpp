@@ -1,6 +1,7 @@
 #include "Util/AeonixMediator.h"
 #include "Data/AeonixLink.h"
 #include "Actor/AeonixBoundingVolume.h"
+#include "Settings/AeonixSettings.h"
 
 #include "DrawDebugHelpers.h"
 
@@ -108,6 +109,33 @@ bool AeonixMediator::GetLinkFromPosition(const FVector& aPosition, const AAeonix
 	return false;
 }
 
+bool AeonixMediator::ProjectToNavigation(const FVector& aPosition, const AAeonixBoundingVolume& aVolume, float aMaxDistance, AeonixLink& oLink, FVector& oPosition)
+{
+	if (GetLinkFromPosition(aPosition, aVolume, oLink))
+	{
+		oPosition = aPosition;
+		return true;
+	}
+
+	if (!aVolume.HasData() || aMaxDistance <= 0.f)
+	{
+		return false;
+	}
+
+	return aVolume.GetNavData().FindNearestNavigablePosition(aPosition, aMaxDistance, oLink, oPosition);
+}
+
+bool AeonixMediator::GetNavigableLinkFromPosition(const FVector& aPosition, const AAeonixBoundingVolume& aVolume, AeonixLink& oLink)
+{
+	FVector ProjectedPosition;
+	return GetNavigableLinkFromPosition(aPosition, aVolume, oLink, ProjectedPosition);
+}
+
+bool AeonixMediator::GetNavigableLinkFromPosition(const FVector& aPosition, const AAeonixBoundingVolume& aVolume, AeonixLink& oLink, FVector& oPosition)
+{
+	return ProjectToNavigation(aPosition, aVolume, GetDefault<UAeonixSettings>()->NavigationProjectionRadius, oLink, oPosition);
+}
+
 void AeonixMediator::GetVolumeXYZ(const FVector& aPosition, const AAeonixBoundingVolume& aVolume, const int aLayer, FIntVector& oXYZ)
 {
 	// Use cached bounds from NavigationData instead of recalculating GetComponentsBoundingBox
@@ -71,6 +71,9 @@ public:
 	// Called by subsystem to process pending regeneration results with time budget
 	void ProcessPendingRegenResults(float DeltaTime);
 
+	// Called by subsystem to rebuild the connectivity, free volume and landmarks invalidated by dynamic regeneration on a background task, once regeneration has settled
+	void TryRebuildDerivedData();
+
 	const FAeonixData& GetNavData() const { return NavigationData; }
 	FAeonixData& GetMutableNavData() { return NavigationData; }
 
@@ -122,6 +125,11 @@ private:
 	/** Index of next result to process from queue */
 	int32 NextResultIndexToProcess = 0;
 
+	/** Leaves whose voxels were changed by results applied so far, recorded on the nav data once the batch completes */
+	TArray<nodeindex_t> PendingRegenChangedLeaves;
+	/** The subnodes that flipped in each of PendingRegenChangedLeaves */
+	TArray<uint64> PendingRegenChangedVoxels;
+
 	/** Total number of leaves in current regeneration batch (for progress tracking) */
 	int32 CurrentRegenTotalLeaves = 0;
 
@@ -131,6 +139,12 @@ private:
 	/** Regions that are currently being regenerated (for path invalidation) */
 	TSet<FGuid> CurrentlyRegeneratingRegions;
 
+	/** Whether a background rebuild of the derived data is running */
+	bool bDerivedDataRebuildInFlight{false};
+
+	/** Takes the derived data rebuilt in the background, unless the octree has changed since it was copied */
+	void FinishDerivedDataRebuild(FAeonixData& Rebuilt, uint32 GenerationId, uint32 LeafChangeSerial);
+
 protected:
 	FAeonixData NavigationData;
 
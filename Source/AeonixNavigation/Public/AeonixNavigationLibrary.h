@@ -21,4 +21,16 @@ public:
 	/** Check if the path is ready/valid */
 	UFUNCTION(BlueprintPure, Category = "Aeonix|Path")
 	static bool IsPathReady(const FAeonixNavigationPath& Path);
+
+	/** Get a navigable point drawn uniformly from the free space of every Aeonix volume in the world */
+	UFUNCTION(BlueprintCallable, Category = "Aeonix|Query", meta = (WorldContext = "WorldContextObject"))
+	static bool GetRandomNavigablePoint(const UObject* WorldContextObject, FVector& OutPoint);
+
+	/** Get a point drawn uniformly from the free space a path from Origin can reach */
+	UFUNCTION(BlueprintCallable, Category = "Aeonix|Query", meta = (WorldContext = "WorldContextObject"))
+	static bool GetRandomReachablePoint(const UObject* WorldContextObject, const FVector& Origin, FVector& OutPoint);
+
+	/** Get a point drawn uniformly from the free space inside the box around Center */
+	UFUNCTION(BlueprintCallable, Category = "Aeonix|Query", meta = (WorldContext = "WorldContextObject"))
+	static bool GetRandomNavigablePointInBox(const UObject* WorldContextObject, const FVector& Center, const FVector& Extent, FVector& OutPoint);
 };
@@ -14,6 +14,14 @@ struct AEONIXNAVIGATION_API FAeonixFlyingSettings
 	// Maximum flight speed in units per second
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flying Movement")
 	float MaxSpeed = 1200.0f;
+
+	// Distance at which blocked voxels start steering the agent away, found by an octree query rather than a sweep. 0 turns avoidance off
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flying Movement", meta = (ClampMin = "0.0"))
+	float AvoidanceRadius = 0.0f;
+
+	// How hard the agent is pushed away from an obstacle it's touching, as a fraction of max speed. Falls off to nothing at the avoidance radius
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flying Movement", meta = (ClampMin = "0.0", EditCondition = "AvoidanceRadius > 0"))
+	float AvoidanceStrength = 0.5f;
 };
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
@@ -41,4 +49,8 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "Aeonix Flying Movement")
 	float GetCurrentSpeed() const { return Velocity.Size(); }
+
+protected:
+	// Bends InVelocity away from the nearest blocked voxel within the avoidance radius
+	FVector ApplyObstacleAvoidance(const FVector& InVelocity) const;
 };
\ No newline at end of file
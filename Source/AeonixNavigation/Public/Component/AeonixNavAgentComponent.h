@@ -34,6 +34,8 @@ public:
 
 	FAeonixNavigationPath& GetPath() { return CurrentPath; }
 	const FAeonixNavigationPath& GetPath() const  { return CurrentPath; }
+	// Where the search carrying on from the end of a partial CurrentPath is delivered
+	FAeonixNavigationPath& GetContinuationPath() { return ContinuationPath; }
 	FVector GetAgentPosition() const;
 	FVector GetPathfindingStartPosition() const;
 	FVector GetPathfindingEndPosition(const FVector& TargetLocation) const;
@@ -57,4 +59,5 @@ protected:
 	TScriptInterface<IAeonixSubsystemInterface> AeonixSubsystem;
 	
 	FAeonixNavigationPath CurrentPath{};
+	FAeonixNavigationPath ContinuationPath{};
 };
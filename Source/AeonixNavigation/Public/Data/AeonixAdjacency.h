@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Data/AeonixDefines.h"
+#include "Data/AeonixLink.h"
+
+struct FAeonixOctreeData;
+
+/**
+ * Baked face adjacency of every node that's searched as a whole, in compressed sparse row form.
+ * FAeonixOctreeData::GetNeighbours walks down into subdivided neighbours on every call, this stores what it found so a search expands a node with one contiguous read.
+ * Each list gets room for every leaf subnode it faces, so a leaf changing only rewrites the lists that face it, in place.
+ * Not serialized, built after generation and loading when the generation parameters ask for it.
+ */
+struct AEONIXNAVIGATION_API FAeonixAdjacency
+{
+	/** Bakes the lists of every node from the current octree */
+	void Build(const FAeonixOctreeData& aOctreeData);
+	/** Re-reads the lists of the nodes facing any of aChangedLeaves, whose voxels have been rewritten */
+	void UpdateLeaves(const FAeonixOctreeData& aOctreeData, TConstArrayView<nodeindex_t> aChangedLeaves);
+	void Reset();
+
+	bool IsValid() const { return bIsValid; }
+	int32 GetNumLinks() const { return Links.Num(); }
+
+	/** The links FAeonixOctreeData::GetNeighbours gives for aLink. Empty for nodes that aren't baked, such as leaves, or when not built */
+	TConstArrayView<AeonixLink> GetNeighbours(const AeonixLink& aLink) const;
+
+private:
+	// Node N of a layer owns the slots [Offsets[N], Offsets[N + 1]) of Links, of which the first Counts[N] are used. Indexed [Layer][NodeIndex]
+	TArray<TArray<int32>> Offsets;
+	TArray<TArray<int32>> Counts;
+	TArray<AeonixLink> Links;
+
+	// Leaf N is faced by the nodes [LeafDependentOffsets[N], LeafDependentOffsets[N + 1]) of LeafDependents
+	TArray<int32> LeafDependentOffsets;
+	TArray<AeonixLink> LeafDependents;
+
+	bool bIsValid = false;
+};
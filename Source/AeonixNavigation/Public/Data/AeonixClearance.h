@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Data/AeonixDefines.h"
+#include "Data/AeonixLink.h"
+
+struct FAeonixOctreeData;
+
+/**
+ * Distance from every free leaf subnode, and every node, to the nearest blocked subnode, so one bake serves agents of any size.
+ * Distances are Chebyshev, in subnodes, which never overestimate the straight line distance, and saturate at MaxClearance.
+ * Leaves store four bits per subnode, nodes the minimum over their whole volume.
+ * Not serialized, built after generation and patched round the leaves dynamic regens rewrite, when the generation parameters ask for it.
+ */
+struct AEONIXNAVIGATION_API FAeonixClearance
+{
+	/** Distances are stored up to this many subnodes, anything at least this far from a blocked subnode reads as MaxClearance */
+	static constexpr uint8 MaxClearance = 15;
+	/** Layer 0 cells a change to one leaf can reach, the furthest a subnode below MaxClearance can be from the blocked subnode it measures to */
+	static constexpr int32 ReachCells = (MaxClearance - 1 + 3) / 4;
+
+	/** Grows the blocked subnodes outwards a step at a time, across leaves and through the free nodes between them, recording when each is reached */
+	void Build(const FAeonixOctreeData& aOctreeData);
+	/**
+	 * Recomputes only what the rewritten voxels of aChangedLeaves can reach: the leaves and free nodes within ReachCells of them, and the nodes above those.
+	 * The wave is grown from the blocked subnodes within twice that, which is all the leaves within ReachCells can be measured to. Builds from scratch if not yet built.
+	 */
+	void UpdateLeaves(const FAeonixOctreeData& aOctreeData, TConstArrayView<nodeindex_t> aChangedLeaves);
+	/** Marks the distances as out of date, nothing is filtered on them until the next build */
+	void Invalidate();
+	void Reset();
+
+	bool IsValid() const { return bIsValid; }
+
+	/** Subnodes from subnode aSubnode of leaf aLeafIndex to the nearest blocked subnode, 0 if it's blocked itself */
+	uint8 GetSubnodeClearance(nodeindex_t aLeafIndex, subnodeindex_t aSubnode) const;
+	/** Smallest subnode clearance anywhere inside the node, 0 if anything in it is blocked */
+	uint8 GetNodeClearance(layerindex_t aLayer, nodeindex_t aNodeIndex) const;
+
+private:
+	/** Grows aReached, the subnodes reached in each layer 0 cell keyed by morton code, a step at a time. aOnStep sees every cell after each step. Cells outside aBounds, if given, are dropped */
+	static void GrowWave(TMap<uint64, uint64>& aReached, uint_fast32_t aCellsPerSide, const TSet<uint64>* aBounds, TFunctionRef<void(uint8, const TMap<uint64, uint64>&)> aOnStep);
+	/** Smallest distance from a free node to the blocked subnodes round it, as Build would find from the cells the wave reached inside it */
+	static uint8 MeasureFreeNode(const FAeonixOctreeData& aOctreeData, layerindex_t aLayer, nodeindex_t aNodeIndex);
+
+	// Four bits per subnode, sixteen subnodes to a word, four words per leaf
+	TArray<uint64> LeafClearance;
+	// Indexed [Layer][NodeIndex]
+	TArray<TArray<uint8>> NodeClearance;
+	bool bIsValid = false;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Data/AeonixDefines.h"
+#include "Data/AeonixLink.h"
+
+struct FAeonixOctreeData;
+
+/**
+ * Connected components of the navigable space in an octree.
+ * Two links with different component ids can never reach each other, so a query between them can be rejected without searching.
+ * Free subnodes of each leaf are grouped into locally connected regions, stored as voxel masks, so the data stays proportional to the leaf count.
+ * Not serialized, rebuilt after generation, regeneration and loading.
+ */
+struct AEONIXNAVIGATION_API FAeonixConnectivity
+{
+	/** Rebuilds every component from the current octree */
+	void Build(const FAeonixOctreeData& aOctreeData);
+	/** Marks the components as out of date, every link is then treated as reachable until the next build */
+	void Invalidate();
+	void Reset();
+
+	bool IsValid() const { return bIsValid; }
+	int32 GetNumComponents() const { return NumComponents; }
+
+	/** Component id for a navigable link, or INDEX_NONE if it's blocked, subdivided, or the components are out of date */
+	int32 GetComponent(const FAeonixOctreeData& aOctreeData, const AeonixLink& aLink) const;
+	/** False only when both links are known to be in different components */
+	bool AreConnected(const FAeonixOctreeData& aOctreeData, const AeonixLink& aStart, const AeonixLink& aTarget) const;
+
+	/** Index of the local region of leaf aLeafIndex containing aSubnode, or INDEX_NONE if that subnode is blocked */
+	int32 GetLeafRegion(nodeindex_t aLeafIndex, subnodeindex_t aSubnode) const;
+	/** Free subnodes of the local region of leaf aLeafIndex containing aSubnode, or 0 if that subnode is blocked */
+	uint64 GetLeafRegionMask(nodeindex_t aLeafIndex, subnodeindex_t aSubnode) const;
+
+private:
+	// Component of each node that's navigable as a whole, INDEX_NONE for nodes with children. Indexed [Layer][NodeIndex]
+	TArray<TArray<int32>> NodeComponents;
+	// Leaf N owns the regions [LeafRegionStart[N], LeafRegionStart[N + 1])
+	TArray<int32> LeafRegionStart;
+	// Free subnodes of each region
+	TArray<uint64> LeafRegionMasks;
+	TArray<int32> LeafRegionComponents;
+
+	int32 NumComponents = 0;
+	bool bIsValid = false;
+};
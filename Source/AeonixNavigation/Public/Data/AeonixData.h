@@ -1,6 +1,11 @@
 #pragma once
 
 #include "Data/AeonixOctreeData.h"
+#include "Data/AeonixConnectivity.h"
+#include "Data/AeonixLandmarks.h"
+#include "Data/AeonixAdjacency.h"
+#include "Data/AeonixClearance.h"
+#include "Data/AeonixFreeVolume.h"
 #include "Data/AeonixGenerationParameters.h"
 
 #include "AeonixData.generated.h"
@@ -9,6 +14,52 @@ class IAeonixCollisionQueryInterface;
 class IAeonixDebugDrawInterface;
 struct FAeonixGenerationParamaters;
 
+/** Result of FAeonixData::RaycastNav */
+struct FAeonixNavRaycastHit
+{
+	/** Whether anything blocked the segment, counting the volume boundary */
+	bool bBlockingHit = false;
+	/** Fraction of the way along the segment where it first entered a blocked subnode or left the volume, 1 if it didn't */
+	float Time = 1.f;
+	FVector Location = FVector::ZeroVector;
+};
+
+/** Result of FAeonixData::FindNearestObstacle */
+struct FAeonixNearestObstacle
+{
+	/** Whether any blocked subnode was within the search distance */
+	bool bFound = false;
+	/** Distance to the nearest point of the nearest blocked subnode, 0 if the position is in one */
+	float Distance = 0.f;
+	/** That nearest point */
+	FVector Location = FVector::ZeroVector;
+	/** Unit direction from the position towards it, zero if the position is in a blocked subnode */
+	FVector Direction = FVector::ZeroVector;
+};
+
+/** How FAeonixData::ClassifyPoints found a point */
+enum class EAeonixPointState : uint8
+{
+	/** Outside the volume */
+	Outside,
+	/** In a blocked subnode, with nothing free within the projection radius */
+	Blocked,
+	/** In a free subnode or node */
+	Free,
+	/** In a blocked subnode or outside the volume, moved to the nearest free space within the projection radius */
+	Projected
+};
+
+/** Result of FAeonixData::ClassifyPoints for one point */
+struct FAeonixPointClassification
+{
+	EAeonixPointState State = EAeonixPointState::Outside;
+	/** The free link holding the point, or the one it was projected into. Invalid for Outside and Blocked points */
+	AeonixLink Link = AeonixLink::GetInvalidLink();
+	/** The point itself, or where it was projected to */
+	FVector Position = FVector::ZeroVector;
+};
+
 USTRUCT()
 struct AEONIXNAVIGATION_API FAeonixData
 {
@@ -33,17 +84,119 @@ public:
 	bool GetNodePosition(layerindex_t aLayer, mortoncode_t aCode, FVector& oPosition) const;
 	float GetVoxelSize(layerindex_t aLayer) const;
 
+	/** Returns true if the segment doesn't touch any blocked leaf voxel. Walks the octree top down, only descending into nodes the segment passes through */
+	bool IsSegmentClear(const FVector& aStart, const FVector& aEnd) const;
+	/** Finds where the segment first enters a blocked subnode, walking the octree nearest node first so anything beyond a hit is never visited. Returns true on a hit */
+	bool RaycastNav(const FVector& aStart, const FVector& aEnd, FAeonixNavRaycastHit& oHit) const;
+	/** IsSegmentClear for each of aSegments, start then end. Callers hold the volume's read lock once for the whole batch */
+	void IsSegmentClearBatch(TConstArrayView<TPair<FVector, FVector>> aSegments, TArray<bool>& oClear) const;
+	/** RaycastNav for each of aSegments, start then end */
+	void RaycastNavBatch(TConstArrayView<TPair<FVector, FVector>> aSegments, TArray<FAeonixNavRaycastHit>& oHits) const;
+	/** Finds the free subnode or node nearest aPosition, no further than aMaxDistance, and the point in it closest to aPosition. For positions that have landed in blocked space or just outside the volume */
+	bool FindNearestNavigablePosition(const FVector& aPosition, float aMaxDistance, AeonixLink& oLink, FVector& oPosition) const;
+	/** Breadth first flood from aStart over links within aRadius of aCentre, appending the position of each link to oPositions in the order it's reached, aMaxSteps at most.
+	    Visited links are tracked in dense bitsets, and each ring of the flood gathers its neighbours in parallel */
+	void FloodFill(const AeonixLink& aStart, const FVector& aCentre, float aRadius, int32 aMaxSteps, TArray<FVector>& oPositions) const;
+	/** Finds the link holding each of aPoints in one pass. Points are sorted by morton code, and each descends only from where its path leaves the previous point's, so points in the same subtree share the walk.
+	    Blocked points, and those just outside the volume, are projected up to aProjectionRadius to the nearest free space, 0 leaves them as they are. oResults matches aPoints in order */
+	void ClassifyPoints(TConstArrayView<FVector> aPoints, float aProjectionRadius, TArray<FAeonixPointClassification>& oResults) const;
+	/** Finds the blocked subnode nearest aPosition, no further than aMaxDistance. Free nodes are skipped whole, and the search is nearest node first, so it stops at the first leaf further than the best hit */
+	bool FindNearestObstacle(const FVector& aPosition, float aMaxDistance, FAeonixNearestObstacle& oResult) const;
+	/** FindNearestObstacle for each of aPositions, looked up in one sorted pass and searched in parallel.
+	    Positions whose clearance already rules out anything within aMaxDistance skip the search. oResults matches aPositions in order */
+	void FindNearestObstacles(TConstArrayView<FVector> aPositions, float aMaxDistance, TArray<FAeonixNearestObstacle>& oResults) const;
+
+	/** Rebuilds the connected components from the current octree. Called after generation and after loading baked data. Regens invalidate them instead, and the volume rebuilds them on a copy */
+	void BuildConnectivity();
+	/** Treats every link as reachable until the next BuildConnectivity, for when leaves are being updated a few at a time */
+	void InvalidateConnectivity();
+	/** Moves in the connectivity, free volume and landmarks built on a copy of this octree, so they can be rebuilt off the game thread. Only those valid on aRebuilt are taken.
+	    Callers hold the write lock, and make sure the octree hasn't changed since it was copied */
+	void TakeDerivedData(FAeonixData& aRebuilt);
+	const FAeonixConnectivity& GetConnectivity() const { return Connectivity; }
+	/** False only if the two links are known to be in different connected components, so no path can exist between them */
+	bool AreLinksConnected(const AeonixLink& aStart, const AeonixLink& aTarget) const;
+	/** Free subnodes locally connected to aSubnode within leaf aLeafIndex, 0 if it's blocked. From the connectivity when it's up to date, otherwise flood filled from the leaf as it is now */
+	uint64 GetLeafRegionMask(nodeindex_t aLeafIndex, subnodeindex_t aSubnode) const;
+
+	/** Rebuilds the ALT landmark distances, if the generation parameters ask for any. Called after generation, and lazily by the volume on a copy once leaves stop changing */
+	void BuildLandmarks();
+	/** Stops the landmark bound being used until the next BuildLandmarks, as it may overestimate once leaves have changed */
+	void InvalidateLandmarks();
+	const FAeonixLandmarks& GetLandmarks() const { return Landmarks; }
+
+	/** Bakes the node adjacency lists, if the generation parameters ask for them. Called after generation, and after loading baked data */
+	void BuildAdjacency();
+	/** Re-reads the adjacency lists facing leaves whose voxels have just been rewritten */
+	void UpdateAdjacency(TConstArrayView<nodeindex_t> aChangedLeaves);
+	const FAeonixAdjacency& GetAdjacency() const { return Adjacency; }
+	/** Appends the face neighbours of a node, from the baked adjacency if there is one, otherwise by walking the octree */
+	void GetNeighbours(const AeonixLink& aLink, TArray<AeonixLink>& oNeighbours) const;
+
+	/** Rebuilds the clearance distances, if the generation parameters ask for them. Called after generation and after loading baked data */
+	void BuildClearance();
+	/** Patches the clearance distances round leaves whose voxels have just been rewritten, building them if they aren't yet */
+	void UpdateClearance(TConstArrayView<nodeindex_t> aChangedLeaves);
+	/** Stops the clearance being used until the next BuildClearance, as leaves have changed under it */
+	void InvalidateClearance();
+	const FAeonixClearance& GetClearance() const { return Clearance; }
+	/** Free space round the position of aLink in world units, beyond the baked AgentRadius. FLT_MAX when the clearance isn't built, 0 for blocked subnodes */
+	float GetLinkClearance(const AeonixLink& aLink) const;
+
+	/** Rebuilds the free volume totals random points are drawn from. Called after generation and after loading baked data, always after the connectivity, and rebuilt with it on a copy after regens */
+	void BuildFreeVolume();
+	/** Stops random points being drawn until the next BuildFreeVolume, as leaves have changed under it */
+	void InvalidateFreeVolume();
+	const FAeonixFreeVolume& GetFreeVolume() const { return FreeVolume; }
+	/** A point drawn uniformly from all the free space in the octree, in O(log n) */
+	bool GetRandomNavigablePoint(FRandomStream& aRandom, AeonixLink& oLink, FVector& oPosition) const;
+	/** A point drawn uniformly from the free space connected to aOrigin, so anywhere a path from it can reach. False if aOrigin is blocked or the components are out of date */
+	bool GetRandomReachablePoint(const AeonixLink& aOrigin, FRandomStream& aRandom, AeonixLink& oLink, FVector& oPosition) const;
+	/** A point drawn uniformly from the free space inside aBox. Walks only the nodes the box overlaps, so costs in proportion to the box rather than the octree */
+	bool GetRandomNavigablePointInBox(const FBox& aBox, FRandomStream& aRandom, AeonixLink& oLink, FVector& oPosition) const;
+
+	/** Incremented by every full generation. Links taken from an earlier generation don't refer to the same nodes */
+	uint32 GetGenerationId() const { return GenerationId; }
+
+	/** Records the leaves whose voxels changed in one regen, once all of them have been written, so incremental searches can repair just those.
+	    ChangedVoxels holds each leaf's old VoxelGrid xor its new one, left empty every subnode of a changed leaf counts as flipped */
+	void RecordLeafChanges(TArray<nodeindex_t>&& ChangedLeaves, TArray<uint64>&& ChangedVoxels = TArray<uint64>());
+	/** Incremented by every RecordLeafChanges */
+	uint32 GetLeafChangeSerial() const { return LeafChangeSerial; }
+	/** Gathers every leaf changed since Serial, returns false if that is further back than the history kept */
+	bool GetLeafChangesSince(uint32 Serial, TArray<nodeindex_t>& OutLeaves) const;
+	/** As above, with the subnodes that flipped in each of OutLeaves alongside. A leaf changed by several regens is listed once for each */
+	bool GetLeafChangesSince(uint32 Serial, TArray<nodeindex_t>& OutLeaves, TArray<uint64>& OutChangedVoxels) const;
+
 	//~ Begin UObject
 	//void Serialize(FArchive& Ar) override;
 	//~ End UObject 
 
 private:
 	FAeonixGenerationParameters GenerationParameters;
+	// Derived from the octree, not serialized
+	FAeonixConnectivity Connectivity;
+	FAeonixLandmarks Landmarks;
+	FAeonixAdjacency Adjacency;
+	FAeonixClearance Clearance;
+	FAeonixFreeVolume FreeVolume;
+	uint32 GenerationId = 0;
+	// Leaves changed by the most recent regens, oldest first, one entry per change serial, and the subnodes that flipped in each
+	TArray<TArray<nodeindex_t>> RecentLeafChanges;
+	TArray<TArray<uint64>> RecentLeafChangedVoxels;
+	uint32 LeafChangeSerial = 0;
 	int32 GetNumNodesInLayer(layerindex_t aLayer) const;
 	int32 GetNumNodesPerSide(layerindex_t aLayer) const;
 
 	bool IsBlocked(const FVector& aPosition, const float aSize) const;
 	bool IsInDebugRange(const FVector& aPosition) const;
+	/** Highest layer with any nodes in it, which holds the roots of the tree, or INDEX_NONE if there are none */
+	int32 GetRootLayer() const;
+	/** Shared walk behind the segment queries. With bNearest the first hit along the segment is found, otherwise it stops at any hit. oHitTime is the fraction along the segment */
+	bool TraceSegment(const FVector& aStart, const FVector& aEnd, int32 aRootLayer, bool bNearest, float& oHitTime) const;
+	FBox GetNodeBounds(layerindex_t aLayer, mortoncode_t aCode) const;
+	/** Nearest node first search for FindNearestObstacle, without the clearance early out */
+	bool SearchNearestObstacle(const FVector& aPosition, float aMaxDistance, FAeonixNearestObstacle& oResult) const;
 	bool IsAnyMemberBlocked(layerindex_t aLayer, mortoncode_t aCode) const;
 	bool GetIndexForCode(layerindex_t aLayer, mortoncode_t aCode, nodeindex_t& oIndex) const;
 
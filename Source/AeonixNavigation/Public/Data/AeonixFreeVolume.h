@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Data/AeonixDefines.h"
+#include "Data/AeonixLink.h"
+
+struct FAeonixData;
+struct FRandomStream;
+
+/**
+ * Running total of the free volume of an octree, for picking navigable points uniformly at random.
+ * Free nodes and the locally connected regions of each leaf are laid out grouped by connected component, each weighted by its free subnode count,
+ * so a binary search over the totals picks one in proportion to its volume, from the whole octree or from a single component.
+ * Not serialized, rebuilt after generation and once dynamic regens have settled, after the connectivity it groups by.
+ */
+struct AEONIXNAVIGATION_API FAeonixFreeVolume
+{
+	/** Gathers every free node and leaf region, grouped by the components of aData's connectivity when it's up to date */
+	void Build(const FAeonixData& aData);
+	/** Marks the totals as out of date, nothing is sampled from them until the next build */
+	void Invalidate();
+	void Reset();
+
+	bool IsValid() const { return bIsValid; }
+	/** Free subnodes in the whole octree */
+	uint64 GetTotalSubnodes() const { return CumulativeSubnodes.Num() > 0 ? CumulativeSubnodes.Last() : 0; }
+	/** Free subnodes in component aComponent, 0 if the components weren't up to date at the last build */
+	uint64 GetComponentSubnodes(int32 aComponent) const;
+
+	/** Picks a point uniformly from the free space of the octree, or of component aComponent unless it's INDEX_NONE */
+	bool GetRandomPoint(const FAeonixData& aData, FRandomStream& aRandom, int32 aComponent, AeonixLink& oLink, FVector& oPosition) const;
+
+private:
+	struct FRegion
+	{
+		// The free node, or the leaf's node with the first subnode of the region
+		AeonixLink Link;
+		// Free subnodes of a leaf region, 0 for a free node
+		uint64 Mask;
+	};
+
+	TArray<FRegion> Regions;
+	// Free subnodes in Regions [0, N], inclusive
+	TArray<uint64> CumulativeSubnodes;
+	// Component N owns the regions [ComponentStart[N], ComponentStart[N + 1]), empty when the components weren't up to date
+	TArray<int32> ComponentStart;
+	bool bIsValid = false;
+};
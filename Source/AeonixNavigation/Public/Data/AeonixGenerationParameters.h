@@ -39,6 +39,12 @@ struct AEONIXNAVIGATION_API FAeonixGenerationParameters
 	float AgentRadius = 0.f;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SVO Navigation")
 	ESVOGenerationStrategy GenerationStrategy = ESVOGenerationStrategy::UseBaked;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SVO Navigation", meta = (ClampMin = "0", ClampMax = "32", ToolTip = "Landmarks to place for the ALT heuristic, which estimates distance round obstacles far better than a straight line. Each one costs a search over the whole volume when built and two floats per node. 0 disables them."))
+	int32 NumLandmarks{0};
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SVO Navigation", meta = (ToolTip = "Bakes the neighbours of every node into flat arrays after generation, so searches don't walk down into subdivided neighbours each time they expand a node. Costs memory roughly proportional to the number of nodes, and dynamic regen patches the lists facing changed leaves."))
+	bool bBakeAdjacency{false};
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SVO Navigation", meta = (ToolTip = "Stores the distance from every free subnode and node to the nearest blocked subnode, up to 15 subnodes, so agents larger than AgentRadius can share this volume by setting their own radius in the pathfinder settings. Costs four bits per leaf subnode and a byte per node, and dynamic regen patches the distances round changed leaves."))
+	bool bBakeClearance{false};
 
 	// Transient data used during generation
 	FVector Origin{FVector::ZeroVector};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Data/AeonixDefines.h"
+#include "Data/AeonixLink.h"
+
+struct FAeonixData;
+
+/**
+ * Landmark distances for the ALT (A*, landmarks and the triangle inequality) heuristic.
+ * A few landmarks are spread across the navigable space, and the shortest path distance from each of them to every node is stored.
+ * By the triangle inequality d(L, b) - d(L, a) never overestimates d(a, b), and round large obstacles it is far tighter than the straight line.
+ * Leaves keep the nearest and furthest distance over their subnodes rather than one per subnode, which keeps the bound admissible at a fraction of the memory.
+ * Not serialized, built after generation and rebuilt lazily once dynamic regens have settled.
+ */
+struct AEONIXNAVIGATION_API FAeonixLandmarks
+{
+	/** Picks up to aNumLandmarks landmarks, each as far as possible from those already picked, and stores their distances to every node */
+	void Build(const FAeonixData& aData, int32 aNumLandmarks);
+	/** Marks the distances as out of date, the bound is then 0 until the next build */
+	void Invalidate();
+	void Reset();
+
+	bool IsValid() const { return bIsValid; }
+	const TArray<AeonixLink>& GetLandmarks() const { return Landmarks; }
+
+	/** Lower bound on the path length between two navigable links, using path distances between link positions. 0 when nothing better is known */
+	float GetLowerBound(const AeonixLink& aStart, const AeonixLink& aTarget) const;
+
+private:
+	struct FDistanceRange
+	{
+		// FLT_MAX where the landmark can't reach the node, or any of its free subnodes
+		float Min = FLT_MAX;
+		float Max = FLT_MAX;
+	};
+
+	/** The Stride ranges for the node aLink is in, or nullptr */
+	const FDistanceRange* GetRanges(const AeonixLink& aLink) const;
+
+	TArray<AeonixLink> Landmarks;
+	// Indexed [Layer][NodeIndex * Stride + Landmark]
+	TArray<TArray<FDistanceRange>> NodeRanges;
+	int32 Stride = 0;
+	bool bIsValid = false;
+};
@@ -29,6 +29,64 @@ struct AEONIXNAVIGATION_API AeonixLeafNode
 		return (VoxelGrid & (1ULL << aIndex)) != 0;
 	}
 
+	/** Returns the free voxels of the row along aAxis (0 = X, 1 = Y, 2 = Z) passing through the given co-ordinates. Bit N is set if the voxel at N along that axis is free */
+	inline uint8 GetFreeRow(int32 aAxis, uint_fast32_t aX, uint_fast32_t aY, uint_fast32_t aZ) const
+	{
+		// Morton interleaving puts coordinate bit 0 at bit (axis) and bit 1 at bit (axis + 3), so the row is four fixed offsets from its first voxel
+		uint_fast32_t coords[3] = { aX, aY, aZ };
+		coords[aAxis] = 0;
+		const uint_fast64_t freeGrid = ~VoxelGrid >> morton3D_64_encode(coords[0], coords[1], coords[2]);
+
+		return static_cast<uint8>((freeGrid & 1)
+			| ((freeGrid >> (1 << aAxis)) & 1) << 1
+			| ((freeGrid >> (8 << aAxis)) & 1) << 2
+			| ((freeGrid >> (9 << aAxis)) & 1) << 3);
+	}
+
+	/** Grows a voxel mask by one voxel either way along aAxis. Voxels that would step outside the leaf are dropped rather than wrapping */
+	static inline uint_fast64_t DilateMaskAlongAxis(uint_fast64_t aMask, int32 aAxis)
+	{
+		// Voxels with coordinate bit 0 set along each axis, and with coordinate bit 1 set
+		constexpr uint64 lowBit[3] = { 0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull };
+		constexpr uint64 highBit[3] = { 0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull };
+
+		// Stepping 0->1 or 2->3 flips bit 0, stepping 1->2 clears bit 0 and sets bit 1
+		const int32 lowShift = 1 << aAxis;
+		const int32 highShift = (8 << aAxis) - lowShift;
+		return aMask
+			| ((aMask & ~lowBit[aAxis]) << lowShift) | ((aMask & lowBit[aAxis] & ~highBit[aAxis]) << highShift)
+			| ((aMask & lowBit[aAxis]) >> lowShift) | ((aMask & ~lowBit[aAxis] & highBit[aAxis]) >> highShift);
+	}
+
+	/** Grows a voxel mask by one voxel along each axis. Voxels that would step outside the leaf are dropped rather than wrapping */
+	static inline uint_fast64_t DilateMask(uint_fast64_t aMask)
+	{
+		return DilateMaskAlongAxis(aMask, 0) | DilateMaskAlongAxis(aMask, 1) | DilateMaskAlongAxis(aMask, 2);
+	}
+
+	/** Grows aSeed through aFree until it stops changing, giving the locally connected part of aFree that aSeed is in */
+	static inline uint_fast64_t FloodFillMask(uint_fast64_t aSeed, uint_fast64_t aFree)
+	{
+		uint_fast64_t region = aSeed & aFree;
+		uint_fast64_t grown = DilateMask(region) & aFree;
+		while (grown != region)
+		{
+			region = grown;
+			grown = DilateMask(region) & aFree;
+		}
+		return region;
+	}
+
+	/** Voxels on the face of the leaf in aDirection (pX, nX, pY, nY, pZ, nZ). Shifting the positive face right by (9 << axis) lines it up with the negative face of the next leaf */
+	static inline uint_fast64_t GetFaceMask(int32 aDirection)
+	{
+		constexpr uint64 faceMasks[6] = {
+			0xAA00AA00AA00AA00ull, 0x0055005500550055ull,
+			0xCCCC0000CCCC0000ull, 0x0000333300003333ull,
+			0xF0F0F0F000000000ull, 0x000000000F0F0F0Full };
+		return faceMasks[aDirection];
+	}
+
 	inline bool IsCompletelyBlocked() const
 	{
 		return VoxelGrid == -1;
@@ -43,7 +43,16 @@ struct AEONIXNAVIGATION_API FAeonixOctreeData
 	const AeonixNode& GetNode(const AeonixLink& aLink) const;
 	const AeonixLeafNode& GetLeafNode(nodeindex_t aIndex) const;
 	void GetLeafNeighbours(const AeonixLink& aLink, TArray<AeonixLink>& oNeighbours) const;
-	void GetNeighbours(const AeonixLink& aLink, TArray<AeonixLink>& oNeighbours) const;
+	/** Jump point variant of GetLeafNeighbours. Runs of free subnodes inside the leaf are skipped, only the subnodes where a run ends, reaches the goal, or uncovers a forced neighbour are returned */
+	void GetLeafJumpNeighbours(const AeonixLink& aLink, const AeonixLink& aGoal, TArray<AeonixLink>& oNeighbours) const;
+	/** Face neighbours of a node, descending into subdivided neighbours to the children that face it. oLeaves, if given, gets each leaf whose subnodes were looked at */
+	void GetNeighbours(const AeonixLink& aLink, TArray<AeonixLink>& oNeighbours, TArray<nodeindex_t>* oLeaves = nullptr) const;
+
+private:
+	/** Adds the neighbour of a leaf subnode whose signed co-ordinates (sX, sY, sZ) have stepped outside the leaf in aDirection */
+	void GetLeafNeighbourAcrossBoundary(const AeonixNode& aNode, int32 aDirection, int32 sX, int32 sY, int32 sZ, TArray<AeonixLink>& oNeighbours) const;
+	/** Free row mask for a row that lies just outside the leaf in aDirection, or -1 if the adjacent space is subdivided above layer 0 and can't be summarised as a row */
+	int32 GetFreeRowOutsideLeaf(const AeonixNode& aNode, int32 aDirection, int32 aAxis, const int32 (&aCoords)[3]) const;
 };
 
 FORCEINLINE FArchive& operator<<(FArchive& Ar, FAeonixOctreeData& AeonixData)
@@ -17,6 +17,12 @@ DECLARE_STATS_GROUP(TEXT("Aeonix"), STATGROUP_Aeonix, STATCAT_Advanced);
 // Octree Generation Stats
 DECLARE_CYCLE_STAT(TEXT("Full Octree Generation"), STAT_AeonixFullOctreeGen, STATGROUP_Aeonix);
 DECLARE_CYCLE_STAT(TEXT("Dynamic Subregion Sync"), STAT_AeonixDynamicSync, STATGROUP_Aeonix);
+DECLARE_CYCLE_STAT(TEXT("Connectivity Build"), STAT_AeonixConnectivityBuild, STATGROUP_Aeonix);
+DECLARE_CYCLE_STAT(TEXT("Landmark Build"), STAT_AeonixLandmarkBuild, STATGROUP_Aeonix);
+DECLARE_CYCLE_STAT(TEXT("Adjacency Build"), STAT_AeonixAdjacencyBuild, STATGROUP_Aeonix);
+DECLARE_CYCLE_STAT(TEXT("Clearance Build"), STAT_AeonixClearanceBuild, STATGROUP_Aeonix);
+DECLARE_CYCLE_STAT(TEXT("Clearance Update"), STAT_AeonixClearanceUpdate, STATGROUP_Aeonix);
+DECLARE_CYCLE_STAT(TEXT("Free Volume Build"), STAT_AeonixFreeVolumeBuild, STATGROUP_Aeonix);
 
 // Async Dynamic Subregion Stats (3 levels of granularity)
 DECLARE_CYCLE_STAT(TEXT("Dynamic Subregion Async"), STAT_AeonixDynamicAsync, STATGROUP_Aeonix);
@@ -26,6 +32,10 @@ DECLARE_CYCLE_STAT(TEXT("Dynamic Async Leaf"), STAT_AeonixDynamicAsyncLeaf, STAT
 // Pathfinding Stats
 DECLARE_CYCLE_STAT(TEXT("Pathfinding Sync"), STAT_AeonixPathfindingSync, STATGROUP_Aeonix);
 DECLARE_CYCLE_STAT(TEXT("Pathfinding Async"), STAT_AeonixPathfindingAsync, STATGROUP_Aeonix);
+DECLARE_CYCLE_STAT(TEXT("Pathfinding Time Sliced"), STAT_AeonixPathfindingSliced, STATGROUP_Aeonix);
+DECLARE_CYCLE_STAT(TEXT("Pathfinding Batch"), STAT_AeonixPathfindingBatch, STATGROUP_Aeonix);
+DECLARE_CYCLE_STAT(TEXT("Path Distances"), STAT_AeonixPathDistances, STATGROUP_Aeonix);
+DECLARE_CYCLE_STAT(TEXT("Visibility Field Build"), STAT_AeonixVisibilityFieldBuild, STATGROUP_Aeonix);
 
 // Path Smoothing Stats
 DECLARE_CYCLE_STAT(TEXT("Path Chaikin Smoothing"), STAT_AeonixPathChaikinSmoothing, STATGROUP_Aeonix);
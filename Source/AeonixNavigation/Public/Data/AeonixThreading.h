@@ -39,6 +39,9 @@ struct AEONIXNAVIGATION_API FAeonixLoadMetrics
 	std::atomic<int32> FailedPathfindsTotal{0};
 	std::atomic<int32> CancelledPathfindsTotal{0};
 	std::atomic<int32> InvalidatedPathsTotal{0};
+	std::atomic<int32> UnreachableRejectedTotal{0};  // Failed up front because start and goal are in different connected components
+	std::atomic<int32> PathCacheHits{0};
+	std::atomic<int32> PathCacheMisses{0};
 
 	TAtomic<float> AveragePathfindTimeMs{0.0f};
 	TAtomic<float> AverageRegenTimeMs{0.0f};
@@ -61,6 +64,14 @@ struct AEONIXNAVIGATION_API FAeonixLoadMetrics
 		return 0.0f; // Normal
 	}
 
+	/** Fraction of cache lookups that returned a path, 0 if nothing has been looked up yet */
+	float GetPathCacheHitRate() const
+	{
+		const int32 Hits = PathCacheHits.load();
+		const int32 Lookups = Hits + PathCacheMisses.load();
+		return Lookups > 0 ? static_cast<float>(Hits) / static_cast<float>(Lookups) : 0.0f;
+	}
+
 	/** Update average pathfind time with exponential moving average */
 	void UpdatePathfindTime(float NewTimeMs)
 	{
@@ -92,6 +103,9 @@ struct AEONIXNAVIGATION_API FAeonixLoadMetrics
 		FailedPathfindsTotal = 0;
 		CancelledPathfindsTotal = 0;
 		InvalidatedPathsTotal = 0;
+		UnreachableRejectedTotal = 0;
+		PathCacheHits = 0;
+		PathCacheMisses = 0;
 		AveragePathfindTimeMs = 0.0f;
 		AverageRegenTimeMs = 0.0f;
 		PathfindSampleCount = 0;
@@ -3,11 +3,13 @@
 #include "HAL/ThreadSafeCounter.h"
 #include "Data/AeonixThreading.h"
 #include "Pathfinding/AeonixNavigationPath.h"
+#include "Pathfinding/AeonixPathCache.h"
 
 #include "AeonixTypes.generated.h"
 
 class AAeonixBoundingVolume;
 class UAeonixNavAgentComponent;
+class FAeonixIncrementalSearch;
 
 UENUM()
 enum class EAeonixPathFindStatus : uint8
@@ -19,7 +21,8 @@ enum class EAeonixPathFindStatus : uint8
 	Consumed = 4,
 	Failed = 5,
 	Cancelled = 6,
-	Invalidated = 7
+	Invalidated = 7,
+	Partial = 8 // Ran out of iterations, the path only goes as far as the search got
 };
 
 DECLARE_DYNAMIC_DELEGATE_OneParam(FAeonixPathFindRequestCompleteDelegate, EAeonixPathFindStatus, PathFindStatus);
@@ -39,6 +42,22 @@ struct FAeonixPathFindRequest
 	TWeakObjectPtr<UAeonixNavAgentComponent> RequestingAgent;
 	TMap<FGuid, uint32> RegionVersionSnapshot; // For invalidation detection
 
+	// Path cache entry to fill on delivery, only used if bAddToPathCache is set
+	FAeonixPathCacheKey PathCacheKey;
+	uint32 PathCacheGenerationId = 0;
+	bool bAddToPathCache = false;
+
+	// Nearest-of-N requests: the goal the worker reached, indexed into the goals it was given, and the caller's index for each of those goals
+	int32 WorkerGoalIndex = INDEX_NONE;
+	TArray<int32> RequestedGoalIndices;
+	int32* DestinationGoalIndex = nullptr;
+
+	// Run a slice at a time on the game thread rather than on a worker
+	bool bTimeSliced = false;
+
+	// D* Lite state to repair rather than searching from scratch. Shared so the worker keeps it alive, the requester leaves it alone until delivery
+	TSharedPtr<FAeonixIncrementalSearch> IncrementalSearch;
+
 	// Deferred delivery: workers write to WorkerPath, game thread moves to DestinationPath
 	FAeonixNavigationPath WorkerPath;
 	FAeonixNavigationPath* DestinationPath = nullptr;
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Data/AeonixDefines.h"
+#include "Data/AeonixLink.h"
+
+struct FAeonixData;
+
+enum class EAeonixVisibility : uint8
+{
+	/** Not in the field, blocked or beyond its radius */
+	Unknown,
+	Visible,
+	Hidden
+};
+
+/**
+ * Which free nodes and subnodes within a radius of a target have line of sight to it, through the octree's blocked subnodes.
+ * Rather than tracing each voxel through the octree from the root, the blocked leaves within the radius are gathered once
+ * and binned by the directions they cover on a cube map round the target. Every ray from the target then only tests the leaves
+ * in its own direction's bin, nearest first, and the rays are traced in parallel.
+ * Built on demand from a volume's data under its read lock. Links are only meaningful on nav data of the same generation,
+ * and the visibility only until a regen rewrites leaves, see IsCurrent.
+ */
+struct AEONIXNAVIGATION_API FAeonixVisibilityField
+{
+	/** Gathers every free node and subnode whose centre is within aRadius of aTarget, and traces each one's line of sight to it.
+	    The subnode the target is in never blocks, so a target stood in the padding round geometry still sees out */
+	void Build(const FAeonixData& aData, const FVector& aTarget, float aRadius);
+	void Reset();
+
+	bool IsValid() const { return bIsValid; }
+	const FVector& GetTarget() const { return Target; }
+	float GetRadius() const { return Radius; }
+	uint32 GetGenerationId() const { return GenerationId; }
+	uint32 GetLeafChangeSerial() const { return LeafChangeSerial; }
+	/** Whether aData is still what the field was built from, neither regenerated nor had leaves rewritten since */
+	bool IsCurrent(const FAeonixData& aData) const;
+
+	int32 Num() const { return Links.Num(); }
+	const AeonixLink& GetLink(int32 aIndex) const { return Links[aIndex]; }
+	const FVector& GetPosition(int32 aIndex) const { return Positions[aIndex]; }
+	bool IsVisible(int32 aIndex) const { return Visible[aIndex]; }
+	int32 GetNumVisible() const { return NumVisible; }
+
+	/** Visible or Hidden for the links in the field, Unknown for anything else */
+	EAeonixVisibility GetLinkVisibility(const AeonixLink& aLink) const;
+	/** Appends the centre of every link in the field that is visible, or with bVisible false, hidden */
+	void GetPositions(bool bVisible, TArray<FVector>& oPositions) const;
+
+private:
+	FVector Target = FVector::ZeroVector;
+	float Radius = 0.f;
+	uint32 GenerationId = 0;
+	uint32 LeafChangeSerial = 0;
+
+	// Every free node and subnode in the field, with its centre and whether that can see the target
+	TArray<AeonixLink> Links;
+	TArray<FVector> Positions;
+	TBitArray<> Visible;
+	TMap<AeonixLink, int32> LinkIndices;
+	int32 NumVisible = 0;
+	bool bIsValid = false;
+};
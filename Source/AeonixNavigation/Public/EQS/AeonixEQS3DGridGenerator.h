@@ -42,7 +42,7 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = Generator)
 	uint8 bOnlyNavigablePoints : 1;
 
-	/** If true, snap generated points to the nearest Aeonix voxel center */
+	/** If true, snap generated points to the nearest Aeonix voxel center, and move blocked points within half the spacing out to the nearest free space */
 	UPROPERTY(EditDefaultsOnly, Category = Generator)
 	uint8 bProjectToNavigation : 1;
 
@@ -2,11 +2,7 @@
 #include "EnvironmentQuery/Items/EnvQueryItemType_Point.h"
 #include "EnvironmentQuery/Contexts/EnvQueryContext_Querier.h"
 #include "NavigationSystem.h"
-#include "Data/AeonixData.h"
 #include "Subsystem/AeonixSubsystem.h"
-#include "Actor/AeonixBoundingVolume.h"
-#include "Util/AeonixMediator.h"
-#include "Data/AeonixLink.h"
 
 UAeonixEQSFloodFillGenerator::UAeonixEQSFloodFillGenerator(const FObjectInitializer& ObjectInitializer)
 {
@@ -34,101 +30,13 @@ void UAeonixEQSFloodFillGenerator::GenerateItems(FEnvQueryInstance& QueryInstanc
     UAeonixSubsystem* AeonixSubsystem = World->GetSubsystem<UAeonixSubsystem>();
     if (!AeonixSubsystem) return;
 
-    float Radius = FloodRadius.GetValue();
-    int32 MaxSteps = FloodStepsMax.GetValue();
-    int32 AgentIdx = NavAgentIndex.GetValue();
-    float MinSpacing = MinPointSpacing.GetValue();
-
-    // Set up spatial bucket filtering if MinSpacing is enabled
-    const bool bUseDensityFiltering = MinSpacing > 0.0f;
-    const float BucketSize = bUseDensityFiltering ? MinSpacing * 0.866f : 0.0f; // Optimal sphere packing
-    const float InvBucketSize = bUseDensityFiltering ? 1.0f / BucketSize : 0.0f;
-    TSet<FIntVector> OccupiedBuckets;
-
-    // Get nav volume and data
-    const AAeonixBoundingVolume* NavVolume = AeonixSubsystem->GetVolumeForPosition(Origin);
-    if (!NavVolume || !NavVolume->HasData()) return;
-
-    // Convert start position to AeonixLink
-    AeonixLink StartLink;
-    if (!AeonixMediator::GetLinkFromPosition(Origin, *NavVolume, StartLink))
+    // The flood itself, and caching it between queries from the same voxel, live in the subsystem
+    TArray<FVector> Points;
+    if (!AeonixSubsystem->GetFloodFillPoints(Origin, FloodRadius.GetValue(), FloodStepsMax.GetValue(), MinPointSpacing.GetValue(), Points))
         return;
 
-    // CRITICAL: Acquire read lock for thread-safe octree access
-    // EQS queries can run on background threads while dynamic regeneration
-    // is modifying the octree on the game thread
-    FReadScopeLock ReadLock(NavVolume->GetOctreeDataLock());
-    const FAeonixData& NavData = NavVolume->GetNavData();
-
-    TSet<AeonixLink> Visited;
-    TQueue<AeonixLink> Queue;
-    Queue.Enqueue(StartLink);
-    Visited.Add(StartLink);
-
-    FVector StartPos;
-    NavData.GetLinkPosition(StartLink, StartPos);
-
-    int32 StepCount = 0;
-    while (!Queue.IsEmpty() && StepCount < MaxSteps)
+    for (const FVector& Point : Points)
     {
-        AeonixLink CurrentLink;
-        Queue.Dequeue(CurrentLink);
-        StepCount++;
-        FVector CurrentPos;
-        if (!NavData.GetLinkPosition(CurrentLink, CurrentPos))
-            continue;
-        if (FVector::DistSquared(CurrentPos, Origin) > Radius * Radius)
-            continue;
-
-        // Apply density filtering if enabled
-        bool bAddPoint = true;
-        if (bUseDensityFiltering)
-        {
-            // Calculate spatial bucket for this point
-            const FIntVector Bucket(
-                FMath::FloorToInt(CurrentPos.X * InvBucketSize),
-                FMath::FloorToInt(CurrentPos.Y * InvBucketSize),
-                FMath::FloorToInt(CurrentPos.Z * InvBucketSize)
-            );
-
-            // Check if bucket is already occupied
-            if (OccupiedBuckets.Contains(Bucket))
-            {
-                bAddPoint = false;
-            }
-            else
-            {
-                OccupiedBuckets.Add(Bucket);
-            }
-        }
-
-        if (bAddPoint)
-        {
-            QueryInstance.AddItemData<UEnvQueryItemType_Point>(CurrentPos);
-        }
-
-        // Get neighbors
-        TArray<AeonixLink> Neighbors;
-        const AeonixNode& CurrentNode = NavData.OctreeData.GetNode(CurrentLink);
-        if (CurrentLink.GetLayerIndex() == 0 && CurrentNode.FirstChild.IsValid())
-        {
-            NavData.OctreeData.GetLeafNeighbours(CurrentLink, Neighbors);
-        }
-        else
-        {
-            NavData.OctreeData.GetNeighbours(CurrentLink, Neighbors);
-        }
-        for (const AeonixLink& Neighbor : Neighbors)
-        {
-            if (!Neighbor.IsValid() || Visited.Contains(Neighbor))
-                continue;
-            FVector NeighborPos;
-            if (!NavData.GetLinkPosition(Neighbor, NeighborPos))
-                continue;
-            if (FVector::DistSquared(NeighborPos, Origin) > Radius * Radius)
-                continue;
-            Visited.Add(Neighbor);
-            Queue.Enqueue(Neighbor);
-        }
+        QueryInstance.AddItemData<UEnvQueryItemType_Point>(Point);
     }
 }
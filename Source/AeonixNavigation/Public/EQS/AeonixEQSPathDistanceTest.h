@@ -0,0 +1,45 @@
+// Copyright 2024 Chris Ashworth
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataProviders/AIDataProvider.h"
+#include "EnvironmentQuery/EnvQueryTest.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "AeonixEQSPathDistanceTest.generated.h"
+
+/**
+ * Scores items by the length of the Aeonix path to them from the context, rather than the straight line distance.
+ *
+ * Every item is scored from a single Dijkstra search out of the context's voxel, bounded by MaxPathDistance,
+ * instead of a path search per item. Items in blocked space, outside the context's volume or beyond the distance are unreachable.
+ */
+UCLASS(EditInlineNew, Category = "Aeonix|EQS")
+class AEONIXNAVIGATION_API UAeonixEQSPathDistanceTest : public UEnvQueryTest
+{
+	GENERATED_BODY()
+
+public:
+	UAeonixEQSPathDistanceTest(const FObjectInitializer& ObjectInitializer);
+
+	virtual void RunTest(FEnvQueryInstance& QueryInstance) const override;
+
+	virtual FText GetDescriptionTitle() const override;
+	virtual FText GetDescriptionDetails() const override;
+
+	/** Path length beyond which items count as unreachable, and where the search stops */
+	UPROPERTY(EditDefaultsOnly, Category = PathDistance)
+	FAIDataProviderFloatValue MaxPathDistance;
+
+	/** If true, unreachable items fail the test, otherwise they're scored as BIG_NUMBER */
+	UPROPERTY(EditDefaultsOnly, Category = PathDistance)
+	FAIDataProviderBoolValue SkipUnreachable;
+
+	/** Costs and clearance the search uses, as for an agent's path requests */
+	UPROPERTY(EditDefaultsOnly, Category = PathDistance)
+	FAeonixPathFinderSettings PathfinderSettings;
+
+	/** Context the paths start from */
+	UPROPERTY(EditDefaultsOnly, Category = PathDistance)
+	TSubclassOf<UEnvQueryContext> Context;
+};
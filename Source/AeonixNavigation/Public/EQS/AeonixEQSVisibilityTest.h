@@ -0,0 +1,36 @@
+// Copyright 2024 Chris Ashworth
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataProviders/AIDataProvider.h"
+#include "EnvironmentQuery/EnvQueryTest.h"
+#include "AeonixEQSVisibilityTest.generated.h"
+
+/**
+ * Tests whether each item's Aeonix voxel has line of sight to the context, through the octree's blocked voxels rather than physics traces.
+ *
+ * The whole item set is answered from one visibility field built round the context, out to the furthest item or MaxRadius.
+ * Items in blocked space, outside the context's volume or beyond MaxRadius fail the test.
+ */
+UCLASS(EditInlineNew, Category = "Aeonix|EQS")
+class AEONIXNAVIGATION_API UAeonixEQSVisibilityTest : public UEnvQueryTest
+{
+	GENERATED_BODY()
+
+public:
+	UAeonixEQSVisibilityTest(const FObjectInitializer& ObjectInitializer);
+
+	virtual void RunTest(FEnvQueryInstance& QueryInstance) const override;
+
+	virtual FText GetDescriptionTitle() const override;
+	virtual FText GetDescriptionDetails() const override;
+
+	/** Furthest from the context an item can be and still be tested */
+	UPROPERTY(EditDefaultsOnly, Category = Visibility)
+	FAIDataProviderFloatValue MaxRadius;
+
+	/** Context the lines of sight run to, such as the player */
+	UPROPERTY(EditDefaultsOnly, Category = Visibility)
+	TSubclassOf<UEnvQueryContext> Context;
+};
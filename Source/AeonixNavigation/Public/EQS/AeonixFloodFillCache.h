@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Data/AeonixLink.h"
+
+#include "Containers/LruCache.h"
+#include "UObject/ObjectKey.h"
+
+class AAeonixBoundingVolume;
+
+struct AEONIXNAVIGATION_API FAeonixFloodFillCacheKey
+{
+	TObjectKey<AAeonixBoundingVolume> Volume;
+	AeonixLink Origin;
+	float Radius = 0.f;
+	int32 MaxSteps = 0;
+	float MinSpacing = 0.f;
+
+	bool operator==(const FAeonixFloodFillCacheKey& Other) const
+	{
+		return Volume == Other.Volume && Origin == Other.Origin && Radius == Other.Radius && MaxSteps == Other.MaxSteps && MinSpacing == Other.MinSpacing;
+	}
+
+	friend uint32 GetTypeHash(const FAeonixFloodFillCacheKey& Key)
+	{
+		uint32 Hash = HashCombineFast(GetTypeHash(Key.Volume), GetTypeHash(Key.Origin));
+		Hash = HashCombineFast(Hash, GetTypeHash(Key.Radius));
+		Hash = HashCombineFast(Hash, GetTypeHash(Key.MaxSteps));
+		return HashCombineFast(Hash, GetTypeHash(Key.MinSpacing));
+	}
+};
+
+/**
+ * Least recently used cache of flood fill EQS results, keyed by origin voxel, radius, step limit and point spacing.
+ * Each entry remembers the version of every dynamic region overlapping its radius and the generation of the volume it was flooded in,
+ * a lookup drops the entry if either has moved on. Locked internally, as EQS queries can run off the game thread.
+ */
+class AEONIXNAVIGATION_API FAeonixFloodFillCache
+{
+public:
+	/** Sets the maximum number of entries and clears the cache, 0 disables caching */
+	void SetCapacity(int32 InMaxEntries);
+	bool IsEnabled() const { return MaxEntries > 0; }
+
+	/** Copies the cached points into OutPoints. Returns false on a miss, or if the entry was stale */
+	bool Find(const FAeonixFloodFillCacheKey& Key, uint32 GenerationId, TFunctionRef<uint32(const FGuid&)> GetRegionVersion, TArray<FVector>& OutPoints);
+
+	/** Stores a flood's points. RegionVersions should hold the versions of the regions overlapping its radius when it ran */
+	void Add(const FAeonixFloodFillCacheKey& Key, uint32 GenerationId, const TArray<FVector>& Points, TMap<FGuid, uint32>&& RegionVersions);
+
+	void Empty();
+
+private:
+	struct FEntry
+	{
+		TArray<FVector> Points;
+		TMap<FGuid, uint32> RegionVersions;
+		uint32 GenerationId = 0;
+	};
+
+	FCriticalSection Lock;
+	TLruCache<FAeonixFloodFillCacheKey, FEntry> Entries;
+	int32 MaxEntries = 0;
+};
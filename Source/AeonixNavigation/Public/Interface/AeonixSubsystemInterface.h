@@ -59,8 +59,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Aeonix")
 	virtual FAeonixPathFindRequestCompleteDelegate& FindPathAsyncAgent(UAeonixNavAgentComponent* NavAgentComponent, const FVector& End, FAeonixNavigationPath& OutPath) = 0;
 
+	/** Like FindPathAsyncAgent, but the search runs on the game thread within a per frame iteration budget instead of on a worker */
 	UFUNCTION(BlueprintCallable, Category="Aeonix")
-	virtual bool FindPathImmediateAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, FAeonixNavigationPath& OutPath) = 0;
+	virtual FAeonixPathFindRequestCompleteDelegate& FindPathTimeSlicedAgent(UAeonixNavAgentComponent* NavAgentComponent, const FVector& End, FAeonixNavigationPath& OutPath) = 0;
+
+	/** Searches to completion before returning, bounded by the agent's MaxIterations. A MaxIterations above 0 caps this call's search below that, and running out
+	    returns true with OutPath flagged partial, as with bReturnPartialPath. Use FindPathTimeSlicedAgent to spread a full search over several frames */
+	UFUNCTION(BlueprintCallable, Category="Aeonix")
+	virtual bool FindPathImmediateAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, FAeonixNavigationPath& OutPath, int32 MaxIterations = 0) = 0;
+
+	/** Single search to whichever of Ends is cheapest to reach, OutGoalIndex is the index into Ends of the goal the path leads to */
+	UFUNCTION()
+	virtual bool FindPathToNearestImmediateAgent(UAeonixNavAgentComponent* NavigationComponent, const TArray<FVector>& Ends, FAeonixNavigationPath& OutPath, int32& OutGoalIndex) = 0;
+
+	/** Async version of FindPathToNearestImmediateAgent, OutGoalIndex is written along with OutPath when the result is delivered */
+	UFUNCTION()
+	virtual FAeonixPathFindRequestCompleteDelegate& FindPathToNearestAsyncAgent(UAeonixNavAgentComponent* NavigationComponent, const TArray<FVector>& Ends, FAeonixNavigationPath& OutPath, int32& OutGoalIndex) = 0;
 
 	UFUNCTION()
 	virtual void UpdateComponents() = 0;
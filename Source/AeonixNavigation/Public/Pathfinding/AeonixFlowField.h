@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Data/AeonixLink.h"
+
+/**
+ * Shortest path tree rooted at a single target, shared by every agent heading to the same place.
+ * A Dijkstra search runs outwards from the target and each link it settles stores the next hop back towards it,
+ * so a path is read off in O(path length). The search is lazy, it only expands until the requested start is settled
+ * and the next request resumes from where it stopped. Built and read through AeonixPathFinder::FindPathFromFlowField.
+ */
+class AEONIXNAVIGATION_API FAeonixFlowField
+{
+public:
+	/** Starts a new field rooted at InTargetLink, discarding the old one. GenerationId should be that of the nav data it is searched on */
+	void Reset(const AeonixLink& InTargetLink, const FVector& InTargetPosition, uint32 InGenerationId);
+
+	/** Moves the target within its voxel, the tree is unchanged so nothing needs rebuilding */
+	void SetTargetPosition(const FVector& InTargetPosition) { TargetPosition = InTargetPosition; }
+
+	/** Drops the field, it must be Reset before it can be used again */
+	void Invalidate();
+
+	bool IsValid() const { return TargetLink.IsValid(); }
+	const AeonixLink& GetTargetLink() const { return TargetLink; }
+	const FVector& GetTargetPosition() const { return TargetPosition; }
+	uint32 GetGenerationId() const { return GenerationId; }
+
+	/** Number of links whose next hop is final */
+	int32 GetNumSettled() const { return Settled.Num(); }
+	bool IsSettled(const AeonixLink& Link) const { return Settled.Contains(Link); }
+
+	/** Set once the search has run out of links, anything unsettled by then can't reach the target */
+	bool IsExhausted() const { return IsValid() && OpenHeap.Num() == 0; }
+
+private:
+	friend class AeonixPathFinder;
+
+	struct FOpenEntry
+	{
+		AeonixLink Link;
+		float Cost;
+
+		bool operator<(const FOpenEntry& Other) const { return Cost < Other.Cost; }
+	};
+
+	AeonixLink TargetLink;
+	FVector TargetPosition = FVector::ZeroVector;
+	uint32 GenerationId = 0;
+
+	// Next hop towards the target, tentative until the link is settled
+	TMap<AeonixLink, AeonixLink> NextHop;
+	TMap<AeonixLink, float> Cost;
+	TSet<AeonixLink> Settled;
+
+	// Min-heap with lazy deletion, entries for links that have since been settled are skipped when popped
+	TArray<FOpenEntry> OpenHeap;
+};
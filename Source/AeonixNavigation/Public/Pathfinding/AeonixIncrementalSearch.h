@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Data/AeonixLink.h"
+
+/**
+ * Persistent D* Lite state for one agent's path, searched backwards from the goal so the agent can keep moving without invalidating it.
+ * After a dynamic regen only the vertices in and around the leaves that changed are repaired, rather than searching again from scratch.
+ * Searched and read through AeonixPathFinder::FindPathIncremental, one instance per agent, searched by one thread at a time.
+ */
+class AEONIXNAVIGATION_API FAeonixIncrementalSearch
+{
+public:
+	/** Drops all state, the next search starts from scratch */
+	void Reset();
+
+	bool IsValid() const { return GoalLink.IsValid(); }
+	const AeonixLink& GetGoalLink() const { return GoalLink; }
+
+	/** Vertices expanded by the most recent search or repair */
+	int32 GetLastExpansions() const { return LastExpansions; }
+
+	/** Whether the most recent search was a repair of earlier state, rather than a search from scratch */
+	bool WasLastSearchRepair() const { return bLastSearchWasRepair; }
+
+private:
+	friend class AeonixPathFinder;
+
+	struct FKey
+	{
+		float Primary = FLT_MAX;
+		float Secondary = FLT_MAX;
+
+		bool operator<(const FKey& Other) const
+		{
+			return Primary < Other.Primary || (Primary == Other.Primary && Secondary < Other.Secondary);
+		}
+		bool operator==(const FKey& Other) const { return Primary == Other.Primary && Secondary == Other.Secondary; }
+	};
+
+	struct FOpenEntry
+	{
+		FKey Key;
+		AeonixLink Link;
+
+		bool operator<(const FOpenEntry& Other) const { return Key < Other.Key; }
+	};
+
+	AeonixLink GoalLink;
+	// Start the keys were last computed against, the heuristic moves with it
+	AeonixLink LastStart;
+	float KeyModifier = 0.f;
+
+	// The nav data this state was searched on
+	uint32 GenerationId = 0;
+	uint32 LeafChangeSerial = 0;
+
+	// Missing entries are infinite
+	TMap<AeonixLink, float> G;
+	TMap<AeonixLink, float> Rhs;
+
+	// Current key of every link in the open list, heap entries that don't match are stale and skipped
+	TMap<AeonixLink, FKey> OpenKeys;
+	TArray<FOpenEntry> OpenHeap;
+
+	int32 LastExpansions = 0;
+	bool bLastSearchWasRepair = false;
+};
@@ -108,6 +108,10 @@ public:
 	bool IsReady() const { return myIsReady; };
 	void SetIsReady(bool aIsReady) { myIsReady = aIsReady; }
 
+	// A partial path stops short of the target, at the point the search got nearest to it
+	bool IsPartial() const { return myIsPartial; }
+	void SetIsPartial(bool aIsPartial) { myIsPartial = aIsPartial; }
+
 	// Copy the path positions into a standard navigation path
 	void CreateNavPath(FNavigationPath& aOutPath);
 
@@ -123,6 +127,7 @@ public:
 
 protected:
 	bool myIsReady;
+	bool myIsPartial = false;
 	TArray<FAeonixPathPoint> myPoints;
 #if WITH_EDITOR
 	TArray<FDebugVoxelInfo> myDebugVoxelInfo;
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Data/AeonixLink.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+
+#include "Containers/LruCache.h"
+#include "UObject/ObjectKey.h"
+
+class AAeonixBoundingVolume;
+struct FAeonixPathFinderSettings;
+
+struct AEONIXNAVIGATION_API FAeonixPathCacheKey
+{
+	TObjectKey<AAeonixBoundingVolume> Volume;
+	AeonixLink Start;
+	AeonixLink Goal;
+	uint32 SettingsHash = 0;
+	/** Compared in full on a lookup, so settings that only share a hash never share a path */
+	TSharedPtr<const FAeonixPathFinderSettings> Settings;
+
+	/** Copies the settings into the key along with their hash */
+	void SetSettings(const FAeonixPathFinderSettings& InSettings);
+
+	bool operator==(const FAeonixPathCacheKey& Other) const;
+
+	friend uint32 GetTypeHash(const FAeonixPathCacheKey& Key)
+	{
+		uint32 Hash = HashCombineFast(GetTypeHash(Key.Volume), GetTypeHash(Key.Start));
+		Hash = HashCombineFast(Hash, GetTypeHash(Key.Goal));
+		return HashCombineFast(Hash, Key.SettingsHash);
+	}
+};
+
+/**
+ * Least recently used cache of finished paths, keyed by start link, goal link and pathfinder settings.
+ * Each entry remembers the version of every dynamic region it passes through and the generation of the volume it was found in,
+ * a lookup drops the entry if either has moved on. Game thread only.
+ */
+class AEONIXNAVIGATION_API FAeonixPathCache
+{
+public:
+	/** Sets the maximum number of entries and clears the cache, 0 disables caching */
+	void SetCapacity(int32 InMaxEntries);
+	bool IsEnabled() const { return MaxEntries > 0; }
+	int32 Num() const { return Entries.Num(); }
+
+	/** Copies a cached path into OutPath with its end points moved to the requested positions. Returns false on a miss, if the entry was stale,
+	    or if IsSegmentClear finds the moved end points can't reach the rest of the path */
+	bool Find(const FAeonixPathCacheKey& Key, uint32 GenerationId, TFunctionRef<uint32(const FGuid&)> GetRegionVersion,
+		TFunctionRef<bool(const FVector&, const FVector&)> IsSegmentClear, const FVector& StartPosition, const FVector& EndPosition, FAeonixNavigationPath& OutPath);
+
+	/** Stores a finished path. RegionVersions should hold the versions the search ran against for the regions the path traverses */
+	void Add(const FAeonixPathCacheKey& Key, uint32 GenerationId, const FAeonixNavigationPath& Path, TMap<FGuid, uint32>&& RegionVersions);
+
+	void Empty();
+
+private:
+	struct FEntry
+	{
+		TArray<FAeonixPathPoint> Points;
+		TMap<FGuid, uint32> RegionVersions;
+		uint32 GenerationId = 0;
+	};
+
+	TLruCache<FAeonixPathCacheKey, FEntry> Entries;
+	int32 MaxEntries = 0;
+};
@@ -2,10 +2,14 @@
 
 #include "Pathfinding/AeonixNavigationPath.h"
 #include "Data/AeonixLink.h"
+#include "Data/AeonixTypes.h"
+#include "Data/AeonixVisibilityField.h"
+#include "Pathfinding/AeonixIncrementalSearch.h"
 
 #include "AeonixPathFinder.generated.h"
 
 class AAeonixBoundingVolume;
+class FAeonixFlowField;
 
 struct FNavigationPath;
 struct FAeonixNavigationPath;
@@ -20,6 +24,10 @@ struct FAeonixHeuristicSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Heuristics", meta=(ClampMin="0.0"))
 	float EuclideanWeight{1.0f};
 
+	/** Use the larger of the straight line and the volume's landmark (ALT) bound as the heuristic, when it has landmarks. Far better informed round obstacles, and as it never overestimates the other weights don't apply to it, so paths are as short as an unweighted search's with far fewer iterations than one. Not used with unit cost or any-angle search */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Heuristics")
+	bool bUseLandmarks{false};
+
 	/** Weight factor for velocity heuristic (favors maintaining direction) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Heuristics", meta=(ClampMin="0.0"))
 	float VelocityWeight{0.0f};
@@ -99,6 +107,33 @@ struct FAeonixPathFinderSettings
 	/** Max iterations for the A* pathfinding algorithm */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeonix")
 	int32 MaxIterations{5000};
+	/** When MaxIterations is hit, return a partial path to the explored node closest to the target instead of failing. Move tasks follow it while they search on from its end */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeonix")
+	bool bReturnPartialPath{false};
+	/** Use jump point search inside leaf nodes, skipping along runs of free subnodes instead of expanding each one. Greatly reduces iterations in dynamic regions */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeonix")
+	bool bUseLeafJumpPointSearch{false};
+	/** Expand each locally connected free region of a leaf as one node, stepping straight to where it meets the next leaf or node. The subnodes crossed are only filled in once the path is found. Far fewer iterations through cluttered leaves, takes priority over leaf jump point search and isn't used with any-angle search */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeonix")
+	bool bExpandLeafRegions{false};
+	/** Cross leaves with no blocked subnodes as a single node, entered at one facing subnode rather than expanding each of their 64. Mostly helps dynamic regions, whose layer 0 nodes always get leaves even when empty. Not used with any-angle search */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeonix")
+	bool bCollapseEmptyLeaves{false};
+	/** Free space this agent needs round it beyond the volume's baked AgentRadius. Nodes and subnodes with less clearance are never entered, other than the goals. Needs the volume to bake clearance, and is ignored until it has. Leaf regions, empty leaf collapsing and leaf jump points step past subnodes unchecked, so aren't used with it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeonix", meta=(ClampMin="0.0"))
+	float AgentRadius{0.f};
+	/** Cost multiplier for moving into a node or subnode VisibilityField can see, above 1 to keep the agent out of sight of the field's target where a detour allows.
+	    Leaf regions and empty leaf collapsing step past subnodes unweighted, so aren't used with it, and any-angle search ignores it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeonix", meta=(ClampMin="1.0"))
+	float VisibleCostMultiplier{1.0f};
+	/** Field from UAeonixSubsystem::BuildVisibilityField that VisibleCostMultiplier applies to, built on the volume being searched */
+	TSharedPtr<const FAeonixVisibilityField> VisibilityField;
+	/** Use Lazy Theta* any-angle search, connecting nodes by octree line of sight during the search. Paths come out straight, so string pulling and position smoothing are skipped */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeonix")
+	bool bUseAnyAnglePathfinding{false};
+	/** Score each expanded node's neighbours four at a time with SIMD rather than one by one. The same search in single precision, and much cheaper round large nodes with many neighbours. Not used with any-angle search */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeonix")
+	bool bVectorizeNeighbourExpansion{false};
 	/** Heuristic calculation settings for pathfinding algorithm */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeonix")
 	FAeonixHeuristicSettings HeuristicSettings;
@@ -117,6 +152,9 @@ struct FAeonixPathFinderSettings
 	/** Controls how much a path can deviate as a fraction of voxel size (lower values create tighter paths) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeonix", meta=(EditCondition="bUseStringPulling", ClampMin="0.1", ClampMax="1.0"))
 	float StringPullingVoxelThreshold{0.16841f};
+	/** String pull by octree line of sight rather than the voxel threshold, each kept point skipping ahead to a later point it can see. Shortcuts are always clear, so smoothing is skipped */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeonix", meta=(EditCondition="bUseStringPulling"))
+	bool bUseVisibilityStringPulling{false};
 	/** Adjust point positions within voxel bounds for smoother paths */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeonix")
 	bool bSmoothPositions{true};
@@ -130,6 +168,11 @@ struct FAeonixPathFinderSettings
 	mutable TArray<FVector> DebugPoints;
 };
 
+/** Hash of every setting that affects the resulting path, used to key cached paths. Keep in step with the settings above */
+AEONIXNAVIGATION_API uint32 GetTypeHash(const FAeonixPathFinderSettings& Settings);
+/** Every setting matches, including the visibility field, which isn't a property. The hash only narrows a lookup down, this confirms it */
+AEONIXNAVIGATION_API bool operator==(const FAeonixPathFinderSettings& A, const FAeonixPathFinderSettings& B);
+
 class AEONIXNAVIGATION_API AeonixPathFinder
 {
 public:
@@ -138,14 +181,55 @@ public:
 		, Settings(Settings)
 		, LastIterationCount(0){};
 
-	/* Performs an A* search from start to target navlink */
+	/* Performs an A* search from start to target navlink. With bReturnPartialPath, running out of iterations still returns true, with oPath flagged partial */
 	bool FindPath(const AeonixLink& aStart, const AeonixLink& aTarget, const FVector& aStartPos, const FVector& aTargetPos, FAeonixNavigationPath& oPath, FAeonixPathFailureInfo* OutFailureInfo = nullptr);
 
+	/* Performs a single A* search towards several goals, stopping at whichever is reached first. oGoalIndex is the index of that goal in aGoals */
+	bool FindPathToNearestGoal(const AeonixLink& aStart, const TArray<AeonixLink>& aGoals, const FVector& aStartPos, const TArray<FVector>& aTargetPositions, FAeonixNavigationPath& oPath, int32& oGoalIndex, FAeonixPathFailureInfo* OutFailureInfo = nullptr);
+
+	/* Starts a resumable A* search towards the nearest of aGoals without running any of it. The search state is kept in this pathfinder, advance it with StepPath */
+	void BeginPath(const AeonixLink& aStart, const TArray<AeonixLink>& aGoals, const FVector& aStartPos, const TArray<FVector>& aTargetPositions);
+
+	/* Runs at most aIterationBudget more iterations of the search started by BeginPath. Returns InProgress if it needs more, otherwise Complete or Failed.
+	   MaxIterations still limits the search as a whole, and the nav data must not change between calls */
+	EAeonixPathFindStatus StepPath(int32 aIterationBudget, FAeonixNavigationPath& oPath, FAeonixPathFailureInfo* OutFailureInfo = nullptr);
+
+	/* Whether the search started by BeginPath has generated any subnode of aLeaves. If not, changes to those leaves can't have affected anything it has found so far */
+	bool HasSearchReachedLeaves(const TSet<nodeindex_t>& aLeaves) const;
+
+	/* Ends the search started by BeginPath with a partial path to the expanded link closest to a goal, skipping any whose way back to the start crosses aAvoidLeaves.
+	   Partial, or Failed if no link but the start qualifies */
+	EAeonixPathFindStatus EndPathPartial(const TSet<nodeindex_t>& aAvoidLeaves, FAeonixNavigationPath& oPath);
+
+	/* Index into the goals given to BeginPath of the one the completed search reached */
+	int32 GetReachedGoalIndex() const { return GoalLinks.Find(GoalLink); }
+
+	/* Reads the path from aStart to the field's target, first expanding the field until aStart is settled. Fails if that takes more than MaxIterations, or the target can't be reached.
+	   aMaxExpansions caps the links this call may settle below MaxIterations, so callers on the game thread can spread a field's growth over several frames. The field keeps what was settled either way */
+	bool FindPathFromFlowField(FAeonixFlowField& ioField, const AeonixLink& aStart, const FVector& aStartPos, FAeonixNavigationPath& oPath, int32 aMaxExpansions = INDEX_NONE);
+
+	/* Single Dijkstra search from aStart that settles every link within aMaxDistance of path cost, or until all of aTargets are settled. MaxIterations doesn't apply, the radius is the bound.
+	   oDistances holds the path cost to each of aTargets from the centre of aStart, -1 for targets that are invalid, unreachable or further than aMaxDistance */
+	void FindPathDistances(const AeonixLink& aStart, float aMaxDistance, TConstArrayView<AeonixLink> aTargets, TArray<float>& oDistances);
+
+	/* D* Lite search that keeps its state in ioSearch. Searches from scratch the first time, or if the goal or nav data generation changed,
+	   otherwise only repairs the leaves changed by regens since the last call and the move of the start */
+	bool FindPathIncremental(FAeonixIncrementalSearch& ioSearch, const AeonixLink& aStart, const AeonixLink& aGoal, const FVector& aStartPos, const FVector& aTargetPos, FAeonixNavigationPath& oPath);
+
+	/* Greedy line of sight string pulling over node centres, binary searching for a point each kept point can see and removing the skipped points.
+	   Every kept segment is tested clear. Returns false, leaving pathPoints as they were, if a point can't even see the next one */
+	bool VisibilityPullPath(TArray<FAeonixPathPoint>& pathPoints);
+
 	/* Returns the number of iterations used in the last FindPath call */
 	int32 GetLastIterationCount() const { return LastIterationCount; }
 
+	/* Returns the number of line of sight tests made by visibility string pulling in the last FindPath call */
+	int32 GetLastVisibilityTestCount() const { return LastVisibilityTestCount; }
+
 private:
 
+	// The search containers are reset rather than freed by each search, so reusing one pathfinder for a batch of searches only allocates for the largest
+
 	// Min-heap for open set (sorted by FScore)
 	TArray<AeonixLink> OpenHeap;
 	// Fast lookup to check if a link is in the open set
@@ -157,6 +241,47 @@ private:
 	TMap<AeonixLink, float> GScore;
 	TMap<AeonixLink, float> FScore;
 
+	// Any-angle only: the node that actually generated each link, used when line of sight to the assumed parent fails
+	TMap<AeonixLink, AeonixLink> GridParent;
+
+	// Neighbours of the link being expanded
+	TArray<AeonixLink> NeighbourScratch;
+	// Neighbours UpdateIncrementalVertex looks ahead through, kept apart as its callers are iterating neighbours of their own
+	TArray<AeonixLink> VertexNeighbourScratch;
+
+	// Min-heap for FindPathDistances, with lazy deletion of entries for links settled through a cheaper one
+	struct FDistanceEntry
+	{
+		AeonixLink Link;
+		float Cost;
+
+		bool operator<(const FDistanceEntry& Other) const { return Cost < Other.Cost; }
+	};
+	TArray<FDistanceEntry> DistanceHeap;
+
+	// Leaf regions already expanded by the current search, each keyed by the link of its lowest subnode
+	TSet<AeonixLink> ClosedLeafRegions;
+
+	// Open neighbours of the link being expanded as structure of arrays, padded to a multiple of four for ExpandNeighbours
+	struct FNeighbourLanes
+	{
+		TArray<AeonixLink> Links;
+		TArray<float, TAlignedHeapAllocator<16>> X;
+		TArray<float, TAlignedHeapAllocator<16>> Y;
+		TArray<float, TAlignedHeapAllocator<16>> Z;
+		// 1 where the velocity heuristic applies, 0 where the neighbour is the current link's parent
+		TArray<float, TAlignedHeapAllocator<16>> VelocityMask;
+		TArray<float, TAlignedHeapAllocator<16>> Cost;
+		TArray<float, TAlignedHeapAllocator<16>> GoalDistance;
+		TArray<float, TAlignedHeapAllocator<16>> Heuristic;
+
+		void SetNum(int32 aNumLanes);
+	};
+	FNeighbourLanes NeighbourLanes;
+
+	// Link position of each goal, which the heuristic measures to
+	TArray<FVector> GoalLinkPositions;
+
 	// Predicate for min-heap ordering by FScore
 	struct FScoreHeapPredicate
 	{
@@ -174,17 +299,73 @@ private:
 
 	AeonixLink StartLink;
 	AeonixLink CurrentLink;
+	// The goal that was reached, or the first goal while the search is running
 	AeonixLink GoalLink;
 
+	// Every goal of the current search, with the exact target position for each
+	TArray<AeonixLink> GoalLinks;
+	TArray<FVector> GoalPositions;
+
+	FVector StartPosition;
+	FVector TargetPosition;
+
 	const FAeonixData& NavigationData;
 
 	const FAeonixPathFinderSettings& Settings;
 	/* Stores the iteration count from the most recent FindPath call */
 	int32 LastIterationCount;
+	/* Line of sight tests made by the most recent visibility string pull */
+	int32 LastVisibilityTestCount{0};
+
+	// Counters for iteration explosion debugging, logged when a search hits MaxIterations
+	struct FSearchDiagnostics
+	{
+		TSet<AeonixLink> UniqueNodesProcessed;
+		int32 DuplicatePopCount = 0;
+		int32 TotalNeighborsGenerated = 0;
+		int32 MaxNeighborsInSingleIteration = 0;
+		int32 EmptyLeafNeighbourCount = 0;
+		int32 NonEmptyLeafNeighbourCount = 0;
+		int32 HigherLayerNeighbourCount = 0;
+
+		void Reset()
+		{
+			UniqueNodesProcessed.Reset();
+			DuplicatePopCount = 0;
+			TotalNeighborsGenerated = 0;
+			MaxNeighborsInSingleIteration = 0;
+			EmptyLeafNeighbourCount = 0;
+			NonEmptyLeafNeighbourCount = 0;
+			HigherLayerNeighbourCount = 0;
+		}
+	};
+
+	/* Iterations run so far by the current search, carried across StepSearch calls */
+	int32 SearchIterations{0};
+	FSearchDiagnostics Diagnostics;
+
+	/* Closed link nearest any goal, where a partial path ends */
+	AeonixLink BestPartialLink;
+	float BestPartialDistance{FLT_MAX};
+
+	/* Runs the search from aStart until any of GoalLinks is reached */
+	bool SearchToGoals(const AeonixLink& aStart, const FVector& aStartPos, FAeonixNavigationPath& oPath, FAeonixPathFailureInfo* OutFailureInfo);
+
+	/* Resets the search state and opens aStart */
+	void BeginSearch(const AeonixLink& aStart, const FVector& aStartPos);
+
+	/* Runs the open search for up to aIterationBudget iterations */
+	EAeonixPathFindStatus StepSearch(int32 aIterationBudget, FAeonixNavigationPath& oPath, FAeonixPathFailureInfo* OutFailureInfo);
 
 	/* Unified A* heuristic calculation combining euclidean, velocity, and node size components */
 	float CalculateHeuristic(const AeonixLink& aStart, const AeonixLink& aTarget, const AeonixLink& aParent = AeonixLink());
 
+	/* Heuristic to the nearest of GoalLinks */
+	float CalculateGoalHeuristic(const AeonixLink& aLink, const AeonixLink& aParent = AeonixLink());
+
+	/* Goal sharing a leaf with aLink, for jump point search, or the first goal if there isn't one */
+	AeonixLink GetGoalInLeaf(const AeonixLink& aLink) const;
+
 	/* Distance between two links */
 	float GetCost(const AeonixLink& aStart, const AeonixLink& aTarget);
 
@@ -193,12 +374,87 @@ private:
 
 	void ProcessLink(const AeonixLink& aNeighbour);
 
+	/* ProcessLink for all of aNeighbours at once, costs and heuristics are computed four neighbours at a time then the improved ones are pushed to the open set */
+	void ExpandNeighbours(const TArray<AeonixLink>& aNeighbours);
+
+	/* Position used for any-angle line of sight and costs, the exact start and target positions stand in for their links */
+	FVector GetSearchPosition(const AeonixLink& aLink) const;
+
+	/* Records CurrentLink as the partial path end if it is nearer a goal than the last */
+	void UpdateBestPartialLink();
+
+	/* Lazy Theta* vertex check, if the assumed parent can't see the current link it takes the closed neighbour that reaches it most cheaply instead */
+	void ValidateAnyAngleParent();
+
+	/* Continues the field's Dijkstra search until aUntil is settled, or aMaxIterations links have been */
+	bool ExpandFlowField(FAeonixFlowField& ioField, const AeonixLink& aUntil, int32 aMaxIterations);
+
+	/* Runs D* Lite until the start is consistent */
+	bool ComputeIncrementalPath(FAeonixIncrementalSearch& ioSearch);
+
+	/* Recomputes the rhs of aLink from its neighbours and requeues it if inconsistent */
+	void UpdateIncrementalVertex(FAeonixIncrementalSearch& ioSearch, const AeonixLink& aLink);
+
+	FAeonixIncrementalSearch::FKey CalculateIncrementalKey(const FAeonixIncrementalSearch& aSearch, const AeonixLink& aLink);
+
+	/* Straight line distance, or zero with unit costs */
+	float GetIncrementalHeuristic(const AeonixLink& aFrom, const AeonixLink& aTo) const;
+
+	/* Whether leaf subnodes are expanded a whole region at a time */
+	bool ShouldExpandLeafRegions() const { return Settings.bExpandLeafRegions && !Settings.bUseAnyAnglePathfinding && !ShouldFilterByClearance() && !ShouldWeightVisibility(); }
+
+	/* Whether empty leaves are crossed as a single node */
+	bool ShouldCollapseEmptyLeaves() const { return Settings.bCollapseEmptyLeaves && !Settings.bUseAnyAnglePathfinding && !ShouldFilterByClearance() && !ShouldWeightVisibility(); }
+
+	/* Whether the heuristic is the admissible landmark bound, which needs landmarks measured with the default edge costs */
+	bool ShouldUseLandmarks() const { return Settings.HeuristicSettings.bUseLandmarks && !Settings.bUseUnitCost && !Settings.bUseAnyAnglePathfinding && NavigationData.GetLandmarks().IsValid(); }
+
+	/* Whether moves into links the visibility field sees cost more, and no regen has changed the nav data since the field was built */
+	bool ShouldWeightVisibility() const { return Settings.VisibleCostMultiplier > 1.f && Settings.VisibilityField.IsValid() && Settings.VisibilityField->IsCurrent(NavigationData); }
+
+	/* Multiplier for the cost of moving into aLink, VisibleCostMultiplier if the visibility field sees it, otherwise 1 */
+	float GetVisibilityCostScale(const AeonixLink& aLink) const;
+
+	/* Whether the agent needs more room than the bake gave it, and the clearance to check that against is up to date */
+	bool ShouldFilterByClearance() const { return Settings.AgentRadius > 0.f && NavigationData.GetClearance().IsValid(); }
+
+	/* Drops the links the agent doesn't fit at, other than goals */
+	void FilterByClearance(TArray<AeonixLink>& ioNeighbours) const;
+
+	/* Keeps only the nearest subnode of each empty leaf in ioNeighbours, so a large node facing one isn't given all 16 of its face subnodes */
+	void CollapseEmptyLeafNeighbours(TArray<AeonixLink>& ioNeighbours) const;
+
+	/* Marks the leaf region of aLink as expanded. Returns false if it already was, or 0 in oRegion if aLink is blocked */
+	bool CloseLeafRegion(const AeonixLink& aLink, uint64& oRegion);
+
+	/* Everything reachable by leaving aRegion, the region of leaf subnode aLink: goals inside it, each free node it faces, and one entry subnode per region of each leaf it faces */
+	void GetLeafRegionNeighbours(const AeonixLink& aLink, uint64 aRegion, TArray<AeonixLink>& oNeighbours) const;
+
+	/* Fills in the subnodes crossed inside each leaf region of aLinks, ordered start first, so every step is between adjacent links */
+	void ResolveLeafRegionLinks(const TArray<AeonixLink>& aLinks, TArray<AeonixLink>& oLinks) const;
+
+	/* Neighbours as the plain A* sees them, without jump points */
+	void GetSearchNeighbours(const AeonixLink& aLink, TArray<AeonixLink>& oNeighbours) const;
+
+	/* Whether aLink is a blocked leaf subnode */
+	bool IsLinkBlocked(const AeonixLink& aLink) const;
+
+	/* Builds the path through aLinks, ordered start first */
+	void BuildPathFromLinks(const TArray<AeonixLink>& aLinks, const FVector& aStartPos, const FVector& aTargetPos, FAeonixNavigationPath& oPath);
+
+	/* Layer recorded on a path point for aLink, leaf subnodes are 0 and everything else is offset by one */
+	int32 GetPathPointLayer(const AeonixLink& aLink) const;
+
 	/* Constructs the path by navigating back through our CameFrom map */
 	void BuildPath(TMap<AeonixLink, AeonixLink>& aCameFrom, AeonixLink aCurrent, const FVector& aStartPos, const FVector& aTargetPos, FAeonixNavigationPath& oPath);
 
+	/* Smooths, string pulls and prunes raw points ordered target first, then appends them to oPath start first */
+	void FinalizePath(TArray<FAeonixPathPoint>& points, bool bRefinePath, FAeonixNavigationPath& oPath);
+
 	/* Implements corridor-based string pulling algorithm to smooth path by removing unnecessary waypoints */
 	void StringPullPath(TArray<FAeonixPathPoint>& pathPoints);
 
+
 	/* Adjusts path point positions within voxel bounds to create smoother paths */
 	void SmoothPathPositions(TArray<FAeonixPathPoint>& pathPoints);
 
@@ -117,12 +117,6 @@ public:
 	);
 
 private:
-	/**
-	 * Collect all navigable node links from the navigation data
-	 * Only includes nodes that can be used as pathfinding targets
-	 */
-	void CollectNavigableNodes(FAeonixData& NavData, TArray<AeonixLink>& OutNodes);
-
 	/**
 	 * Calculate summary statistics from individual results
 	 */
@@ -25,10 +25,18 @@ public:
 	/**
 	 * Number of worker threads for async pathfinding operations.
 	 * Recommended: 2-8 threads depending on CPU core count.
+	 * 0 runs async requests time sliced on the game thread instead, for platforms that can't spare a thread.
 	 */
-	UPROPERTY(config, EditAnywhere, Category = "Pathfinding", meta = (ClampMin = "1", ClampMax = "16", UIMin = "1", UIMax = "8"))
+	UPROPERTY(config, EditAnywhere, Category = "Pathfinding", meta = (ClampMin = "0", ClampMax = "16", UIMin = "0", UIMax = "8"))
 	int32 PathfindingWorkerThreads = 2;
 
+	/**
+	 * A* iterations per frame shared between all time sliced pathfinds on the game thread.
+	 * Searches that need more carry on next frame, so long paths take longer to arrive rather than causing a hitch.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Pathfinding", meta = (ClampMin = "16", ClampMax = "100000", UIMin = "100", UIMax = "10000"))
+	int32 TimeSlicedIterationsPerFrame = 1000;
+
 	/**
 	 * Maximum number of concurrent pathfinding requests allowed in the queue.
 	 * Prevents memory issues when overwhelmed with pathfinding requests.
@@ -37,6 +45,28 @@ public:
 		Tooltip = "Maximum pending pathfinding requests. Higher values allow more buffering but use more memory."))
 	int32 MaxConcurrentPathfinds = 8;
 
+	/**
+	 * Number of finished paths kept for reuse by requests with the same start voxel, goal voxel and pathfinder settings.
+	 * Entries are dropped when a dynamic region they pass through is regenerated. 0 disables the cache.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Pathfinding", meta = (ClampMin = "0", ClampMax = "4096", UIMin = "0", UIMax = "1024"))
+	int32 PathCacheSize = 256;
+
+	/**
+	 * Number of flood fill EQS results kept for reuse by queries from the same voxel with the same radius, step limit and spacing.
+	 * Entries are dropped when a dynamic region overlapping their radius is regenerated. 0 disables the cache.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Pathfinding", meta = (ClampMin = "0", ClampMax = "4096", UIMin = "0", UIMax = "1024"))
+	int32 FloodFillCacheSize = 128;
+
+	/**
+	 * Furthest a path request's start or goal is moved to reach free space when it lies in a blocked voxel, as agents brushing geometry often do.
+	 * A moved goal is where the path ends, so it never finishes inside geometry. The start only picks the voxel to search from,
+	 * the path still begins where the agent actually is. 0 fails such requests instead.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Pathfinding", meta = (ClampMin = "0.0", ClampMax = "2000.0", UIMin = "0.0", UIMax = "500.0"))
+	float NavigationProjectionRadius = 100.0f;
+
 	//~ Dynamic Regeneration Settings
 
 	/**
@@ -73,4 +103,11 @@ public:
 	 */
 	UPROPERTY(config, EditAnywhere, Category = "Dynamic Regeneration", meta = (ClampMin = "0.0", ClampMax = "10.0", UIMin = "0.5", UIMax = "5.0"))
 	float EditorDirtyRegionProcessDelay = 1.0f;
+
+	/**
+	 * Time after the last dynamic regeneration before a volume's landmarks are rebuilt (seconds).
+	 * The rebuild searches the whole volume, so it waits for moving obstacles to settle. Searches fall back to the straight line distance meanwhile.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Dynamic Regeneration", meta = (ClampMin = "0.0", ClampMax = "30.0", UIMin = "0.5", UIMax = "10.0"))
+	float LandmarkRebuildDelay = 2.0f;
 };
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "Data/AeonixThreading.h"
 #include "Interface/AeonixSubsystemInterface.h"
 #include "Data/AeonixHandleTypes.h"
+#include "Pathfinding/AeonixPathCache.h"
+#include "EQS/AeonixFloodFillCache.h"
+#include "Pathfinding/AeonixPathFinder.h"
 
 #include "Subsystems/EngineSubsystem.h"
 
@@ -13,7 +16,52 @@ class AAeonixBoundingVolume;
 class AAeonixModifierVolume;
 class UAeonixNavAgentComponent;
 class UAeonixDynamicObstacleComponent;
+struct FAeonixPathFinderSettings;
+class FAeonixIncrementalSearch;
+struct FAeonixNavRaycastHit;
 
+/** A pathfind advanced a slice at a time by the subsystem tick, rather than run to completion on a worker */
+struct FAeonixSlicedPathfind
+{
+	FAeonixPathFindRequest* Request = nullptr;
+	TWeakObjectPtr<const AAeonixBoundingVolume> NavVolume;
+	FAeonixPathFinderSettings Settings;
+
+	AeonixLink StartLink;
+	FVector StartPosition = FVector::ZeroVector;
+	TArray<AeonixLink> GoalLinks;
+	TArray<FVector> GoalPositions;
+
+	// Holds the search between slices, created on the first one. References Settings, so this struct must not move
+	TUniquePtr<AeonixPathFinder> PathFinder;
+
+	// Nav data the search is running on, if a regen changes leaves it has reached between slices the search starts over
+	uint32 GenerationId = 0;
+	uint32 LeafChangeSerial = 0;
+	int32 NumRestarts = 0;
+};
+
+/** One agent's search in a FindPathBatchAsyncAgents call */
+struct FAeonixBatchPathRequest
+{
+	UAeonixNavAgentComponent* NavigationComponent = nullptr;
+	FVector End = FVector::ZeroVector;
+	// Must outlive the request, as with FindPathAsyncAgent's OutPath
+	FAeonixNavigationPath* OutPath = nullptr;
+};
+
+/** A search queued as part of a batch worker job, everything the worker needs is copied off the game thread */
+struct FAeonixBatchPathfind
+{
+	FAeonixPathFindRequest* Request = nullptr;
+	// One copy per distinct settings in the batch, shared by every search using them
+	TSharedPtr<const FAeonixPathFinderSettings> Settings;
+
+	AeonixLink StartLink;
+	FVector StartPosition = FVector::ZeroVector;
+	TArray<AeonixLink> GoalLinks;
+	TArray<FVector> GoalPositions;
+};
 
 UCLASS()
 class AEONIXNAVIGATION_API UAeonixSubsystem : public UTickableWorldSubsystem, public IAeonixSubsystemInterface
@@ -41,10 +89,16 @@ public:
 	UFUNCTION()
 	virtual const AAeonixBoundingVolume* GetVolumeForPosition(const FVector& Position) override;
 	UFUNCTION()
-	virtual bool FindPathImmediateAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, FAeonixNavigationPath& OutPath) override;
+	virtual bool FindPathImmediateAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, FAeonixNavigationPath& OutPath, int32 MaxIterations = 0) override;
 	UFUNCTION()
 	virtual FAeonixPathFindRequestCompleteDelegate& FindPathAsyncAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, FAeonixNavigationPath& OutPath) override;
 	UFUNCTION()
+	virtual FAeonixPathFindRequestCompleteDelegate& FindPathTimeSlicedAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, FAeonixNavigationPath& OutPath) override;
+	UFUNCTION()
+	virtual bool FindPathToNearestImmediateAgent(UAeonixNavAgentComponent* NavigationComponent, const TArray<FVector>& Ends, FAeonixNavigationPath& OutPath, int32& OutGoalIndex) override;
+	UFUNCTION()
+	virtual FAeonixPathFindRequestCompleteDelegate& FindPathToNearestAsyncAgent(UAeonixNavAgentComponent* NavigationComponent, const TArray<FVector>& Ends, FAeonixNavigationPath& OutPath, int32& OutGoalIndex) override;
+	UFUNCTION()
 	virtual const AAeonixBoundingVolume* GetVolumeForAgent(const UAeonixNavAgentComponent* NavigationComponent) override;
 	UFUNCTION()
 	virtual AAeonixBoundingVolume* GetMutableVolumeForAgent(const UAeonixNavAgentComponent* NavigationComponent) override;
@@ -55,6 +109,58 @@ public:
 	virtual void RequestDebugPathUpdate(UAeonixNavAgentComponent* NavComponent) override;
 	/* IAeonixSubsystemInterface END */
 
+	/** Synchronous D* Lite search that keeps its state in IoSearch between calls, so a repath after a dynamic regen only repairs what changed */
+	bool FindPathIncrementalAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, FAeonixIncrementalSearch& IoSearch, FAeonixNavigationPath& OutPath);
+
+	/** FindPathIncrementalAgent run on a worker, delivered as with FindPathAsyncAgent. The worker holds a reference to Search until it's done, the caller must not touch it
+	    while the request is in flight, Search.IsUnique() says when it's free again */
+	FAeonixPathFindRequestCompleteDelegate& FindPathIncrementalAsyncAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& End, const TSharedRef<FAeonixIncrementalSearch>& Search, FAeonixNavigationPath& OutPath);
+
+	/** Async search from an explicit Start rather than the agent's position, used to carry on from the end of a partial path while the agent is still following it */
+	FAeonixPathFindRequestCompleteDelegate& FindPathFromAsyncAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& Start, const FVector& End, FAeonixNavigationPath& OutPath);
+
+	/** Cancels every async request still to deliver into Path. Their paths are dropped and their completion delegates never fire, so a path can be asked for again straight away */
+	void CancelPathRequests(const FAeonixNavigationPath& Path);
+
+	/** Async searches for a burst of agents, such as a squad order. Links are resolved and checked for reachability in one pass per volume, then each volume's
+	    searches run as one worker job that reuses a pathfinder's scratch memory between searches with the same settings, taking the read lock for each search
+	    so regens aren't held up behind the whole job. With bParallel the job is split across the workers instead. OutDelegates gets one completion delegate per request, in order, and paths are delivered as with FindPathAsyncAgent */
+	void FindPathBatchAsyncAgents(const TArray<FAeonixBatchPathRequest>& Requests, TArray<FAeonixPathFindRequestCompleteDelegate*>& OutDelegates, bool bParallel = false);
+
+	/** Line of sight through the navigation data of the volume containing Start, a walk of the octree under its read lock rather than a physics trace. False if Start isn't in a volume */
+	bool IsSegmentClear(const FVector& Start, const FVector& End);
+	/** First blocked point along the segment, through the volume containing Start. A start outside every volume is a hit at its start */
+	bool RaycastNav(const FVector& Start, const FVector& End, FAeonixNavRaycastHit& OutHit);
+	/** IsSegmentClear for many segments, each volume's segments checked under one read lock */
+	void IsSegmentClearBatch(TConstArrayView<TPair<FVector, FVector>> Segments, TArray<bool>& OutClear);
+	/** RaycastNav for many segments, each volume's segments traced under one read lock */
+	void RaycastNavBatch(TConstArrayView<TPair<FVector, FVector>> Segments, TArray<FAeonixNavRaycastHit>& OutHits);
+	/** Nearest blocked voxel to Position within MaxDistance, in the volume containing Position, for steering clear of geometry without physics sweeps */
+	bool FindNearestObstacle(const FVector& Position, float MaxDistance, FAeonixNearestObstacle& OutObstacle);
+	/** FindNearestObstacle for many positions, such as a whole flock, each volume's positions searched under one read lock */
+	void FindNearestObstacles(TConstArrayView<FVector> Positions, float MaxDistance, TArray<FAeonixNearestObstacle>& OutObstacles);
+	/** Nearest navigable point to Point within MaxDistance, in the volume containing Point. Navigable points come back unchanged */
+	bool ProjectPointToNavigation(const FVector& Point, float MaxDistance, FVector& OutPoint);
+
+	/** A navigable point drawn uniformly from the free space of every registered volume, for wander and spawn points without rejection sampling */
+	bool GetRandomNavigablePoint(FVector& OutPoint);
+	/** A point drawn uniformly from the free space a path from Origin can reach, in the volume containing Origin */
+	bool GetRandomReachablePoint(const FVector& Origin, FVector& OutPoint);
+	/** A point drawn uniformly from the free space inside Box, in the volume containing its centre */
+	bool GetRandomNavigablePointInBox(const FBox& Box, FVector& OutPoint);
+
+	/** Points a flood from the voxel at Origin reaches within Radius of that voxel's centre and MaxSteps steps, thinned to about MinSpacing apart.
+	    Cached until the volume, or a dynamic region overlapping the radius, is regenerated. Safe to call from EQS worker threads */
+	bool GetFloodFillPoints(const FVector& Origin, float Radius, int32 MaxSteps, float MinSpacing, TArray<FVector>& OutPoints);
+	/** Path length from Origin to each of Points within MaxDistance, found by one Dijkstra search through the volume containing Origin rather than a search per point.
+	    Points that are blocked, in another volume, unreachable or further than MaxDistance get -1. Safe to call from EQS worker threads */
+	bool GetPathDistances(const FVector& Origin, TConstArrayView<FVector> Points, float MaxDistance, const FAeonixPathFinderSettings& Settings, TArray<float>& OutDistances);
+	/** Which free nodes and subnodes within Radius of Target can see it, in the volume containing Target. Null outside every volume.
+	    Hand it to FAeonixPathFinderSettings::VisibilityField to weight paths by exposure. Safe to call from EQS worker threads */
+	TSharedPtr<const FAeonixVisibilityField> BuildVisibilityField(const FVector& Target, float Radius);
+	/** Whether each of Points, by the voxel it's in, can see Target. Unknown for points that are blocked, in another volume or further than Radius from Target */
+	bool GetPointVisibility(const FVector& Target, TConstArrayView<FVector> Points, float Radius, TArray<EAeonixVisibility>& OutVisibility);
+
 	// Path invalidation registry
 	void RegisterPath(TSharedPtr<FAeonixNavigationPath> Path);
 	void UnregisterPath(FAeonixNavigationPath* Path);
@@ -116,6 +222,10 @@ private:
 	TMap<AAeonixModifierVolume*, AAeonixBoundingVolume*> ModifierToVolumeMap;
 
 	void UpdateRequests();
+	/** Spends this frame's iteration budget on the time sliced searches, round robin */
+	void UpdateSlicedPathfinds();
+	/** Runs one slice, returns InProgress if the search isn't finished, otherwise the status its request was completed with */
+	EAeonixPathFindStatus StepSlicedPathfind(FAeonixSlicedPathfind& Pathfind, int32 IterationBudget, int32& OutIterationsUsed);
 	void ProcessDynamicObstacles(float DeltaTime);
 	void UpdateSpatialRelationships();
 
@@ -145,16 +255,55 @@ private:
 	// Threading infrastructure
 	FAeonixPathfindWorkerPool WorkerPool;
 	FAeonixLoadMetrics LoadMetrics;
+	// Drawn from by the random point queries, which are game thread only
+	FRandomStream RandomPointStream;
 	FCriticalSection PathRequestsLock;
 	int32 MaxConcurrentPathfinds = 8; // Configurable limit
 
 	// Priority-based request queue (sorted by priority, then FIFO within priority)
 	TArray<TUniquePtr<FAeonixPathFindRequest>> PathRequests;
 
+	// Requests being searched on the game thread, their FAeonixPathFindRequest is owned by PathRequests
+	TArray<TUniquePtr<FAeonixSlicedPathfind>> SlicedPathfinds;
+	int32 SlicedPathfindCursor = 0;
+	int32 TimeSlicedIterationsPerFrame = 1000;
+	// Times a sliced search starts over for regens before it settles for a partial path
+	static constexpr int32 MaxSlicedPathfindRestarts = 3;
+
 	// Region versioning for invalidation detection
 	TMap<FGuid, uint32> RegionVersionMap;
 	mutable FCriticalSection RegionVersionLock;
 
+	// Finished paths for reuse by identical requests, game thread only
+	FAeonixPathCache PathCache;
+	// Flood fill EQS results, locked internally
+	FAeonixFloodFillCache FloodFillCache;
+
+	/** Key for caching a path, returns false if the request shouldn't use the cache */
+	bool MakePathCacheKey(const AAeonixBoundingVolume* Volume, const AeonixLink& Start, const AeonixLink& Goal, const FAeonixPathFinderSettings& Settings, FAeonixPathCacheKey& OutKey) const;
+	bool FindCachedPath(const FAeonixPathCacheKey& Key, const AAeonixBoundingVolume* Volume, const FVector& StartPosition, const FVector& EndPosition, FAeonixNavigationPath& OutPath);
+	/** Caches a path that has already had its regions tracked, RegionVersions being the versions it was found against */
+	void AddCachedPath(const FAeonixPathCacheKey& Key, uint32 GenerationId, const FAeonixNavigationPath& Path, const TMap<FGuid, uint32>& RegionVersions);
+
+	/** Link for Position, projected onto free space if it's blocked. Takes the volume's read lock, as projecting searches the octree */
+	bool GetNavigableLink(const AAeonixBoundingVolume& NavVolume, const FVector& Position, AeonixLink& OutLink) const;
+	/** As above, with OutPosition where a path to Position should end, Position itself unless it had to be projected */
+	bool GetNavigableLink(const AAeonixBoundingVolume& NavVolume, const FVector& Position, AeonixLink& OutLink, FVector& OutPosition) const;
+	/** Resolves each end position to a goal link, dropping any that have no link or can't be reached from the start. OutGoalIndices maps the kept goals back into Ends */
+	bool ResolveGoalLinks(const AAeonixBoundingVolume* NavVolume, UAeonixNavAgentComponent* NavigationComponent, const AeonixLink& StartNavLink, const TArray<FVector>& Ends,
+		TArray<AeonixLink>& OutGoalLinks, TArray<FVector>& OutGoalPositions, TArray<int32>& OutGoalIndices);
+
+	/** Shared by FindPathAsyncAgent, FindPathTimeSlicedAgent and FindPathFromAsyncAgent. Start is already in pathfinding space */
+	FAeonixPathFindRequestCompleteDelegate& RequestPathAgent(UAeonixNavAgentComponent* NavigationComponent, const FVector& Start, const FVector& End, FAeonixNavigationPath& OutPath, bool bTimeSliced);
+
+	/** Queues a search from StartNavLink to the nearest of GoalLinks on the worker pool, or for time slicing if the request asks or there are no workers. Results are delivered to OutPath in UpdateRequests */
+	FAeonixPathFindRequestCompleteDelegate& DispatchPathfindRequest(TUniquePtr<FAeonixPathFindRequest>&& Request, const AAeonixBoundingVolume* NavVolume, const FAeonixPathFinderSettings& PathfinderSettings,
+		const AeonixLink& StartNavLink, const FVector& StartPosition, TArray<AeonixLink>&& GoalLinks, TArray<FVector>&& GoalPositions, FAeonixNavigationPath& OutPath);
+
+	/** Runs one search on a worker thread and completes its request, the caller holds the volume's read lock. Shared by single and batched async requests */
+	static void RunWorkerPathfind(const TWeakObjectPtr<UAeonixSubsystem>& WeakSubsystem, AeonixPathFinder& PathFinder, FAeonixPathFindRequest* RequestPtr, const AeonixLink& StartNavLink, const FVector& StartPosition,
+		const TArray<AeonixLink>& GoalLinks, const TArray<FVector>& GoalPositions, const TMap<FGuid, uint32>& CapturedRegionVersions, double StartTime);
+
 	// Helper methods
 	bool TryAcquirePathfindReadLock(const AAeonixBoundingVolume* Volume, float TimeoutSeconds = 0.1f);
 
@@ -4,6 +4,7 @@
 #include "Subsystem/AeonixSubsystem.h"
 
 #include "Data/AeonixDefines.h"
+#include "Pathfinding/AeonixIncrementalSearch.h"
 
 #include "Navigation/PathFollowingComponent.h"
 #include "Tasks/AITask.h"
@@ -38,6 +39,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Aeonix")
 	bool bRepathOnInvalidation = true;
 
+	/** If true, repaths after invalidation reuse the previous search and only repair the nodes that changed (D* Lite), rather than searching again from scratch. The repair runs on a worker when async pathfinding is on. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Aeonix")
+	bool bUseIncrementalReplanning = false;
+
 	UFUNCTION(BlueprintCallable, Category = "AI|Tasks", meta = (AdvancedDisplay = "AcceptanceRadius,StopOnOverlap,AcceptPartialPath,bUsePathfinding,bUseContinuosGoalTracking,bInRepathOnInvalidation", DefaultToSelf = "Controller", BlueprintInternalUseOnly = "TRUE", DisplayName = "Aeonix Move To Location or Actor"))
 	static UAITask_AeonixMoveTo* AeonixAIMoveTo(AAIController* Controller, FVector GoalLocation, bool aUseAsyncPathfinding, AActor* GoalActor = nullptr,
 		float AcceptanceRadius = -1.f, EAIOptionFlag::Type StopOnOverlap = EAIOptionFlag::Default, bool bLockAILogic = true, bool bUseContinuosGoalTracking = false, bool bInRepathOnInvalidation = true);
@@ -57,6 +62,9 @@ public:
 	UFUNCTION()
 	void OnPathFindComplete(EAeonixPathFindStatus Status);
 
+	UFUNCTION()
+	void OnContinuationPathFindComplete(EAeonixPathFindStatus Status);
+
 protected:
 	void LogPathHelper();
 	
@@ -95,11 +103,17 @@ protected:
 
 	FAeonixNavigationPath* AeonixPath;
 
+	/** Search state kept between repaths when bUseIncrementalReplanning is set, shared with the worker while an async repair is in flight */
+	TSharedRef<FAeonixIncrementalSearch> IncrementalSearch = MakeShared<FAeonixIncrementalSearch>();
+
 	TScriptInterface<UAeonixSubsystem> AeonixSubsystem;
 
 	TEnumAsByte<EPathFollowingResult::Type> MoveResult;
 	bool bUseContinuousTracking{false};
 
+	/** Set while we follow a partial path and search on from its end, so reaching that end doesn't finish the task */
+	bool bAwaitingContinuation{false};
+
 	virtual void Activate() override;
 	virtual void OnDestroy(bool bOwnerFinished) override;
 
@@ -123,9 +137,20 @@ protected:
 
 	void RequestPathSynchronous();
 	void RequestPathAsync();
+	void RequestPathIncremental();
+	void RequestPathIncrementalAsync();
 
 	void RequestMove();
 
+	/** Starts following a partial path, and searching on to the goal from where it ends */
+	void FollowPartialPath();
+
+	/** Searches on to the goal from the end of the current, partial, path */
+	void RequestContinuationPath();
+
+	/** Stops waiting for the continuation and cancels its search, so a late result can't be spliced onto a newer path */
+	void CancelContinuation();
+
 	void ResetPaths();
 
 	/** remove all delegates */
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "Data/AeonixTypes.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Task/AeonixFindPathAsyncAction.h"
+#include "AeonixFindPathToNearestAsyncAction.generated.h"
+
+class UAeonixNavAgentComponent;
+
+// Output pin delegate
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnAeonixNearestPathFound, const TArray<FAeonixPathPoint>&, PathPoints, int32, GoalIndex, FVector, GoalLocation);
+
+/**
+ * Latent Blueprint node for finding a path to whichever of several targets is cheapest to reach.
+ * Runs a single async search and outputs the path points and the chosen target on completion.
+ */
+UCLASS()
+class AEONIXNAVIGATION_API UAeonixFindPathToNearestAsyncAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Called when pathfinding completes successfully */
+	UPROPERTY(BlueprintAssignable)
+	FOnAeonixNearestPathFound OnSuccess;
+
+	/** Called when pathfinding fails, or no target is reachable */
+	UPROPERTY(BlueprintAssignable)
+	FOnAeonixPathFailed OnFailed;
+
+	/**
+	 * Find a path asynchronously from the agent's current location to the nearest of the targets.
+	 * @param WorldContextObject World context
+	 * @param NavAgentComponent The navigation agent component
+	 * @param TargetLocations The candidate destinations
+	 * @return The async action
+	 */
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Aeonix Find Path To Nearest Async"), Category = "Aeonix|Pathfinding")
+	static UAeonixFindPathToNearestAsyncAction* FindPathToNearestAsync(
+		UObject* WorldContextObject,
+		UAeonixNavAgentComponent* NavAgentComponent,
+		const TArray<FVector>& TargetLocations);
+
+	// UBlueprintAsyncActionBase interface
+	virtual void Activate() override;
+
+private:
+	UFUNCTION()
+	void OnPathFindComplete(EAeonixPathFindStatus Status);
+
+	// Stored parameters
+	TWeakObjectPtr<UAeonixNavAgentComponent> NavAgent;
+	TArray<FVector> Targets;
+	TWeakObjectPtr<UWorld> WorldPtr;
+
+	// Result storage
+	FAeonixNavigationPath ResultPath;
+	int32 ResultGoalIndex = INDEX_NONE;
+};
@@ -68,6 +68,10 @@ class AEONIXNAVIGATION_API UBTTask_AeonixMoveTo : public UBTTask_BlackboardBase
 	UPROPERTY(Category = Node, EditAnywhere, AdvancedDisplay, meta = (DisplayName = "Repath On Invalidation"))
 		bool bRepathOnInvalidation = true;
 
+	/** if true, repaths after invalidation repair the previous search instead of starting again. Pathfinding is synchronous when set. */
+	UPROPERTY(Category = Node, EditAnywhere, AdvancedDisplay, meta = (DisplayName = "Incremental Replanning"))
+		bool bUseIncrementalReplanning = false;
+
 	virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 	virtual EBTNodeResult::Type AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 	virtual void OnTaskFinished(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTNodeResult::Type TaskResult) override;
@@ -7,6 +7,12 @@ class AEONIXNAVIGATION_API AeonixMediator
 {
 public:
 	static bool GetLinkFromPosition(const FVector& aPosition, const AAeonixBoundingVolume& aVolume, AeonixLink& oLink);
+	/** The link at aPosition, or failing that the nearest free one within aMaxDistance. oPosition is aPosition, or the nearest point of the link found */
+	static bool ProjectToNavigation(const FVector& aPosition, const AAeonixBoundingVolume& aVolume, float aMaxDistance, AeonixLink& oLink, FVector& oPosition);
+	/** GetLinkFromPosition for path requests, falling back to the nearest free link within the configured NavigationProjectionRadius */
+	static bool GetNavigableLinkFromPosition(const FVector& aPosition, const AAeonixBoundingVolume& aVolume, AeonixLink& oLink);
+	/** As above, with oPosition the point the request should path to, aPosition itself unless it had to be projected */
+	static bool GetNavigableLinkFromPosition(const FVector& aPosition, const AAeonixBoundingVolume& aVolume, AeonixLink& oLink, FVector& oPosition);
 
 	static void GetVolumeXYZ(const FVector& aPosition, const AAeonixBoundingVolume& aVolume, const int aLayer, FIntVector& oXYZ);
 };
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "Data/AeonixData.h"
+#include "Data/AeonixAdjacency.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_AdjacencyTest,
+    "AeonixNavigation.Pathfinding.Adjacency",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace
+{
+    // Compares the baked list of every node that gets expanded as a whole against walking the octree, returns the number of mismatches
+    int32 CountAdjacencyMismatches(const FAeonixData& NavData)
+    {
+        const FAeonixOctreeData& OctreeData = NavData.OctreeData;
+        const FAeonixAdjacency& Adjacency = NavData.GetAdjacency();
+
+        int32 Mismatches = 0;
+        TArray<AeonixLink> Expected;
+        for (int32 LayerIndex = 0; LayerIndex < OctreeData.Layers.Num(); ++LayerIndex)
+        {
+            for (int32 NodeIndex = 0; NodeIndex < OctreeData.Layers[LayerIndex].Num(); ++NodeIndex)
+            {
+                if (OctreeData.Layers[LayerIndex][NodeIndex].HasChildren())
+                {
+                    continue;
+                }
+
+                const AeonixLink Link(LayerIndex, NodeIndex, 0);
+                Expected.Reset();
+                OctreeData.GetNeighbours(Link, Expected);
+
+                const TConstArrayView<AeonixLink> Baked = Adjacency.GetNeighbours(Link);
+                if (Baked.Num() != Expected.Num())
+                {
+                    Mismatches++;
+                    continue;
+                }
+                for (int32 i = 0; i < Baked.Num(); ++i)
+                {
+                    if (!(Baked[i] == Expected[i]))
+                    {
+                        Mismatches++;
+                        break;
+                    }
+                }
+            }
+        }
+        return Mismatches;
+    }
+}
+
+bool FAeonixNavigation_AdjacencyTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Baked Adjacency Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+    Params.bBakeAdjacency = true;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    // TEST 1: Generation bakes a list for every node, matching the octree
+    if (!TestTrue(TEXT("Adjacency should be valid after generation"), NavData.GetAdjacency().IsValid()))
+    {
+        return false;
+    }
+    TestTrue(TEXT("Adjacency should hold some links"), NavData.GetAdjacency().GetNumLinks() > 0);
+    TestEqual(TEXT("Baked lists should match the octree after generation"), CountAdjacencyMismatches(NavData), 0);
+
+    // TEST 2: Rewriting a faced leaf and patching keeps the lists matching, whether it clears or fills
+    {
+        FAeonixOctreeData& OctreeData = NavData.OctreeData;
+        nodeindex_t FacedLeaf = INDEX_NONE;
+        TArray<AeonixLink> Neighbours;
+        TArray<nodeindex_t> Leaves;
+        for (int32 LayerIndex = 1; LayerIndex < OctreeData.Layers.Num() && FacedLeaf == INDEX_NONE; ++LayerIndex)
+        {
+            for (int32 NodeIndex = 0; NodeIndex < OctreeData.Layers[LayerIndex].Num(); ++NodeIndex)
+            {
+                if (OctreeData.Layers[LayerIndex][NodeIndex].HasChildren())
+                {
+                    continue;
+                }
+                OctreeData.GetNeighbours(AeonixLink(LayerIndex, NodeIndex, 0), Neighbours, &Leaves);
+                if (Leaves.Num() > 0)
+                {
+                    FacedLeaf = Leaves[0];
+                    break;
+                }
+            }
+        }
+
+        if (TestTrue(TEXT("Should find a leaf faced by a larger node"), FacedLeaf != INDEX_NONE))
+        {
+            const uint_fast64_t OriginalGrid = OctreeData.LeafNodes[FacedLeaf].VoxelGrid;
+
+            OctreeData.LeafNodes[FacedLeaf].VoxelGrid = 0;
+            NavData.UpdateAdjacency({ FacedLeaf });
+            TestTrue(TEXT("Adjacency should stay valid after clearing a leaf"), NavData.GetAdjacency().IsValid());
+            TestEqual(TEXT("Baked lists should match the octree after clearing a leaf"), CountAdjacencyMismatches(NavData), 0);
+
+            OctreeData.LeafNodes[FacedLeaf].VoxelGrid = ~static_cast<uint_fast64_t>(0);
+            NavData.UpdateAdjacency({ FacedLeaf });
+            TestEqual(TEXT("Baked lists should match the octree after filling a leaf"), CountAdjacencyMismatches(NavData), 0);
+
+            OctreeData.LeafNodes[FacedLeaf].VoxelGrid = OriginalGrid;
+            NavData.UpdateAdjacency({ FacedLeaf });
+            TestEqual(TEXT("Baked lists should match the octree after restoring a leaf"), CountAdjacencyMismatches(NavData), 0);
+        }
+    }
+
+    // TEST 3: Searches through the baked lists find the same path as walking the octree
+    const FVector StartPos(-300, -200, 0);
+    const FVector TargetPos(300, -200, 0);
+
+    AeonixLink StartLink;
+    AeonixLink TargetLink;
+    FString LogMsg;
+    if (!TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, StartPos, StartLink, LogMsg)) ||
+        !TestTrue(TEXT("Found valid target navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, TargetPos, TargetLink, LogMsg)))
+    {
+        return false;
+    }
+
+    FAeonixPathFinderSettings PathSettings;
+    PathSettings.MaxIterations = 20000;
+
+    FAeonixNavigationPath BakedPath;
+    int32 BakedIterations = 0;
+    {
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        TestTrue(TEXT("Search with the baked adjacency should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, BakedPath));
+        BakedIterations = PathFinder.GetLastIterationCount();
+    }
+
+    // TEST 4: Not asked for, not built, and searches walk the octree instead
+    {
+        FAeonixData PlainNavData;
+        Params.bBakeAdjacency = false;
+        PlainNavData.UpdateGenerationParameters(Params);
+        PlainNavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+        TestFalse(TEXT("Adjacency should not be built when not asked for"), PlainNavData.GetAdjacency().IsValid());
+
+        AeonixPathFinder PathFinder(PlainNavData, PathSettings);
+        FAeonixNavigationPath PlainPath;
+        TestTrue(TEXT("Search without the baked adjacency should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, PlainPath));
+        TestEqual(TEXT("Both searches should take as many iterations"), PathFinder.GetLastIterationCount(), BakedIterations);
+        TestEqual(TEXT("Both searches should give as many points"), PlainPath.GetNumPoints(), BakedPath.GetNumPoints());
+    }
+
+    return true;
+}
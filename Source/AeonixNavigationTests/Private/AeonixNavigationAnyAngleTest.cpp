@@ -0,0 +1,91 @@
+#include "Data/AeonixData.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_AnyAnglePathfindingTest,
+    "AeonixNavigation.Pathfinding.AnyAngle",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAeonixNavigation_AnyAnglePathfindingTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Any-Angle Pathfinding Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    // TEST 1: Line of sight against the walls either side of the gap
+    TestFalse(TEXT("Segment through the first wall should be blocked"), NavData.IsSegmentClear(FVector(-300, -200, 0), FVector(300, -200, 0)));
+    TestFalse(TEXT("Segment through the second wall should be blocked"), NavData.IsSegmentClear(FVector(-300, 200, 0), FVector(300, 200, 0)));
+    TestTrue(TEXT("Segment through the gap should be clear"), NavData.IsSegmentClear(FVector(-300, 0, 0), FVector(300, 0, 0)));
+    TestTrue(TEXT("Segment in open space should be clear"), NavData.IsSegmentClear(FVector(-400, -400, 400), FVector(-100, -300, 400)));
+    TestFalse(TEXT("Segment leaving the volume should not be clear"), NavData.IsSegmentClear(FVector(0, 0, 0), FVector(0, 0, 900)));
+
+    // TEST 2: Any-angle path around the first wall
+    FVector StartPos(-300, -200, 0);
+    FVector EndPos(300, -200, 0);
+
+    AeonixLink StartLink, EndLink;
+    FString StartLogMsg, EndLogMsg;
+
+    const bool bFoundStart = FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, StartPos, StartLink, StartLogMsg);
+    const bool bFoundEnd = FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, EndPos, EndLink, EndLogMsg);
+
+    TestTrue(TEXT("Found valid start navigation link"), bFoundStart);
+    TestTrue(TEXT("Found valid end navigation link"), bFoundEnd);
+
+    if (!bFoundStart || !bFoundEnd)
+    {
+        return false;
+    }
+
+    FAeonixPathFinderSettings PathSettings;
+    PathSettings.MaxIterations = 10000;
+    PathSettings.bUseAnyAnglePathfinding = true;
+    PathSettings.bOptimizePath = false;
+    PathSettings.HeuristicSettings.EuclideanWeight = 1.0f;
+    PathSettings.HeuristicSettings.GlobalWeight = 1.0f;
+
+    AeonixPathFinder PathFinder(NavData, PathSettings);
+    FAeonixNavigationPath Path;
+    const bool bPathFound = PathFinder.FindPath(StartLink, EndLink, StartPos, EndPos, Path);
+
+    TestTrue(TEXT("Any-angle search should find a path around the wall"), bPathFound);
+
+    if (bPathFound)
+    {
+        const TArray<FAeonixPathPoint>& PathPoints = Path.GetPathPoints();
+        UE_LOG(LogTemp, Display, TEXT("Any-angle path has %d points, %d iterations"), PathPoints.Num(), PathFinder.GetLastIterationCount());
+
+        TestTrue(TEXT("Path should start at the start position"), PathPoints.Num() > 0 && PathPoints[0].Position.Equals(StartPos));
+        TestTrue(TEXT("Path should end at the target position"), PathPoints.Num() > 0 && PathPoints.Last().Position.Equals(EndPos));
+
+        // Every leg of the path must have line of sight
+        for (int32 i = 1; i < PathPoints.Num(); ++i)
+        {
+            TestTrue(FString::Printf(TEXT("Path segment %d should be clear"), i),
+                NavData.IsSegmentClear(PathPoints[i - 1].Position, PathPoints[i].Position));
+        }
+    }
+
+    return true;
+}
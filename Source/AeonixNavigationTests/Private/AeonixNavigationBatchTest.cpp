@@ -0,0 +1,115 @@
+#include "Data/AeonixData.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_BatchReuseTest,
+    "AeonixNavigation.Pathfinding.BatchReuse",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAeonixNavigation_BatchReuseTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Batch Pathfinder Reuse Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    // A burst of searches as a squad order would issue, through the gap, along the wall and across open space
+    const TArray<TPair<FVector, FVector>> Queries = {
+        { FVector(-300, -200, 0), FVector(300, -200, 0) },
+        { FVector(-300, 200, 100), FVector(300, 250, -100) },
+        { FVector(-400, -400, -400), FVector(-100, 300, 300) },
+        { FVector(300, -200, 0), FVector(-300, -200, 0) },
+        { FVector(200, 0, 0), FVector(400, 100, 50) },
+    };
+
+    TArray<AeonixLink> StartLinks;
+    TArray<AeonixLink> TargetLinks;
+    for (const TPair<FVector, FVector>& Query : Queries)
+    {
+        AeonixLink StartLink;
+        AeonixLink TargetLink;
+        FString LogMsg;
+        if (!TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, Query.Key, StartLink, LogMsg)) ||
+            !TestTrue(TEXT("Found valid target navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, Query.Value, TargetLink, LogMsg)))
+        {
+            return false;
+        }
+        StartLinks.Add(StartLink);
+        TargetLinks.Add(TargetLink);
+    }
+
+    FAeonixPathFinderSettings PathSettings;
+    PathSettings.MaxIterations = 10000;
+
+    // Reference paths, each from a fresh pathfinder
+    TArray<FAeonixNavigationPath> FreshPaths;
+    TArray<int32> FreshIterations;
+    FreshPaths.SetNum(Queries.Num());
+    for (int32 i = 0; i < Queries.Num(); ++i)
+    {
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        TestTrue(FString::Printf(TEXT("Fresh search %d should find a path"), i), PathFinder.FindPath(StartLinks[i], TargetLinks[i], Queries[i].Key, Queries[i].Value, FreshPaths[i]));
+        FreshIterations.Add(PathFinder.GetLastIterationCount());
+    }
+
+    // TEST 1: One pathfinder run over the whole batch gives the same paths, nothing carries over from the last search
+    {
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        for (int32 i = 0; i < Queries.Num(); ++i)
+        {
+            FAeonixNavigationPath Path;
+            TestTrue(FString::Printf(TEXT("Reused search %d should find a path"), i), PathFinder.FindPath(StartLinks[i], TargetLinks[i], Queries[i].Key, Queries[i].Value, Path));
+            TestEqual(FString::Printf(TEXT("Reused search %d should take as many iterations as a fresh one"), i), PathFinder.GetLastIterationCount(), FreshIterations[i]);
+
+            if (TestEqual(FString::Printf(TEXT("Reused path %d should have as many points as the fresh path"), i), Path.GetNumPoints(), FreshPaths[i].GetNumPoints()))
+            {
+                for (int32 Point = 0; Point < Path.GetNumPoints(); ++Point)
+                {
+                    TestTrue(FString::Printf(TEXT("Reused path %d point %d should match the fresh path"), i, Point), Path.GetPathPoints()[Point].Position.Equals(FreshPaths[i].GetPathPoints()[Point].Position));
+                }
+            }
+        }
+    }
+
+    // TEST 2: A search that fails part way through a batch doesn't affect the ones after it
+    {
+        FAeonixPathFinderSettings LimitedSettings = PathSettings;
+        LimitedSettings.MaxIterations = FMath::Max(FreshIterations[0] / 2, 1);
+
+        AeonixPathFinder PathFinder(NavData, LimitedSettings);
+        FAeonixNavigationPath FailedPath;
+        TestFalse(TEXT("Limited search should fail"), PathFinder.FindPath(StartLinks[0], TargetLinks[0], Queries[0].Key, Queries[0].Value, FailedPath));
+
+        // The last query is short enough to finish within the limit
+        const int32 Last = Queries.Num() - 1;
+        if (FreshIterations[Last] < LimitedSettings.MaxIterations)
+        {
+            FAeonixNavigationPath Path;
+            TestTrue(TEXT("Search after a failed one should find a path"), PathFinder.FindPath(StartLinks[Last], TargetLinks[Last], Queries[Last].Key, Queries[Last].Value, Path));
+            TestEqual(TEXT("Search after a failed one should take as many iterations as a fresh one"), PathFinder.GetLastIterationCount(), FreshIterations[Last]);
+            TestEqual(TEXT("Search after a failed one should match the fresh path"), Path.GetNumPoints(), FreshPaths[Last].GetNumPoints());
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,189 @@
+#include "Data/AeonixData.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_ClassifyPointsTest,
+    "AeonixNavigation.Pathfinding.ClassifyPoints",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace
+{
+    // The node or subnode the link refers to, and whether it's free
+    FBox GetLinkBounds(const FAeonixData& NavData, const AeonixLink& Link, bool& bOutFree)
+    {
+        const AeonixNode& Node = NavData.OctreeData.GetNode(Link);
+        FVector Position;
+        NavData.GetNodePosition(Link.GetLayerIndex(), Node.Code, Position);
+        const FVector HalfSize(NavData.GetVoxelSize(Link.GetLayerIndex()) * 0.5f);
+        bOutFree = !Node.HasChildren();
+        if (bOutFree || Link.GetLayerIndex() != 0)
+        {
+            return FBox(Position - HalfSize, Position + HalfSize);
+        }
+
+        bOutFree = !NavData.OctreeData.GetLeafNode(Node.FirstChild.GetNodeIndex()).GetNode(Link.GetSubnodeIndex());
+        const float SubnodeSize = NavData.GetVoxelSize(0) * 0.25f;
+        uint_fast32_t X = 0, Y = 0, Z = 0;
+        morton3D_64_decode(Link.GetSubnodeIndex(), X, Y, Z);
+        const FVector Min = Position - HalfSize + FVector(X, Y, Z) * SubnodeSize;
+        return FBox(Min, Min + FVector(SubnodeSize));
+    }
+
+    // Scans every layer for the node the point ends up in, and its subnode in a leaf
+    AeonixLink FindLinkBruteForce(const FAeonixData& NavData, const FVector& Position)
+    {
+        for (int32 Layer = 0; Layer < NavData.OctreeData.Layers.Num(); ++Layer)
+        {
+            const TArray<AeonixNode>& Nodes = NavData.OctreeData.Layers[Layer];
+            for (int32 i = 0; i < Nodes.Num(); ++i)
+            {
+                if (Nodes[i].HasChildren() && Layer != 0)
+                {
+                    continue;
+                }
+
+                FVector NodePosition;
+                NavData.GetNodePosition(Layer, Nodes[i].Code, NodePosition);
+                const float HalfSize = NavData.GetVoxelSize(Layer) * 0.5f;
+                const FVector Local = Position - NodePosition + FVector(HalfSize);
+                if (Local.X < 0.f || Local.Y < 0.f || Local.Z < 0.f || Local.X >= HalfSize * 2.f || Local.Y >= HalfSize * 2.f || Local.Z >= HalfSize * 2.f)
+                {
+                    continue;
+                }
+
+                if (!Nodes[i].HasChildren())
+                {
+                    return AeonixLink(Layer, i, 0);
+                }
+                const float SubnodeSize = NavData.GetVoxelSize(0) * 0.25f;
+                const uint64 Subnode = morton3D_64_encode(FMath::FloorToInt(Local.X / SubnodeSize), FMath::FloorToInt(Local.Y / SubnodeSize), FMath::FloorToInt(Local.Z / SubnodeSize));
+                return AeonixLink(0, i, static_cast<subnodeindex_t>(Subnode));
+            }
+        }
+        return AeonixLink::GetInvalidLink();
+    }
+}
+
+bool FAeonixNavigation_ClassifyPointsTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Classify Points Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    // A grid over the walls, a little past the volume on every side, in an order that isn't the morton order
+    TArray<FVector> Points;
+    for (float X = -540.f; X <= 540.f; X += 45.f)
+    {
+        for (float Y = -540.f; Y <= 540.f; Y += 45.f)
+        {
+            for (float Z = -120.f; Z <= 120.f; Z += 60.f)
+            {
+                Points.Add(FVector(X, Y, Z));
+            }
+        }
+    }
+
+    const FBox VolumeBounds(Params.Origin - Params.Extents, Params.Origin + Params.Extents);
+
+    // TEST 1: Without projection every point lands in the same link a scan of the whole octree finds, in the order it was given
+    {
+        TArray<FAeonixPointClassification> Results;
+        NavData.ClassifyPoints(Points, 0.f, Results);
+        if (!TestEqual(TEXT("One result per point"), Results.Num(), Points.Num()))
+        {
+            return false;
+        }
+
+        int32 Mismatched = 0;
+        int32 NumFree = 0;
+        int32 NumBlocked = 0;
+        for (int32 i = 0; i < Points.Num(); ++i)
+        {
+            const FAeonixPointClassification& Result = Results[i];
+            if (!VolumeBounds.IsInsideOrOn(Points[i]))
+            {
+                Mismatched += Result.State == EAeonixPointState::Outside ? 0 : 1;
+                continue;
+            }
+
+            const AeonixLink Expected = FindLinkBruteForce(NavData, Points[i]);
+            bool bExpectedFree = false;
+            const bool bInLink = Expected.IsValid() && GetLinkBounds(NavData, Expected, bExpectedFree).ExpandBy(KINDA_SMALL_NUMBER).IsInside(Points[i]);
+            if (Result.State == EAeonixPointState::Free)
+            {
+                NumFree++;
+                Mismatched += (bInLink && bExpectedFree && Result.Link == Expected && Result.Position == Points[i]) ? 0 : 1;
+            }
+            else if (Result.State == EAeonixPointState::Blocked)
+            {
+                NumBlocked++;
+                Mismatched += (bInLink && !bExpectedFree && !Result.Link.IsValid()) ? 0 : 1;
+            }
+            else
+            {
+                Mismatched++;
+            }
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("%d points: %d free, %d blocked"), Points.Num(), NumFree, NumBlocked);
+        TestEqual(TEXT("Every point should match the per point lookup"), Mismatched, 0);
+        TestTrue(TEXT("The grid should cross both free space and the walls"), NumFree > 0 && NumBlocked > 0);
+    }
+
+    // TEST 2: With projection, blocked points and those just outside move into free space within the radius
+    {
+        const float Radius = 60.f;
+        TArray<FAeonixPointClassification> Results;
+        NavData.ClassifyPoints(Points, Radius, Results);
+
+        int32 NumProjected = 0;
+        int32 Misplaced = 0;
+        for (int32 i = 0; i < Points.Num(); ++i)
+        {
+            const FAeonixPointClassification& Result = Results[i];
+            if (Result.State != EAeonixPointState::Projected)
+            {
+                continue;
+            }
+
+            NumProjected++;
+            bool bFree = false;
+            const FBox Bounds = GetLinkBounds(NavData, Result.Link, bFree);
+            if (!bFree || !Bounds.ExpandBy(KINDA_SMALL_NUMBER).IsInside(Result.Position) || FVector::Dist(Points[i], Result.Position) > Radius + KINDA_SMALL_NUMBER)
+            {
+                Misplaced++;
+            }
+        }
+
+        TestTrue(TEXT("Some points should be projected"), NumProjected > 0);
+        TestEqual(TEXT("Projected points should be free and within the radius"), Misplaced, 0);
+    }
+
+    // TEST 3: Far outside stays outside, even when projecting
+    {
+        TArray<FAeonixPointClassification> Results;
+        NavData.ClassifyPoints(TArray<FVector>{ FVector(2000, 0, 0) }, 60.f, Results);
+        TestTrue(TEXT("Far point should be outside"), Results.Num() == 1 && Results[0].State == EAeonixPointState::Outside);
+    }
+
+    return true;
+}
@@ -0,0 +1,273 @@
+#include "Data/AeonixData.h"
+#include "Data/AeonixClearance.h"
+#include "Data/AeonixLeafNode.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_ClearanceTest,
+    "AeonixNavigation.Pathfinding.Clearance",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace
+{
+    // Subnode co-ordinates across the whole volume
+    FIntVector GetSubnodeCoords(mortoncode_t NodeCode, int32 Subnode)
+    {
+        uint_fast32_t NodeX = 0, NodeY = 0, NodeZ = 0;
+        uint_fast32_t SubX = 0, SubY = 0, SubZ = 0;
+        morton3D_64_decode(NodeCode, NodeX, NodeY, NodeZ);
+        morton3D_64_decode(Subnode, SubX, SubY, SubZ);
+        return FIntVector(static_cast<int32>(NodeX * 4 + SubX), static_cast<int32>(NodeY * 4 + SubY), static_cast<int32>(NodeZ * 4 + SubZ));
+    }
+
+    // Chebyshev distance in subnodes from the box [Min, Max] to the nearest of Blocked, capped at the most the clearance stores
+    int32 GetBruteForceClearance(const TArray<FIntVector>& Blocked, const FIntVector& Min, const FIntVector& Max)
+    {
+        int32 Best = FAeonixClearance::MaxClearance;
+        for (const FIntVector& B : Blocked)
+        {
+            int32 Distance = 0;
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                Distance = FMath::Max(Distance, FMath::Max3(0, Min[Axis] - B[Axis], B[Axis] - Max[Axis]));
+            }
+            Best = FMath::Min(Best, Distance);
+        }
+        return Best;
+    }
+}
+
+bool FAeonixNavigation_ClearanceTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Clearance Field Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+    Params.bBakeClearance = true;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    const FAeonixClearance& Clearance = NavData.GetClearance();
+    if (!TestTrue(TEXT("Clearance should be valid after generation"), Clearance.IsValid()))
+    {
+        return false;
+    }
+
+    const FAeonixOctreeData& OctreeData = NavData.OctreeData;
+    TArray<FIntVector> Blocked;
+    for (const AeonixNode& Node : OctreeData.Layers[0])
+    {
+        if (Node.HasChildren())
+        {
+            for (uint64 Bits = OctreeData.LeafNodes[Node.FirstChild.GetNodeIndex()].VoxelGrid; Bits; Bits &= Bits - 1)
+            {
+                Blocked.Add(GetSubnodeCoords(Node.Code, FMath::CountTrailingZeros64(Bits)));
+            }
+        }
+    }
+
+    // TEST 1: Subnode clearances match the distance to the nearest blocked subnode, for a spread of subnodes
+    {
+        int32 Checked = 0;
+        int32 Mismatches = 0;
+        const TArray<AeonixNode>& Layer0 = OctreeData.Layers[0];
+        for (int32 NodeIndex = 0; NodeIndex < Layer0.Num(); NodeIndex += 3)
+        {
+            if (!Layer0[NodeIndex].HasChildren())
+            {
+                continue;
+            }
+
+            const nodeindex_t LeafIndex = Layer0[NodeIndex].FirstChild.GetNodeIndex();
+            for (int32 Subnode = NodeIndex % 5; Subnode < 64; Subnode += 5)
+            {
+                const FIntVector Coords = GetSubnodeCoords(Layer0[NodeIndex].Code, Subnode);
+                if (Clearance.GetSubnodeClearance(LeafIndex, Subnode) != GetBruteForceClearance(Blocked, Coords, Coords))
+                {
+                    Mismatches++;
+                }
+                Checked++;
+            }
+        }
+        UE_LOG(LogTemp, Display, TEXT("Checked %d subnode clearances against %d blocked subnodes"), Checked, Blocked.Num());
+        TestTrue(TEXT("Should check some subnodes"), Checked > 0);
+        TestEqual(TEXT("Subnode clearances should match the brute force distance"), Mismatches, 0);
+    }
+
+    // TEST 2: Free nodes hold the distance from their nearest subnode, subdivided nodes the least of their children
+    {
+        int32 Mismatches = 0;
+        for (int32 LayerIndex = 1; LayerIndex < OctreeData.Layers.Num(); ++LayerIndex)
+        {
+            const TArray<AeonixNode>& Layer = OctreeData.Layers[LayerIndex];
+            for (int32 NodeIndex = 0; NodeIndex < Layer.Num(); ++NodeIndex)
+            {
+                const AeonixNode& Node = Layer[NodeIndex];
+                if (Node.HasChildren())
+                {
+                    uint8 ChildMin = FAeonixClearance::MaxClearance;
+                    for (int32 Child = 0; Child < 8; ++Child)
+                    {
+                        ChildMin = FMath::Min(ChildMin, Clearance.GetNodeClearance(LayerIndex - 1, Node.FirstChild.GetNodeIndex() + Child));
+                    }
+                    if (Clearance.GetNodeClearance(LayerIndex, NodeIndex) != ChildMin)
+                    {
+                        Mismatches++;
+                    }
+                    continue;
+                }
+
+                uint_fast32_t X = 0, Y = 0, Z = 0;
+                morton3D_64_decode(Node.Code, X, Y, Z);
+                const int32 Width = 4 << LayerIndex;
+                const FIntVector Min(static_cast<int32>(X) * Width, static_cast<int32>(Y) * Width, static_cast<int32>(Z) * Width);
+                if (Clearance.GetNodeClearance(LayerIndex, NodeIndex) != GetBruteForceClearance(Blocked, Min, Min + FIntVector(Width - 1)))
+                {
+                    Mismatches++;
+                }
+            }
+        }
+        TestEqual(TEXT("Node clearances should match the brute force distance"), Mismatches, 0);
+    }
+
+    const FVector StartPos(-300, -200, 0);
+    const FVector TargetPos(300, -200, 0);
+
+    AeonixLink StartLink;
+    AeonixLink TargetLink;
+    FString LogMsg;
+    if (!TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, StartPos, StartLink, LogMsg)) ||
+        !TestTrue(TEXT("Found valid target navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, TargetPos, TargetLink, LogMsg)))
+    {
+        return false;
+    }
+
+    // Raw link positions, so every point between the ends is somewhere the search stepped
+    FAeonixPathFinderSettings PathSettings;
+    PathSettings.MaxIterations = 20000;
+    PathSettings.bOptimizePath = false;
+    PathSettings.bUseStringPulling = false;
+    PathSettings.bSmoothPositions = false;
+    PathSettings.AgentRadius = 40.f;
+
+    // TEST 3: A larger agent only steps where it has the room, measured against the blocked subnodes themselves
+    {
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        FAeonixNavigationPath Path;
+        if (TestTrue(TEXT("Larger agent should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, Path)))
+        {
+            const float SubnodeSize = NavData.GetVoxelSize(0) * 0.25f;
+            const FVector VolumeMin = Params.Origin - Params.Extents;
+            const TArray<FAeonixPathPoint>& Points = Path.GetPathPoints();
+            for (int32 i = 1; i < Points.Num() - 1; ++i)
+            {
+                float Room = FLT_MAX;
+                for (const FIntVector& B : Blocked)
+                {
+                    const FVector BoxMin = VolumeMin + FVector(B) * SubnodeSize;
+                    const FVector ToBox = FVector::Max(BoxMin - Points[i].Position, Points[i].Position - (BoxMin + FVector(SubnodeSize))).ComponentMax(FVector::ZeroVector);
+                    Room = FMath::Min(Room, ToBox.GetMax());
+                }
+                TestTrue(FString::Printf(TEXT("Point %d should leave the agent room"), i), Room >= PathSettings.AgentRadius - KINDA_SMALL_NUMBER);
+            }
+        }
+    }
+
+    // TEST 4: An agent too large for anywhere can't leave its start
+    FAeonixPathFinderSettings HugeSettings = PathSettings;
+    HugeSettings.AgentRadius = 10000.f;
+    {
+        AeonixPathFinder PathFinder(NavData, HugeSettings);
+        FAeonixNavigationPath Path;
+        TestFalse(TEXT("An agent larger than the volume should find no path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, Path));
+    }
+
+    // TEST 5: Without the bake the radius is ignored, rather than blocking everything
+    {
+        FAeonixData PlainNavData;
+        Params.bBakeClearance = false;
+        PlainNavData.UpdateGenerationParameters(Params);
+        PlainNavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+        TestFalse(TEXT("Clearance should not be built when not asked for"), PlainNavData.GetClearance().IsValid());
+        TestEqual(TEXT("Links should read as unbounded without the bake"), PlainNavData.GetLinkClearance(StartLink), FLT_MAX);
+
+        AeonixPathFinder PathFinder(PlainNavData, HugeSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Search without the bake should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, Path));
+    }
+
+    // TEST 6: Patching round rewritten leaves gives the same distances as building from scratch
+    {
+        FAeonixOctreeData Rewritten = OctreeData;
+        TArray<nodeindex_t> ChangedLeaves;
+        bool bClearedBlocked = false;
+        bool bBlockedFree = false;
+        for (const AeonixNode& Node : Rewritten.Layers[0])
+        {
+            if (!Node.HasChildren())
+            {
+                continue;
+            }
+
+            // Unblock one leaf and block part of another, so distances both grow and shrink
+            AeonixLeafNode& Leaf = Rewritten.LeafNodes[Node.FirstChild.GetNodeIndex()];
+            if (!bClearedBlocked && Leaf.VoxelGrid != 0)
+            {
+                Leaf.VoxelGrid = 0;
+                bClearedBlocked = true;
+                ChangedLeaves.Add(Node.FirstChild.GetNodeIndex());
+            }
+            else if (!bBlockedFree && Leaf.VoxelGrid == 0)
+            {
+                Leaf.VoxelGrid = 0x8001;
+                bBlockedFree = true;
+                ChangedLeaves.Add(Node.FirstChild.GetNodeIndex());
+            }
+        }
+        TestEqual(TEXT("Should rewrite two leaves"), ChangedLeaves.Num(), 2);
+
+        FAeonixClearance Patched = Clearance;
+        Patched.UpdateLeaves(Rewritten, ChangedLeaves);
+        FAeonixClearance Rebuilt;
+        Rebuilt.Build(Rewritten);
+
+        int32 Mismatches = 0;
+        for (int32 LeafIndex = 0; LeafIndex < Rewritten.LeafNodes.Num(); ++LeafIndex)
+        {
+            for (int32 Subnode = 0; Subnode < 64; ++Subnode)
+            {
+                Mismatches += Patched.GetSubnodeClearance(LeafIndex, Subnode) != Rebuilt.GetSubnodeClearance(LeafIndex, Subnode);
+            }
+        }
+        for (int32 LayerIndex = 0; LayerIndex < Rewritten.Layers.Num(); ++LayerIndex)
+        {
+            for (int32 NodeIndex = 0; NodeIndex < Rewritten.Layers[LayerIndex].Num(); ++NodeIndex)
+            {
+                Mismatches += Patched.GetNodeClearance(LayerIndex, NodeIndex) != Rebuilt.GetNodeClearance(LayerIndex, NodeIndex);
+            }
+        }
+        TestTrue(TEXT("Patched clearance should stay valid"), Patched.IsValid());
+        TestEqual(TEXT("Patched clearance should match a full build"), Mismatches, 0);
+    }
+
+    return true;
+}
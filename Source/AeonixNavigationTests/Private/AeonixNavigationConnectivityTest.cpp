@@ -0,0 +1,96 @@
+#include "Data/AeonixData.h"
+#include "Data/AeonixLeafNode.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_ConnectivityTest,
+    "AeonixNavigation.Connectivity.Components",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAeonixNavigation_ConnectivityTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Connectivity Components Test ==="));
+
+    // Leaf mask sanity checks: dilating a corner voxel reaches exactly its three neighbours
+    TestEqual(TEXT("Dilating voxel (0,0,0) should add (1,0,0), (0,1,0) and (0,0,1)"), (uint64)AeonixLeafNode::DilateMask(1ull), (uint64)0x17);
+    TestEqual(TEXT("Dilating the far corner should not wrap out of the leaf"), (uint64)AeonixLeafNode::DilateMask(1ull << 63), (uint64)((1ull << 63) | (1ull << 62) | (1ull << 61) | (1ull << 59)));
+    TestEqual(TEXT("+X face shifted by 9 should line up with the -X face"), (uint64)(AeonixLeafNode::GetFaceMask(0) >> 9), (uint64)AeonixLeafNode::GetFaceMask(1));
+
+    FTestDebugDrawInterface DebugDraw;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    UWorld* DummyWorld = nullptr;
+
+    // TEST 1: A wall spanning the whole volume splits it in two
+    {
+        FTestWallCollisionQueryInterface WallCollision;
+        FAeonixData NavData;
+        NavData.UpdateGenerationParameters(Params);
+        NavData.Generate(*DummyWorld, WallCollision, DebugDraw);
+
+        TestTrue(TEXT("Connectivity should be built after generation"), NavData.GetConnectivity().IsValid());
+
+        AeonixLink LinkA, LinkB, LinkC;
+        FString LogMsg;
+        const bool bFoundA = FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, FVector(-200, -200, 0), LinkA, LogMsg);
+        const bool bFoundB = FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, FVector(200, 200, 0), LinkB, LogMsg);
+        const bool bFoundC = FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, FVector(300, -400, 300), LinkC, LogMsg);
+
+        TestTrue(TEXT("Found links either side of the wall"), bFoundA && bFoundB && bFoundC);
+        if (bFoundA && bFoundB && bFoundC)
+        {
+            TestTrue(TEXT("Links on the same side of the wall should be connected"), NavData.AreLinksConnected(LinkA, LinkC));
+            TestFalse(TEXT("Links either side of the wall should not be connected"), NavData.AreLinksConnected(LinkA, LinkB));
+
+            // Out of date components must never reject a query
+            NavData.InvalidateConnectivity();
+            TestTrue(TEXT("Invalidated connectivity should treat everything as reachable"), NavData.AreLinksConnected(LinkA, LinkB));
+
+            // Rebuilt on a copy of the octree, as the volume does off the game thread after a regen
+            FAeonixData Rebuilt;
+            Rebuilt.UpdateGenerationParameters(NavData.GetParams());
+            Rebuilt.OctreeData = NavData.OctreeData;
+            Rebuilt.BuildConnectivity();
+            Rebuilt.BuildFreeVolume();
+            NavData.TakeDerivedData(Rebuilt);
+
+            TestTrue(TEXT("Connectivity taken from a rebuilt copy should be valid"), NavData.GetConnectivity().IsValid());
+            TestTrue(TEXT("Free volume taken from a rebuilt copy should be valid"), NavData.GetFreeVolume().IsValid());
+            TestFalse(TEXT("Taken connectivity should separate the two sides again"), NavData.AreLinksConnected(LinkA, LinkB));
+        }
+    }
+
+    // TEST 2: Walls with a gap leave a single component
+    {
+        FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+        FAeonixData NavData;
+        NavData.UpdateGenerationParameters(Params);
+        NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+        AeonixLink StartLink, EndLink;
+        FString LogMsg;
+        const bool bFoundStart = FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, FVector(-300, -200, 0), StartLink, LogMsg);
+        const bool bFoundEnd = FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, FVector(300, -200, 0), EndLink, LogMsg);
+
+        TestTrue(TEXT("Found links either side of the partial wall"), bFoundStart && bFoundEnd);
+        if (bFoundStart && bFoundEnd)
+        {
+            TestTrue(TEXT("Links joined through the gap should be connected"), NavData.AreLinksConnected(StartLink, EndLink));
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("Partial obstacle scene has %d component(s)"), NavData.GetConnectivity().GetNumComponents());
+    }
+
+    return true;
+}
@@ -278,6 +278,67 @@ bool FAeonixNavigation_EmptyLeafOptimizationTest::RunTest(const FString& Paramet
             EmptyLeafNodes);
     }
 
+    // TEST 5: Collapsing empty leaves in a cleared region, as a dynamic region is once its obstacles move away
+    UE_LOG(LogTemp, Display, TEXT("\n=== TEST 5: Collapsed empty leaves ==="));
+    {
+        FAeonixData ClearedNavData;
+        ClearedNavData.UpdateGenerationParameters(Params);
+        ClearedNavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+        // Empty every leaf well to the left of the walls, they keep their subdivision like dynamic region leaves do
+        int32 ClearedLeaves = 0;
+        const TArray<AeonixNode>& ClearedLayer0 = ClearedNavData.OctreeData.GetLayer(0);
+        for (int32 i = 0; i < ClearedLayer0.Num(); ++i)
+        {
+            FVector NodePosition;
+            ClearedNavData.GetNodePosition(0, ClearedLayer0[i].Code, NodePosition);
+            if (ClearedLayer0[i].HasChildren() && NodePosition.X < -150.f)
+            {
+                ClearedNavData.OctreeData.LeafNodes[ClearedLayer0[i].FirstChild.GetNodeIndex()].Clear();
+                ClearedLeaves++;
+            }
+        }
+        ClearedNavData.BuildConnectivity();
+        UE_LOG(LogTemp, Display, TEXT("  Cleared %d leaves"), ClearedLeaves);
+
+        const FVector ClearedStart(-400, -200, 0);
+        const FVector ClearedEnd(300, -200, 0);
+        AeonixLink ClearedStartLink, ClearedEndLink;
+        FString ClearedLogMsg;
+        if (TestTrue(TEXT("Found valid start link in cleared region"), FAeonixNavigationTestUtils::FindLinkAtPosition(ClearedNavData, ClearedStart, ClearedStartLink, ClearedLogMsg)) &&
+            TestTrue(TEXT("Found valid end link past the walls"), FAeonixNavigationTestUtils::FindLinkAtPosition(ClearedNavData, ClearedEnd, ClearedEndLink, ClearedLogMsg)))
+        {
+            FAeonixPathFinderSettings CollapseSettings = PathSettings;
+            CollapseSettings.bCollapseEmptyLeaves = false;
+
+            AeonixPathFinder PlainPathFinder(ClearedNavData, CollapseSettings);
+            FAeonixNavigationPath PlainPath;
+            const bool bPlainFound = PlainPathFinder.FindPath(ClearedStartLink, ClearedEndLink, ClearedStart, ClearedEnd, PlainPath);
+
+            CollapseSettings.bCollapseEmptyLeaves = true;
+            AeonixPathFinder CollapsePathFinder(ClearedNavData, CollapseSettings);
+            FAeonixNavigationPath CollapsedPath;
+            const bool bCollapsedFound = CollapsePathFinder.FindPath(ClearedStartLink, ClearedEndLink, ClearedStart, ClearedEnd, CollapsedPath);
+
+            TestTrue(TEXT("Path should exist without collapsing"), bPlainFound);
+            TestTrue(TEXT("Path should exist with empty leaves collapsed"), bCollapsedFound);
+            TestTrue(TEXT("Collapsing empty leaves should take no more iterations"), CollapsePathFinder.GetLastIterationCount() <= PlainPathFinder.GetLastIterationCount());
+
+            UE_LOG(LogTemp, Display, TEXT("  Iterations: %d collapsed, %d plain"), CollapsePathFinder.GetLastIterationCount(), PlainPathFinder.GetLastIterationCount());
+
+            // Crossing a leaf in one step still has to go through the gap
+            for (const FAeonixPathPoint& Point : CollapsedPath.GetPathPoints())
+            {
+                if (FMath::Abs(Point.Position.X) < ObstacleCollision.Obstacle1_Thickness * 0.5f &&
+                    ((Point.Position.Y >= ObstacleCollision.Obstacle1_YMin && Point.Position.Y <= ObstacleCollision.Obstacle1_YMax) ||
+                     (Point.Position.Y >= ObstacleCollision.Obstacle2_YMin && Point.Position.Y <= ObstacleCollision.Obstacle2_YMax)))
+                {
+                    AddError(FString::Printf(TEXT("Collapsed path point at %s is inside an obstacle!"), *Point.Position.ToString()));
+                }
+            }
+        }
+    }
+
     UE_LOG(LogTemp, Display, TEXT("\n=== Empty Leaf Optimization Test Complete ==="));
 
     return true;
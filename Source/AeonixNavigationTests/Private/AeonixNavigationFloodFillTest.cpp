@@ -0,0 +1,148 @@
+#include "Data/AeonixData.h"
+#include "Data/AeonixLink.h"
+#include "EQS/AeonixFloodFillCache.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_FloodFillTest,
+    "AeonixNavigation.Pathfinding.FloodFill",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace
+{
+    // The queue and set flood the EQS generator used to run, which the bitset flood should match point for point
+    void ReferenceFloodFill(const FAeonixData& NavData, const AeonixLink& Start, const FVector& Centre, float Radius, int32 MaxSteps, TArray<FVector>& OutPositions)
+    {
+        TSet<AeonixLink> Visited;
+        TQueue<AeonixLink> Queue;
+        Queue.Enqueue(Start);
+        Visited.Add(Start);
+
+        int32 StepCount = 0;
+        while (!Queue.IsEmpty() && StepCount < MaxSteps)
+        {
+            AeonixLink CurrentLink;
+            Queue.Dequeue(CurrentLink);
+            StepCount++;
+
+            FVector CurrentPos;
+            if (!NavData.GetLinkPosition(CurrentLink, CurrentPos) || FVector::DistSquared(CurrentPos, Centre) > Radius * Radius)
+            {
+                continue;
+            }
+            OutPositions.Add(CurrentPos);
+
+            TArray<AeonixLink> Neighbours;
+            const AeonixNode& CurrentNode = NavData.OctreeData.GetNode(CurrentLink);
+            if (CurrentLink.GetLayerIndex() == 0 && CurrentNode.FirstChild.IsValid())
+            {
+                NavData.OctreeData.GetLeafNeighbours(CurrentLink, Neighbours);
+            }
+            else
+            {
+                NavData.GetNeighbours(CurrentLink, Neighbours);
+            }
+
+            for (const AeonixLink& Neighbour : Neighbours)
+            {
+                FVector NeighbourPos;
+                if (!Neighbour.IsValid() || Visited.Contains(Neighbour) || !NavData.GetLinkPosition(Neighbour, NeighbourPos) || FVector::DistSquared(NeighbourPos, Centre) > Radius * Radius)
+                {
+                    continue;
+                }
+                Visited.Add(Neighbour);
+                Queue.Enqueue(Neighbour);
+            }
+        }
+    }
+}
+
+bool FAeonixNavigation_FloodFillTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Flood Fill Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    AeonixLink StartLink;
+    FString LogMsg;
+    if (!TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, FVector(-100, -200, 0), StartLink, LogMsg)))
+    {
+        return false;
+    }
+
+    FVector Centre;
+    NavData.GetLinkPosition(StartLink, Centre);
+
+    // TEST 1: The bitset flood reaches the same points in the same order as the queue, whether the step limit or the radius stops it
+    const TArray<TPair<float, int32>> Limits = { { 400.f, 1000 }, { 400.f, 37 }, { 2000.f, 5000 } };
+    for (const TPair<float, int32>& Limit : Limits)
+    {
+        TArray<FVector> Expected;
+        ReferenceFloodFill(NavData, StartLink, Centre, Limit.Key, Limit.Value, Expected);
+
+        TArray<FVector> Reached;
+        NavData.FloodFill(StartLink, Centre, Limit.Key, Limit.Value, Reached);
+
+        UE_LOG(LogTemp, Display, TEXT("Radius %.0f, %d steps: reached %d points, expected %d"), Limit.Key, Limit.Value, Reached.Num(), Expected.Num());
+        TestTrue(TEXT("Flood should reach something"), Reached.Num() > 0);
+        TestTrue(TEXT("Flood should take no more than its steps"), Reached.Num() <= Limit.Value);
+        TestTrue(FString::Printf(TEXT("Flood with radius %.0f and %d steps should match the queue flood"), Limit.Key, Limit.Value), Reached == Expected);
+    }
+
+    // TEST 2: Cached points come back until the volume or a region under them is regenerated
+    {
+        FAeonixFloodFillCache Cache;
+        Cache.SetCapacity(4);
+
+        FAeonixFloodFillCacheKey Key;
+        Key.Origin = StartLink;
+        Key.Radius = 400.f;
+        Key.MaxSteps = 1000;
+
+        const FGuid RegionId = FGuid::NewGuid();
+        uint32 RegionVersion = 3;
+        auto GetRegionVersion = [&RegionVersion](const FGuid&) { return RegionVersion; };
+
+        TArray<FVector> Points;
+        NavData.FloodFill(StartLink, Centre, Key.Radius, Key.MaxSteps, Points);
+
+        TMap<FGuid, uint32> Versions;
+        Versions.Add(RegionId, RegionVersion);
+        Cache.Add(Key, NavData.GetGenerationId(), Points, MoveTemp(Versions));
+
+        TArray<FVector> Cached;
+        TestTrue(TEXT("Same key should hit"), Cache.Find(Key, NavData.GetGenerationId(), GetRegionVersion, Cached));
+        TestTrue(TEXT("Hit should return the flood's points"), Cached == Points);
+
+        FAeonixFloodFillCacheKey OtherKey = Key;
+        OtherKey.MaxSteps = 10;
+        TestFalse(TEXT("Different step limit should miss"), Cache.Find(OtherKey, NavData.GetGenerationId(), GetRegionVersion, Cached));
+
+        TestFalse(TEXT("New generation should miss"), Cache.Find(Key, NavData.GetGenerationId() + 1, GetRegionVersion, Cached));
+
+        Versions.Add(RegionId, RegionVersion);
+        Cache.Add(Key, NavData.GetGenerationId(), Points, MoveTemp(Versions));
+        RegionVersion++;
+        TestFalse(TEXT("Regenerated region should miss"), Cache.Find(Key, NavData.GetGenerationId(), GetRegionVersion, Cached));
+    }
+
+    return true;
+}
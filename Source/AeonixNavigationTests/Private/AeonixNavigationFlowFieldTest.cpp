@@ -0,0 +1,139 @@
+#include "Data/AeonixData.h"
+#include "Pathfinding/AeonixFlowField.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_FlowFieldTest,
+    "AeonixNavigation.Pathfinding.FlowField",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAeonixNavigation_FlowFieldTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Flow Field Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    const FVector TargetPos(300, -200, 0);
+    const TArray<FVector> SourcePositions = { FVector(-300, -200, 0), FVector(-300, 200, 0), FVector(200, -300, 100) };
+
+    AeonixLink TargetLink;
+    FString LogMsg;
+    if (!TestTrue(TEXT("Found valid target navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, TargetPos, TargetLink, LogMsg)))
+    {
+        return false;
+    }
+
+    FAeonixPathFinderSettings PathSettings;
+    PathSettings.MaxIterations = 10000;
+
+    FAeonixFlowField FlowField;
+    TestFalse(TEXT("Field should start invalid"), FlowField.IsValid());
+
+    FlowField.Reset(TargetLink, TargetPos, NavData.GetGenerationId());
+    TestTrue(TEXT("Field should be valid once rooted"), FlowField.IsValid());
+
+    // TEST 1: Every source reads a path that runs from its position to the target, including those behind the wall
+    int32 PreviousSettled = 0;
+    for (const FVector& SourcePos : SourcePositions)
+    {
+        AeonixLink SourceLink;
+        if (!TestTrue(TEXT("Found valid source navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, SourcePos, SourceLink, LogMsg)))
+        {
+            return false;
+        }
+
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        FAeonixNavigationPath Path;
+        const bool bPathFound = PathFinder.FindPathFromFlowField(FlowField, SourceLink, SourcePos, Path);
+
+        TestTrue(FString::Printf(TEXT("Flow field should give a path from %s"), *SourcePos.ToCompactString()), bPathFound);
+        TestTrue(TEXT("Source should be settled after reading its path"), FlowField.IsSettled(SourceLink));
+        TestTrue(TEXT("Field should only ever grow between reads"), FlowField.GetNumSettled() >= PreviousSettled);
+        PreviousSettled = FlowField.GetNumSettled();
+
+        if (bPathFound)
+        {
+            const TArray<FAeonixPathPoint>& PathPoints = Path.GetPathPoints();
+            TestTrue(TEXT("Path should start at the source position"), PathPoints.Num() > 0 && PathPoints[0].Position.Equals(SourcePos));
+            TestTrue(TEXT("Path should end at the target position"), PathPoints.Num() > 0 && PathPoints.Last().Position.Equals(TargetPos));
+        }
+    }
+
+    // TEST 2: Reading a settled source again doesn't search any further
+    {
+        AeonixLink SourceLink;
+        FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, SourcePositions[0], SourceLink, LogMsg);
+
+        const int32 SettledBefore = FlowField.GetNumSettled();
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Second read should succeed"), PathFinder.FindPathFromFlowField(FlowField, SourceLink, SourcePositions[0], Path));
+        TestEqual(TEXT("Second read should not expand the field"), FlowField.GetNumSettled(), SettledBefore);
+    }
+
+    // TEST 3: Moving the target within its voxel only moves the end of the path
+    {
+        const FVector NudgedTarget = TargetPos + FVector(1, 1, 1);
+        FlowField.SetTargetPosition(NudgedTarget);
+
+        AeonixLink SourceLink;
+        FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, SourcePositions[1], SourceLink, LogMsg);
+
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Read after nudging the target should succeed"), PathFinder.FindPathFromFlowField(FlowField, SourceLink, SourcePositions[1], Path));
+        TestTrue(TEXT("Path should end at the nudged target"), Path.GetNumPoints() > 0 && Path.GetPathPoints().Last().Position.Equals(NudgedTarget));
+    }
+
+    // TEST 4: A capped read stops early but keeps what it settled, so later reads carry on from there
+    {
+        FAeonixFlowField BudgetedField;
+        BudgetedField.Reset(TargetLink, TargetPos, NavData.GetGenerationId());
+
+        AeonixLink SourceLink;
+        FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, SourcePositions[0], SourceLink, LogMsg);
+
+        const int32 Budget = 8;
+        int32 Reads = 0;
+        bool bPathFound = false;
+        while (!bPathFound && Reads < 10000)
+        {
+            const int32 SettledBefore = BudgetedField.GetNumSettled();
+            AeonixPathFinder PathFinder(NavData, PathSettings);
+            FAeonixNavigationPath Path;
+            bPathFound = PathFinder.FindPathFromFlowField(BudgetedField, SourceLink, SourcePositions[0], Path, Budget);
+            TestTrue(TEXT("A capped read should settle no more than its budget"), BudgetedField.GetNumSettled() - SettledBefore <= Budget + 1);
+            Reads++;
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("Budget of %d settled the source behind the wall in %d reads"), Budget, Reads);
+        TestTrue(TEXT("Capped reads should reach the source eventually"), bPathFound);
+        TestTrue(TEXT("A far source should take more than one capped read"), Reads > 1);
+    }
+
+    FlowField.Invalidate();
+    TestFalse(TEXT("Invalidated field should not be usable"), FlowField.IsValid());
+
+    return true;
+}
@@ -0,0 +1,162 @@
+#include "Data/AeonixData.h"
+#include "Pathfinding/AeonixIncrementalSearch.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_IncrementalTest,
+    "AeonixNavigation.Pathfinding.Incremental",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace
+{
+    float GetPathLength(const FAeonixNavigationPath& Path)
+    {
+        float Length = 0.f;
+        const TArray<FAeonixPathPoint>& Points = Path.GetPathPoints();
+        for (int32 i = 1; i < Points.Num(); ++i)
+        {
+            Length += FVector::Dist(Points[i - 1].Position, Points[i].Position);
+        }
+        return Length;
+    }
+}
+
+bool FAeonixNavigation_IncrementalTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Incremental Search Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    // Start and goal on opposite sides of the wall, well away from the gap
+    const FVector StartPos(-300, -200, 0);
+    const FVector TargetPos(300, -200, 0);
+
+    AeonixLink StartLink;
+    AeonixLink TargetLink;
+    FString LogMsg;
+    if (!TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, StartPos, StartLink, LogMsg)) ||
+        !TestTrue(TEXT("Found valid target navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, TargetPos, TargetLink, LogMsg)))
+    {
+        return false;
+    }
+
+    FAeonixPathFinderSettings PathSettings;
+    PathSettings.MaxIterations = 10000;
+
+    FAeonixIncrementalSearch Search;
+    TestFalse(TEXT("Search should start invalid"), Search.IsValid());
+
+    // TEST 1: The first search runs from scratch and goes round through the gap
+    FAeonixNavigationPath FirstPath;
+    {
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        if (!TestTrue(TEXT("First search should find a path"), PathFinder.FindPathIncremental(Search, StartLink, TargetLink, StartPos, TargetPos, FirstPath)))
+        {
+            return false;
+        }
+    }
+    TestFalse(TEXT("First search should not be a repair"), Search.WasLastSearchRepair());
+    TestTrue(TEXT("Search should be valid after the first search"), Search.IsValid());
+    TestTrue(TEXT("Path should start at the start position"), FirstPath.GetNumPoints() > 0 && FirstPath.GetPathPoints()[0].Position.Equals(StartPos));
+    TestTrue(TEXT("Path should end at the target position"), FirstPath.GetNumPoints() > 0 && FirstPath.GetPathPoints().Last().Position.Equals(TargetPos));
+    const int32 FullExpansions = Search.GetLastExpansions();
+
+    // TEST 2: Asking again with nothing changed is a repair that has nothing to do
+    {
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Unchanged repair should find a path"), PathFinder.FindPathIncremental(Search, StartLink, TargetLink, StartPos, TargetPos, Path));
+        TestTrue(TEXT("Unchanged search should be a repair"), Search.WasLastSearchRepair());
+        TestTrue(TEXT("Unchanged repair should expand fewer nodes than the full search"), Search.GetLastExpansions() < FullExpansions);
+    }
+
+    // TEST 3: Open a hole in the wall on the straight line between start and goal, the repaired path should use it.
+    // The repair only revisits the subnodes that flipped, which are recorded along with the leaves
+    {
+        TArray<nodeindex_t> OpenedLeaves;
+        TArray<uint64> OpenedVoxels;
+        const TArray<AeonixNode>& Layer0 = NavData.OctreeData.GetLayer(0);
+        for (int32 NodeIndex = 0; NodeIndex < Layer0.Num(); ++NodeIndex)
+        {
+            FVector NodePos;
+            NavData.GetLinkPosition(AeonixLink(0, NodeIndex, 0), NodePos);
+            if (Layer0[NodeIndex].FirstChild.IsValid() && FMath::Abs(NodePos.X) < 100.f && FMath::Abs(NodePos.Y + 200.f) < 100.f && FMath::Abs(NodePos.Z) < 100.f)
+            {
+                uint64& VoxelGrid = NavData.OctreeData.LeafNodes[Layer0[NodeIndex].FirstChild.GetNodeIndex()].VoxelGrid;
+                OpenedLeaves.Add(NodeIndex);
+                OpenedVoxels.Add(VoxelGrid);
+                VoxelGrid = 0;
+            }
+        }
+
+        if (!TestTrue(TEXT("Found wall leaves to open"), OpenedLeaves.Num() > 0))
+        {
+            return false;
+        }
+
+        NavData.RecordLeafChanges(MoveTemp(OpenedLeaves), MoveTemp(OpenedVoxels));
+
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Repair after opening the wall should find a path"), PathFinder.FindPathIncremental(Search, StartLink, TargetLink, StartPos, TargetPos, Path));
+        TestTrue(TEXT("Search after a recorded change should be a repair"), Search.WasLastSearchRepair());
+        TestTrue(TEXT("Repaired path should end at the target position"), Path.GetNumPoints() > 0 && Path.GetPathPoints().Last().Position.Equals(TargetPos));
+        TestTrue(TEXT("Repaired path should be shorter than the way round through the gap"), GetPathLength(Path) < GetPathLength(FirstPath));
+
+        // A fresh search on the changed data should agree with the repair
+        FAeonixIncrementalSearch FreshSearch;
+        FAeonixNavigationPath FreshPath;
+        AeonixPathFinder FreshPathFinder(NavData, PathSettings);
+        TestTrue(TEXT("Fresh search after opening the wall should find a path"), FreshPathFinder.FindPathIncremental(FreshSearch, StartLink, TargetLink, StartPos, TargetPos, FreshPath));
+        TestTrue(TEXT("Repaired path should be as short as a fresh search's"), FMath::IsNearlyEqual(GetPathLength(Path), GetPathLength(FreshPath), 1.f));
+    }
+
+    // TEST 4: Once the change history has moved on past the search, it starts again from scratch
+    {
+        for (int32 i = 0; i < 16; ++i)
+        {
+            NavData.RecordLeafChanges(TArray<nodeindex_t>());
+        }
+
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Search after losing the history should find a path"), PathFinder.FindPathIncremental(Search, StartLink, TargetLink, StartPos, TargetPos, Path));
+        TestFalse(TEXT("Search after losing the history should not be a repair"), Search.WasLastSearchRepair());
+    }
+
+    // TEST 5: A different goal always starts again
+    {
+        const FVector OtherTargetPos(300, 200, 0);
+        AeonixLink OtherTargetLink;
+        FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, OtherTargetPos, OtherTargetLink, LogMsg);
+
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Search to a new goal should find a path"), PathFinder.FindPathIncremental(Search, StartLink, OtherTargetLink, StartPos, OtherTargetPos, Path));
+        TestFalse(TEXT("Search to a new goal should not be a repair"), Search.WasLastSearchRepair());
+        TestTrue(TEXT("Search should now be towards the new goal"), Search.GetGoalLink() == OtherTargetLink);
+    }
+
+    return true;
+}
@@ -0,0 +1,106 @@
+#include "Data/AeonixData.h"
+#include "Data/AeonixLeafNode.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_LeafJumpPointSearchTest,
+    "AeonixNavigation.Pathfinding.LeafJumpPointSearch",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAeonixNavigation_LeafJumpPointSearchTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Leaf Jump Point Search Test ==="));
+
+    // Row extraction sanity check: block x=1 and x=3 on the row y=2, z=1
+    AeonixLeafNode TestLeaf;
+    TestLeaf.SetNodeAt(1, 2, 1);
+    TestLeaf.SetNodeAt(3, 2, 1);
+    TestEqual(TEXT("Free row along X should only have x=0 and x=2 set"), (int32)TestLeaf.GetFreeRow(0, 0, 2, 1), 0x5);
+    TestEqual(TEXT("Free row along Y through a blocked voxel should only clear that voxel"), (int32)TestLeaf.GetFreeRow(1, 1, 0, 1), 0xB);
+    TestEqual(TEXT("Untouched rows should be completely free"), (int32)TestLeaf.GetFreeRow(2, 0, 0, 0), 0xF);
+
+    // Setup - the partial obstacle scene subdivides the walls into leaves with gaps
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    FVector StartPos(-300, 0, 0);
+    FVector EndPos(300, 0, 0);
+
+    AeonixLink StartLink, EndLink;
+    FString StartLogMsg, EndLogMsg;
+
+    const bool bFoundStart = FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, StartPos, StartLink, StartLogMsg);
+    const bool bFoundEnd = FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, EndPos, EndLink, EndLogMsg);
+
+    TestTrue(TEXT("Found valid start navigation link"), bFoundStart);
+    TestTrue(TEXT("Found valid end navigation link"), bFoundEnd);
+
+    if (!bFoundStart || !bFoundEnd)
+    {
+        return false;
+    }
+
+    FAeonixPathFinderSettings PathSettings;
+    PathSettings.MaxIterations = 10000;
+    PathSettings.bUseStringPulling = false;
+    PathSettings.bSmoothPositions = false;
+    PathSettings.bOptimizePath = false;
+    PathSettings.HeuristicSettings.EuclideanWeight = 1.0f;
+    PathSettings.HeuristicSettings.GlobalWeight = 1.0f;
+
+    // Baseline search, one subnode at a time
+    AeonixPathFinder BaselineFinder(NavData, PathSettings);
+    FAeonixNavigationPath BaselinePath;
+    const bool bBaselineFound = BaselineFinder.FindPath(StartLink, EndLink, StartPos, EndPos, BaselinePath);
+    const int32 BaselineIterations = BaselineFinder.GetLastIterationCount();
+
+    // Jump point search through the leaves
+    PathSettings.bUseLeafJumpPointSearch = true;
+    AeonixPathFinder JumpFinder(NavData, PathSettings);
+    FAeonixNavigationPath JumpPath;
+    const bool bJumpFound = JumpFinder.FindPath(StartLink, EndLink, StartPos, EndPos, JumpPath);
+    const int32 JumpIterations = JumpFinder.GetLastIterationCount();
+
+    UE_LOG(LogTemp, Display, TEXT("Baseline: found=%d iterations=%d points=%d"), bBaselineFound, BaselineIterations, BaselinePath.GetPathPoints().Num());
+    UE_LOG(LogTemp, Display, TEXT("Jump point: found=%d iterations=%d points=%d"), bJumpFound, JumpIterations, JumpPath.GetPathPoints().Num());
+
+    TestTrue(TEXT("Baseline search should find a path through the gap"), bBaselineFound);
+    TestTrue(TEXT("Jump point search should find a path through the gap"), bJumpFound);
+
+    if (bJumpFound)
+    {
+        // Every point of the jump point path must still sit in free space
+        const TArray<FAeonixPathPoint>& PathPoints = JumpPath.GetPathPoints();
+        for (int32 i = 0; i < PathPoints.Num(); ++i)
+        {
+            const FVector& Position = PathPoints[i].Position;
+            const bool bInObstacle = FMath::Abs(Position.X) < ObstacleCollision.Obstacle1_Thickness * 0.5f &&
+                ((Position.Y >= ObstacleCollision.Obstacle1_YMin && Position.Y <= ObstacleCollision.Obstacle1_YMax) ||
+                 (Position.Y >= ObstacleCollision.Obstacle2_YMin && Position.Y <= ObstacleCollision.Obstacle2_YMax));
+
+            TestFalse(FString::Printf(TEXT("Jump point path point %d should not be inside an obstacle"), i), bInObstacle);
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,158 @@
+#include "Data/AeonixData.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_LandmarkTest,
+    "AeonixNavigation.Pathfinding.Landmarks",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace
+{
+    float GetPathLength(const FAeonixNavigationPath& Path)
+    {
+        float Length = 0.f;
+        const TArray<FAeonixPathPoint>& Points = Path.GetPathPoints();
+        for (int32 i = 1; i < Points.Num(); ++i)
+        {
+            Length += FVector::Dist(Points[i - 1].Position, Points[i].Position);
+        }
+        return Length;
+    }
+}
+
+bool FAeonixNavigation_LandmarkTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Landmark Heuristic Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+    Params.NumLandmarks = 4;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    // TEST 1: Generation places the landmarks
+    const FAeonixLandmarks& Landmarks = NavData.GetLandmarks();
+    if (!TestTrue(TEXT("Landmarks should be valid after generation"), Landmarks.IsValid()))
+    {
+        return false;
+    }
+    TestTrue(TEXT("Should place at least one landmark"), Landmarks.GetLandmarks().Num() > 0);
+    TestTrue(TEXT("Should place no more landmarks than asked for"), Landmarks.GetLandmarks().Num() <= Params.NumLandmarks);
+
+    // Start and goal on opposite sides of the wall, well away from the gap
+    const FVector StartPos(-300, -200, 0);
+    const FVector TargetPos(300, -200, 0);
+
+    AeonixLink StartLink;
+    AeonixLink TargetLink;
+    FString LogMsg;
+    if (!TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, StartPos, StartLink, LogMsg)) ||
+        !TestTrue(TEXT("Found valid target navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, TargetPos, TargetLink, LogMsg)))
+    {
+        return false;
+    }
+
+    TestEqual(TEXT("Bound from a link to itself should be 0"), Landmarks.GetLowerBound(StartLink, StartLink), 0.f);
+
+    // Unweighted, unsmoothed searches, so the path length is the sum of the edge costs the landmarks were measured with
+    FAeonixPathFinderSettings PathSettings;
+    PathSettings.MaxIterations = 20000;
+    PathSettings.HeuristicSettings.NodeSizeWeight = 0.f;
+    PathSettings.HeuristicSettings.GlobalWeight = 1.f;
+    PathSettings.bOptimizePath = false;
+    PathSettings.bUseStringPulling = false;
+    PathSettings.bSmoothPositions = false;
+    PathSettings.HeuristicSettings.bUseLandmarks = true;
+
+    FAeonixPathFinderSettings EuclideanSettings = PathSettings;
+    EuclideanSettings.HeuristicSettings.bUseLandmarks = false;
+
+    FAeonixNavigationPath EuclideanPath;
+    int32 EuclideanIterations = 0;
+    {
+        AeonixPathFinder PathFinder(NavData, EuclideanSettings);
+        if (!TestTrue(TEXT("Euclidean search should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, EuclideanPath)))
+        {
+            return false;
+        }
+        EuclideanIterations = PathFinder.GetLastIterationCount();
+    }
+
+    // TEST 2: The bound never exceeds the length of an actual path, allowing for the ends being moved off the link centres
+    const float Bound = Landmarks.GetLowerBound(StartLink, TargetLink);
+    const float EndTolerance = NavData.GetVoxelSize(0);
+    TestTrue(TEXT("Bound should not overestimate the path length"), Bound <= GetPathLength(EuclideanPath) + EndTolerance);
+    TestEqual(TEXT("Bound should be symmetric"), Landmarks.GetLowerBound(TargetLink, StartLink), Bound);
+
+    // TEST 3: The landmark heuristic finds as short a path with no more iterations
+    {
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Landmark search should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, Path));
+        TestTrue(TEXT("Landmark search should take no more iterations than euclidean"), PathFinder.GetLastIterationCount() <= EuclideanIterations);
+        TestTrue(TEXT("Landmark path should be as short as the euclidean path"), FMath::IsNearlyEqual(GetPathLength(Path), GetPathLength(EuclideanPath), 1.f));
+
+        UE_LOG(LogTemp, Display, TEXT("Landmark bound %.1f, straight line %.1f, iterations %d vs %d euclidean"),
+            Bound, FVector::Dist(StartPos, TargetPos), PathFinder.GetLastIterationCount(), EuclideanIterations);
+    }
+
+    // TEST 4: The bound stays admissible under the default weights, which would otherwise overestimate
+    {
+        FAeonixPathFinderSettings WeightedSettings = PathSettings;
+        WeightedSettings.HeuristicSettings.NodeSizeWeight = FAeonixPathFinderSettings().HeuristicSettings.NodeSizeWeight;
+        WeightedSettings.HeuristicSettings.GlobalWeight = 10.f;
+
+        AeonixPathFinder PathFinder(NavData, WeightedSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Weighted landmark search should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, Path));
+        TestTrue(TEXT("Default weights should not lengthen the landmark path"), FMath::IsNearlyEqual(GetPathLength(Path), GetPathLength(EuclideanPath), 1.f));
+    }
+
+    // TEST 5: Changing leaves invalidates the landmarks until they're rebuilt
+    {
+        NavData.RecordLeafChanges({ 0 });
+        TestFalse(TEXT("Landmarks should be invalid after a leaf change"), Landmarks.IsValid());
+        TestEqual(TEXT("Invalid landmarks should give no bound"), Landmarks.GetLowerBound(StartLink, TargetLink), 0.f);
+
+        // Rebuilt on a copy of the octree, as the volume does off the game thread once regens settle
+        FAeonixData Rebuilt;
+        Rebuilt.UpdateGenerationParameters(NavData.GetParams());
+        Rebuilt.OctreeData = NavData.OctreeData;
+        Rebuilt.BuildLandmarks();
+        NavData.TakeDerivedData(Rebuilt);
+
+        TestTrue(TEXT("Landmarks should be valid after a rebuild"), Landmarks.IsValid());
+        TestTrue(TEXT("Rebuilt landmarks should bound the path again"), Landmarks.GetLowerBound(StartLink, TargetLink) > 0.f);
+    }
+
+    // TEST 6: No landmarks asked for, none built
+    {
+        FAeonixData PlainNavData;
+        Params.NumLandmarks = 0;
+        PlainNavData.UpdateGenerationParameters(Params);
+        PlainNavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+        TestFalse(TEXT("Landmarks should not be built when none are asked for"), PlainNavData.GetLandmarks().IsValid());
+        TestEqual(TEXT("No landmarks should give no bound"), PlainNavData.GetLandmarks().GetLowerBound(StartLink, TargetLink), 0.f);
+    }
+
+    return true;
+}
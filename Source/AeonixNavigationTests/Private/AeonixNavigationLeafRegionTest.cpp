@@ -0,0 +1,149 @@
+#include "Data/AeonixData.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_LeafRegionTest,
+    "AeonixNavigation.Pathfinding.LeafRegions",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAeonixNavigation_LeafRegionTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Leaf Region Expansion Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    // TEST 1: Region masks from the connectivity match flood filling the leaf, and partition its free subnodes
+    {
+        int32 Mismatches = 0;
+        for (int32 LeafIndex = 0; LeafIndex < NavData.OctreeData.LeafNodes.Num(); ++LeafIndex)
+        {
+            const uint64 Free = ~static_cast<uint64>(NavData.OctreeData.LeafNodes[LeafIndex].VoxelGrid);
+            uint64 Covered = 0;
+            for (uint64 Bits = Free; Bits; Bits &= Bits - 1)
+            {
+                const subnodeindex_t Subnode = static_cast<subnodeindex_t>(FMath::CountTrailingZeros64(Bits));
+                const uint64 Region = NavData.GetLeafRegionMask(LeafIndex, Subnode);
+                if (Region != AeonixLeafNode::FloodFillMask(1ull << Subnode, Free) || !(Region & (1ull << Subnode)))
+                {
+                    Mismatches++;
+                }
+                Covered |= Region;
+            }
+
+            if (Covered != Free || (~Free && NavData.GetLeafRegionMask(LeafIndex, static_cast<subnodeindex_t>(FMath::CountTrailingZeros64(~Free))) != 0))
+            {
+                Mismatches++;
+            }
+        }
+        TestEqual(TEXT("Leaf region masks should match a flood fill of each leaf"), Mismatches, 0);
+    }
+
+    const FVector StartPos(-300, -200, 0);
+    const FVector TargetPos(300, -200, 0);
+
+    AeonixLink StartLink;
+    AeonixLink TargetLink;
+    FString LogMsg;
+    if (!TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, StartPos, StartLink, LogMsg)) ||
+        !TestTrue(TEXT("Found valid target navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, TargetPos, TargetLink, LogMsg)))
+    {
+        return false;
+    }
+
+    // Raw points, so the subnodes filled in across each region can be checked
+    FAeonixPathFinderSettings PathSettings;
+    PathSettings.MaxIterations = 20000;
+    PathSettings.bOptimizePath = false;
+    PathSettings.bUseStringPulling = false;
+    PathSettings.bSmoothPositions = false;
+
+    FAeonixNavigationPath PlainPath;
+    int32 PlainIterations = 0;
+    {
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        if (!TestTrue(TEXT("Plain search should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, PlainPath)))
+        {
+            return false;
+        }
+        PlainIterations = PathFinder.GetLastIterationCount();
+    }
+
+    FAeonixPathFinderSettings RegionSettings = PathSettings;
+    RegionSettings.bExpandLeafRegions = true;
+
+    auto CheckRegionPath = [&](const FString& Name, const FAeonixNavigationPath& Path)
+    {
+        const TArray<FAeonixPathPoint>& Points = Path.GetPathPoints();
+        if (!TestTrue(FString::Printf(TEXT("%s: path should reach the target"), *Name), Points.Num() > 1 && Points.Last().Position.Equals(TargetPos)))
+        {
+            return;
+        }
+
+        // Consecutive subnode points are always a single step apart once the regions are filled in
+        const float SubnodeSize = NavData.GetVoxelSize(0) * 0.25f;
+        int32 SubnodeSteps = 0;
+        for (int32 i = 2; i < Points.Num() - 1; ++i)
+        {
+            if (Points[i - 1].Layer == 0 && Points[i].Layer == 0)
+            {
+                SubnodeSteps++;
+                TestTrue(FString::Printf(TEXT("%s: subnode points %d and %d should be adjacent"), *Name, i - 1, i), FVector::Dist(Points[i - 1].Position, Points[i].Position) <= SubnodeSize * 1.01f);
+            }
+        }
+        UE_LOG(LogTemp, Display, TEXT("%s: %d points, %d subnode steps"), *Name, Points.Num(), SubnodeSteps);
+    };
+
+    // TEST 2: Expanding whole regions reaches the target in no more iterations, with every subnode step filled in
+    {
+        AeonixPathFinder PathFinder(NavData, RegionSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Region search should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, Path));
+        TestTrue(TEXT("Region search should take no more iterations than the plain search"), PathFinder.GetLastIterationCount() <= PlainIterations);
+        CheckRegionPath(TEXT("Regions"), Path);
+
+        UE_LOG(LogTemp, Display, TEXT("Region search %d iterations, plain search %d"), PathFinder.GetLastIterationCount(), PlainIterations);
+    }
+
+    // TEST 3: While the connectivity is out of date, regions are flood filled from the leaves instead
+    {
+        NavData.InvalidateConnectivity();
+
+        AeonixPathFinder PathFinder(NavData, RegionSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Region search without connectivity should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, Path));
+        CheckRegionPath(TEXT("Flood filled regions"), Path);
+
+        NavData.BuildConnectivity();
+    }
+
+    // TEST 4: A search starting and ending in the same region steps straight to the goal
+    {
+        AeonixPathFinder PathFinder(NavData, RegionSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Search to the start link should find a path"), PathFinder.FindPath(StartLink, StartLink, StartPos, StartPos, Path));
+        TestTrue(TEXT("Search to the start link should take at most one iteration"), PathFinder.GetLastIterationCount() <= 1);
+    }
+
+    return true;
+}
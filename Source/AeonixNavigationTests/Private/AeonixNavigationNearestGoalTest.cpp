@@ -0,0 +1,101 @@
+#include "Data/AeonixData.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Algo/Reverse.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_NearestGoalTest,
+    "AeonixNavigation.Pathfinding.NearestGoal",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAeonixNavigation_NearestGoalTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Nearest Goal Pathfinding Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    // The goal straight across the wall is closer as the crow flies, but the one on the same side is closer to walk to
+    const FVector StartPos(-300, -200, 0);
+    const TArray<FVector> GoalPositions = { FVector(300, -200, 0), FVector(-300, 200, 0), FVector(300, 200, 0) };
+
+    AeonixLink StartLink;
+    FString LogMsg;
+    if (!TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, StartPos, StartLink, LogMsg)))
+    {
+        return false;
+    }
+
+    TArray<AeonixLink> GoalLinks;
+    for (const FVector& GoalPos : GoalPositions)
+    {
+        AeonixLink GoalLink;
+        if (!TestTrue(TEXT("Found valid goal navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, GoalPos, GoalLink, LogMsg)))
+        {
+            return false;
+        }
+        GoalLinks.Add(GoalLink);
+    }
+
+    FAeonixPathFinderSettings PathSettings;
+    PathSettings.MaxIterations = 10000;
+    PathSettings.bOptimizePath = false;
+    PathSettings.HeuristicSettings.EuclideanWeight = 1.0f;
+    PathSettings.HeuristicSettings.GlobalWeight = 1.0f;
+
+    // TEST 1: The search ends at the goal that is cheapest to reach
+    AeonixPathFinder PathFinder(NavData, PathSettings);
+    FAeonixNavigationPath Path;
+    int32 GoalIndex = INDEX_NONE;
+    const bool bPathFound = PathFinder.FindPathToNearestGoal(StartLink, GoalLinks, StartPos, GoalPositions, Path, GoalIndex);
+
+    TestTrue(TEXT("Nearest goal search should find a path"), bPathFound);
+    TestEqual(TEXT("Goal on the same side of the wall should be chosen"), GoalIndex, 1);
+
+    if (bPathFound && GoalPositions.IsValidIndex(GoalIndex))
+    {
+        const TArray<FAeonixPathPoint>& PathPoints = Path.GetPathPoints();
+        UE_LOG(LogTemp, Display, TEXT("Nearest goal path has %d points, %d iterations"), PathPoints.Num(), PathFinder.GetLastIterationCount());
+
+        TestTrue(TEXT("Path should start at the start position"), PathPoints.Num() > 0 && PathPoints[0].Position.Equals(StartPos));
+        TestTrue(TEXT("Path should end at the chosen goal position"), PathPoints.Num() > 0 && PathPoints.Last().Position.Equals(GoalPositions[GoalIndex]));
+    }
+
+    // TEST 2: Goal order doesn't change the answer
+    TArray<AeonixLink> ReversedLinks = GoalLinks;
+    TArray<FVector> ReversedPositions = GoalPositions;
+    Algo::Reverse(ReversedLinks);
+    Algo::Reverse(ReversedPositions);
+
+    FAeonixNavigationPath ReversedPath;
+    int32 ReversedIndex = INDEX_NONE;
+    TestTrue(TEXT("Reversed goal list should find a path"), PathFinder.FindPathToNearestGoal(StartLink, ReversedLinks, StartPos, ReversedPositions, ReversedPath, ReversedIndex));
+    TestEqual(TEXT("Reversed goal list should pick the same goal"), ReversedIndex, GoalLinks.Num() - 1 - GoalIndex);
+
+    // TEST 3: Mismatched inputs are rejected
+    FAeonixNavigationPath BadPath;
+    int32 BadIndex = 0;
+    TestFalse(TEXT("Mismatched goal positions should fail"), PathFinder.FindPathToNearestGoal(StartLink, GoalLinks, StartPos, TArray<FVector>(), BadPath, BadIndex));
+    TestEqual(TEXT("Failed search should not report a goal"), BadIndex, static_cast<int32>(INDEX_NONE));
+
+    return true;
+}
@@ -0,0 +1,125 @@
+#include "Data/AeonixData.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_NearestObstacleTest,
+    "AeonixNavigation.Pathfinding.NearestObstacle",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace
+{
+    // Distance from Position to the nearest blocked subnode anywhere in the volume
+    float GetBruteForceDistance(const FAeonixData& NavData, const FVector& Position)
+    {
+        const FAeonixOctreeData& OctreeData = NavData.OctreeData;
+        const float SubnodeSize = NavData.GetVoxelSize(0) * 0.25f;
+        const float HalfSize = NavData.GetVoxelSize(0) * 0.5f;
+        float Best = FLT_MAX;
+        for (const AeonixNode& Node : OctreeData.Layers[0])
+        {
+            if (!Node.HasChildren())
+            {
+                continue;
+            }
+
+            FVector NodePosition;
+            NavData.GetNodePosition(0, Node.Code, NodePosition);
+            const uint64 Grid = OctreeData.LeafNodes[Node.FirstChild.GetNodeIndex()].VoxelGrid;
+            for (int32 Subnode = 0; Subnode < 64; ++Subnode)
+            {
+                if (!(Grid & (1ULL << Subnode)))
+                {
+                    continue;
+                }
+                uint_fast32_t X = 0, Y = 0, Z = 0;
+                morton3D_64_decode(Subnode, X, Y, Z);
+                const FVector Min = NodePosition - FVector(HalfSize) + FVector(X, Y, Z) * SubnodeSize;
+                Best = FMath::Min(Best, FMath::Sqrt(FBox(Min, Min + FVector(SubnodeSize)).ComputeSquaredDistanceToPoint(Position)));
+            }
+        }
+        return Best;
+    }
+}
+
+bool FAeonixNavigation_NearestObstacleTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Nearest Obstacle Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    TArray<FVector> Positions;
+    for (float X = -450.f; X <= 450.f; X += 60.f)
+    {
+        for (float Y = -450.f; Y <= 450.f; Y += 60.f)
+        {
+            Positions.Add(FVector(X, Y, 17.f));
+        }
+    }
+
+    const float MaxDistance = 200.f;
+
+    // TEST 1: Batched results match a scan of every blocked subnode, with and without the clearance early out
+    for (const bool bBakeClearance : { false, true })
+    {
+        Params.bBakeClearance = bBakeClearance;
+        FAeonixData NavData;
+        NavData.UpdateGenerationParameters(Params);
+
+        UWorld* DummyWorld = nullptr;
+        NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+        TArray<FAeonixNearestObstacle> Obstacles;
+        NavData.FindNearestObstacles(Positions, MaxDistance, Obstacles);
+        if (!TestEqual(TEXT("One result per position"), Obstacles.Num(), Positions.Num()))
+        {
+            return false;
+        }
+
+        int32 Mismatched = 0;
+        int32 NumFound = 0;
+        for (int32 i = 0; i < Positions.Num(); ++i)
+        {
+            const float Expected = GetBruteForceDistance(NavData, Positions[i]);
+            const FAeonixNearestObstacle& Obstacle = Obstacles[i];
+            if (Expected > MaxDistance)
+            {
+                Mismatched += Obstacle.bFound ? 1 : 0;
+                continue;
+            }
+
+            NumFound++;
+            const bool bDistanceMatches = Obstacle.bFound && FMath::IsNearlyEqual(Obstacle.Distance, Expected, 0.01f);
+            const bool bLocationMatches = FMath::IsNearlyEqual(FVector::Dist(Positions[i], Obstacle.Location), Obstacle.Distance, 0.01f);
+            const bool bDirectionMatches = Obstacle.Distance <= KINDA_SMALL_NUMBER ? Obstacle.Direction.IsZero() : Obstacle.Direction.Equals((Obstacle.Location - Positions[i]).GetSafeNormal(), 0.001f);
+            Mismatched += bDistanceMatches && bLocationMatches && bDirectionMatches ? 0 : 1;
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("Clearance %s: %d of %d positions have an obstacle within %.0f"), bBakeClearance ? TEXT("baked") : TEXT("not baked"), NumFound, Positions.Num(), MaxDistance);
+        TestTrue(TEXT("Some positions should be near the walls and some clear of them"), NumFound > 0 && NumFound < Positions.Num());
+        TestEqual(TEXT("Nearest obstacles should match the brute force scan"), Mismatched, 0);
+
+        // TEST 2: The single query agrees with the batch
+        FAeonixNearestObstacle Single;
+        const FVector NearWall(-120.f, -200.f, 17.f);
+        if (TestTrue(TEXT("Position beside the wall should find it"), NavData.FindNearestObstacle(NearWall, MaxDistance, Single)))
+        {
+            TestTrue(TEXT("Obstacle should be towards the wall"), Single.Direction.X > 0.9f);
+            TestTrue(TEXT("Single query should match the scan"), FMath::IsNearlyEqual(Single.Distance, GetBruteForceDistance(NavData, NearWall), 0.01f));
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,131 @@
+#include "Data/AeonixData.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_PartialPathTest,
+    "AeonixNavigation.Pathfinding.PartialPath",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAeonixNavigation_PartialPathTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Partial Path Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    const FVector StartPos(-300, -200, 0);
+    const FVector TargetPos(300, -200, 0);
+
+    AeonixLink StartLink;
+    AeonixLink TargetLink;
+    FString LogMsg;
+    if (!TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, StartPos, StartLink, LogMsg)) ||
+        !TestTrue(TEXT("Found valid target navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, TargetPos, TargetLink, LogMsg)))
+    {
+        return false;
+    }
+
+    FAeonixPathFinderSettings PathSettings;
+    PathSettings.MaxIterations = 10000;
+
+    // How many iterations the whole search takes, so the limited ones below are sure to run out
+    int32 FullIterations = 0;
+    {
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        FAeonixNavigationPath FullPath;
+        if (!TestTrue(TEXT("Full search should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, FullPath)))
+        {
+            return false;
+        }
+        TestFalse(TEXT("Full path should not be partial"), FullPath.IsPartial());
+        FullIterations = PathFinder.GetLastIterationCount();
+    }
+
+    FAeonixPathFinderSettings LimitedSettings = PathSettings;
+    LimitedSettings.MaxIterations = FullIterations / 2;
+
+    // TEST 1: Without partial paths, running out of iterations is still a failure
+    {
+        AeonixPathFinder PathFinder(NavData, LimitedSettings);
+        FAeonixNavigationPath Path;
+        FAeonixPathFailureInfo FailureInfo;
+        TestFalse(TEXT("Limited search should fail without partial paths"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, Path, &FailureInfo));
+        TestTrue(TEXT("Failure should be reported as hitting the iteration limit"), FailureInfo.bFailedDueToMaxIterations);
+    }
+
+    LimitedSettings.bReturnPartialPath = true;
+
+    // TEST 2: With partial paths, the search gives back a path that gets the agent closer
+    {
+        AeonixPathFinder PathFinder(NavData, LimitedSettings);
+        FAeonixNavigationPath Path;
+        if (!TestTrue(TEXT("Limited search should return a partial path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, Path)))
+        {
+            return false;
+        }
+
+        TestTrue(TEXT("Path should be flagged partial"), Path.IsPartial());
+        TestTrue(TEXT("Partial path should have points"), Path.GetNumPoints() > 1);
+        if (Path.GetNumPoints() > 1)
+        {
+            TestTrue(TEXT("Partial path should start at the start position"), Path.GetPathPoints()[0].Position.Equals(StartPos));
+            TestFalse(TEXT("Partial path should stop short of the target"), Path.GetPathPoints().Last().Position.Equals(TargetPos));
+            TestTrue(TEXT("Partial path should end closer to the target than it started"),
+                FVector::Dist(Path.GetPathPoints().Last().Position, TargetPos) < FVector::Dist(StartPos, TargetPos));
+        }
+
+        Path.ResetForRepath();
+        TestFalse(TEXT("Resetting the path should clear the partial flag"), Path.IsPartial());
+    }
+
+    // TEST 3: Sliced searches report partial paths through their status
+    {
+        AeonixPathFinder PathFinder(NavData, LimitedSettings);
+        PathFinder.BeginPath(StartLink, { TargetLink }, StartPos, { TargetPos });
+
+        FAeonixNavigationPath Path;
+        EAeonixPathFindStatus Status = EAeonixPathFindStatus::InProgress;
+        for (int32 NumSlices = 0; Status == EAeonixPathFindStatus::InProgress && NumSlices < 10000; ++NumSlices)
+        {
+            Status = PathFinder.StepPath(16, Path);
+        }
+
+        TestTrue(TEXT("Sliced limited search should end partial"), Status == EAeonixPathFindStatus::Partial);
+        TestTrue(TEXT("Sliced partial path should be flagged partial"), Path.IsPartial());
+        TestEqual(TEXT("Partial path should not have reached a goal"), PathFinder.GetReachedGoalIndex(), static_cast<int32>(INDEX_NONE));
+    }
+
+    // TEST 4: A search with enough iterations is never partial, even with the setting on
+    {
+        FAeonixPathFinderSettings PartialSettings = PathSettings;
+        PartialSettings.bReturnPartialPath = true;
+
+        AeonixPathFinder PathFinder(NavData, PartialSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Unlimited search should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, Path));
+        TestFalse(TEXT("Unlimited search should not be partial"), Path.IsPartial());
+        TestTrue(TEXT("Unlimited search should reach the target"), Path.GetNumPoints() > 0 && Path.GetPathPoints().Last().Position.Equals(TargetPos));
+    }
+
+    return true;
+}
@@ -0,0 +1,94 @@
+#include "Pathfinding/AeonixPathCache.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_PathCacheTest,
+    "AeonixNavigation.Pathfinding.PathCache",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAeonixNavigation_PathCacheTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Path Cache Test ==="));
+
+    const FGuid RegionId = FGuid::NewGuid();
+    uint32 RegionVersion = 3;
+    auto GetRegionVersion = [&RegionVersion, RegionId](const FGuid& Id) { return Id == RegionId ? RegionVersion : 0u; };
+    // Stands in for geometry between the goal voxel's far side and the point before it
+    const FVector BlockedEnd(250, 0, 0);
+    auto IsSegmentClear = [&BlockedEnd](const FVector& SegmentStart, const FVector& SegmentEnd) { return !SegmentEnd.Equals(BlockedEnd) && !SegmentStart.Equals(BlockedEnd); };
+
+    FAeonixPathFinderSettings Settings;
+
+    FAeonixPathCacheKey Key;
+    Key.Start = AeonixLink(0, 10, 5);
+    Key.Goal = AeonixLink(2, 3, 0);
+    Key.SetSettings(Settings);
+
+    FAeonixNavigationPath Path;
+    Path.AddPoint(FAeonixPathPoint(FVector(0, 0, 0), 0));
+    Path.AddPoint(FAeonixPathPoint(FVector(100, 0, 0), 1));
+    Path.AddPoint(FAeonixPathPoint(FVector(200, 0, 0), 2));
+
+    FAeonixPathCache Cache;
+    Cache.SetCapacity(2);
+
+    TMap<FGuid, uint32> Versions;
+    Versions.Add(RegionId, RegionVersion);
+    Cache.Add(Key, 1, Path, MoveTemp(Versions));
+
+    // TEST 1: Hit copies the path and moves the end points
+    FAeonixNavigationPath OutPath;
+    TestTrue(TEXT("Identical request should hit"), Cache.Find(Key, 1, GetRegionVersion, IsSegmentClear, FVector(5, 5, 5), FVector(195, 5, 5), OutPath));
+    TestEqual(TEXT("Cached path should keep its point count"), OutPath.GetNumPoints(), 3);
+    if (OutPath.GetNumPoints() == 3)
+    {
+        TestTrue(TEXT("First point should move to the new start"), OutPath.GetPathPoints()[0].Position.Equals(FVector(5, 5, 5)));
+        TestTrue(TEXT("Middle point should be untouched"), OutPath.GetPathPoints()[1].Position.Equals(FVector(100, 0, 0)));
+        TestTrue(TEXT("Last point should move to the new end"), OutPath.GetPathPoints()[2].Position.Equals(FVector(195, 5, 5)));
+    }
+    TestTrue(TEXT("Cached path should track its regions"), OutPath.GetTraversedRegionIds().Contains(RegionId));
+
+    // TEST 2: Different settings miss
+    FAeonixPathFinderSettings OtherSettings;
+    OtherSettings.bUseStringPulling = !Settings.bUseStringPulling;
+    FAeonixPathCacheKey OtherKey = Key;
+    OtherKey.SetSettings(OtherSettings);
+    TestNotEqual(TEXT("Changing a setting should change the hash"), OtherKey.SettingsHash, Key.SettingsHash);
+    TestFalse(TEXT("Different settings should miss"), Cache.Find(OtherKey, 1, GetRegionVersion, IsSegmentClear, FVector::ZeroVector, FVector::ZeroVector, OutPath));
+
+    // TEST 3: Settings that happen to share a hash still miss, the settings themselves are compared
+    FAeonixPathCacheKey CollidingKey = OtherKey;
+    CollidingKey.SettingsHash = Key.SettingsHash;
+    TestFalse(TEXT("Different settings with the same hash should miss"), Cache.Find(CollidingKey, 1, GetRegionVersion, IsSegmentClear, FVector::ZeroVector, FVector::ZeroVector, OutPath));
+    TestEqual(TEXT("A hash collision shouldn't drop the entry"), Cache.Num(), 1);
+
+    // TEST 4: An end point moved where it can't see the rest of the path misses, though the entry still serves other positions
+    TestFalse(TEXT("Blocked end segment should miss"), Cache.Find(Key, 1, GetRegionVersion, IsSegmentClear, FVector(5, 5, 5), BlockedEnd, OutPath));
+    TestTrue(TEXT("Clear end segment should still hit"), Cache.Find(Key, 1, GetRegionVersion, IsSegmentClear, FVector(5, 5, 5), FVector(195, 5, 5), OutPath));
+
+    // TEST 5: A new volume generation drops the entry
+    TestFalse(TEXT("Regenerated volume should miss"), Cache.Find(Key, 2, GetRegionVersion, IsSegmentClear, FVector::ZeroVector, FVector::ZeroVector, OutPath));
+    TestEqual(TEXT("Stale entry should be removed"), Cache.Num(), 0);
+
+    // TEST 6: A regenerated region drops the entry
+    Versions.Add(RegionId, RegionVersion);
+    Cache.Add(Key, 1, Path, MoveTemp(Versions));
+    RegionVersion++;
+    TestFalse(TEXT("Regenerated region should miss"), Cache.Find(Key, 1, GetRegionVersion, IsSegmentClear, FVector::ZeroVector, FVector::ZeroVector, OutPath));
+
+    // TEST 7: Least recently used entry is evicted first
+    FAeonixPathCacheKey KeyB = Key;
+    KeyB.Goal = AeonixLink(2, 4, 0);
+    FAeonixPathCacheKey KeyC = Key;
+    KeyC.Goal = AeonixLink(2, 5, 0);
+    Cache.Add(Key, 1, Path, TMap<FGuid, uint32>());
+    Cache.Add(KeyB, 1, Path, TMap<FGuid, uint32>());
+    Cache.Find(Key, 1, GetRegionVersion, IsSegmentClear, FVector::ZeroVector, FVector::ZeroVector, OutPath);
+    Cache.Add(KeyC, 1, Path, TMap<FGuid, uint32>());
+    TestTrue(TEXT("Recently used entry should survive"), Cache.Find(Key, 1, GetRegionVersion, IsSegmentClear, FVector::ZeroVector, FVector::ZeroVector, OutPath));
+    TestFalse(TEXT("Least recently used entry should be evicted"), Cache.Find(KeyB, 1, GetRegionVersion, IsSegmentClear, FVector::ZeroVector, FVector::ZeroVector, OutPath));
+
+    return true;
+}
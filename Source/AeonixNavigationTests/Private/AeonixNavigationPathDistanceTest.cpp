@@ -0,0 +1,180 @@
+#include "Data/AeonixData.h"
+#include "Data/AeonixLink.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_PathDistanceTest,
+    "AeonixNavigation.Pathfinding.PathDistance",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace
+{
+    // Unbounded Dijkstra over the same neighbours and straight line costs the pathfinder uses, settling every reachable link
+    void ReferenceDistances(const FAeonixData& NavData, const AeonixLink& Start, TMap<AeonixLink, float>& OutDistances)
+    {
+        TMap<AeonixLink, float> Tentative;
+        Tentative.Add(Start, 0.f);
+        while (Tentative.Num() > 0)
+        {
+            TPair<AeonixLink, float> Best(AeonixLink(), FLT_MAX);
+            for (const TPair<AeonixLink, float>& Entry : Tentative)
+            {
+                if (Entry.Value < Best.Value)
+                {
+                    Best = Entry;
+                }
+            }
+            Tentative.Remove(Best.Key);
+            OutDistances.Add(Best.Key, Best.Value);
+
+            FVector Position;
+            NavData.GetLinkPosition(Best.Key, Position);
+
+            TArray<AeonixLink> Neighbours;
+            const AeonixNode& Node = NavData.OctreeData.GetNode(Best.Key);
+            if (Best.Key.GetLayerIndex() == 0 && Node.FirstChild.IsValid())
+            {
+                NavData.OctreeData.GetLeafNeighbours(Best.Key, Neighbours);
+            }
+            else
+            {
+                NavData.GetNeighbours(Best.Key, Neighbours);
+            }
+
+            for (const AeonixLink& Neighbour : Neighbours)
+            {
+                if (!Neighbour.IsValid() || OutDistances.Contains(Neighbour))
+                {
+                    continue;
+                }
+
+                FVector NeighbourPosition;
+                NavData.GetLinkPosition(Neighbour, NeighbourPosition);
+                const float Cost = Best.Value + FVector::Dist(Position, NeighbourPosition);
+                float& Known = Tentative.FindOrAdd(Neighbour, FLT_MAX);
+                Known = FMath::Min(Known, Cost);
+            }
+        }
+    }
+}
+
+bool FAeonixNavigation_PathDistanceTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Path Distance Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    AeonixLink StartLink;
+    FString LogMsg;
+    if (!TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, FVector(-100, -200, 0), StartLink, LogMsg)))
+    {
+        return false;
+    }
+
+    TMap<AeonixLink, float> Reference;
+    ReferenceDistances(NavData, StartLink, Reference);
+
+    TArray<AeonixLink> Targets;
+    Reference.GetKeys(Targets);
+    // A target that can never be settled
+    Targets.Add(AeonixLink::GetInvalidLink());
+
+    FAeonixPathFinderSettings PathSettings;
+    PathSettings.MaxIterations = 1000000;
+    AeonixPathFinder PathFinder(NavData, PathSettings);
+
+    // TEST 1: Every link within the bound gets its shortest path cost from one search, everything past it is unreachable
+    {
+        const float MaxDistance = 600.f;
+        TArray<float> Distances;
+        PathFinder.FindPathDistances(StartLink, MaxDistance, Targets, Distances);
+        if (!TestEqual(TEXT("One distance per target"), Distances.Num(), Targets.Num()))
+        {
+            return false;
+        }
+
+        int32 Mismatched = 0;
+        int32 NumInRange = 0;
+        for (int32 i = 0; i < Targets.Num() - 1; ++i)
+        {
+            const float Expected = Reference[Targets[i]];
+            if (Expected <= MaxDistance)
+            {
+                NumInRange++;
+                Mismatched += FMath::IsNearlyEqual(Distances[i], Expected, 0.1f) ? 0 : 1;
+            }
+            else
+            {
+                Mismatched += Distances[i] < 0.f ? 0 : 1;
+            }
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("%d of %d links within %.0f, %d iterations"), NumInRange, Targets.Num() - 1, MaxDistance, PathFinder.GetLastIterationCount());
+        TestTrue(TEXT("Some links should be in range"), NumInRange > 0 && NumInRange < Targets.Num() - 1);
+        TestEqual(TEXT("Distances should match the reference search"), Mismatched, 0);
+        TestEqual(TEXT("Invalid target should be unreachable"), Distances.Last(), -1.f);
+    }
+
+    // TEST 2: Once the targets are settled the search stops, rather than flooding out to the bound
+    {
+        TArray<float> Distances;
+        PathFinder.FindPathDistances(StartLink, 5000.f, TArray<AeonixLink>{ StartLink }, Distances);
+        TestEqual(TEXT("Start should be at distance 0"), Distances[0], 0.f);
+        TestEqual(TEXT("Start alone should take one iteration"), PathFinder.GetLastIterationCount(), 1);
+    }
+
+    // TEST 3: Across the wall the path is longer than the straight line
+    {
+        AeonixLink FarLink;
+        if (TestTrue(TEXT("Found link across the wall"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, FVector(100, -200, 0), FarLink, LogMsg)))
+        {
+            TArray<float> Distances;
+            PathFinder.FindPathDistances(StartLink, 5000.f, TArray<AeonixLink>{ FarLink }, Distances);
+
+            FVector StartPosition, FarPosition;
+            NavData.GetLinkPosition(StartLink, StartPosition);
+            NavData.GetLinkPosition(FarLink, FarPosition);
+            TestTrue(TEXT("Path round the wall should be longer than the straight line"), Distances[0] > FVector::Dist(StartPosition, FarPosition) + 50.f);
+        }
+    }
+
+    // TEST 4: The iteration cap for point to point searches doesn't cut the radius short
+    {
+        FAeonixPathFinderSettings CappedSettings;
+        CappedSettings.MaxIterations = 10;
+        AeonixPathFinder CappedFinder(NavData, CappedSettings);
+
+        TArray<float> Distances;
+        CappedFinder.FindPathDistances(StartLink, 600.f, Targets, Distances);
+
+        int32 Mismatched = 0;
+        for (int32 i = 0; i < Targets.Num() - 1; ++i)
+        {
+            const float Expected = Reference[Targets[i]];
+            Mismatched += Expected <= 600.f ? (FMath::IsNearlyEqual(Distances[i], Expected, 0.1f) ? 0 : 1) : (Distances[i] < 0.f ? 0 : 1);
+        }
+        TestTrue(TEXT("Search should run past MaxIterations"), CappedFinder.GetLastIterationCount() > CappedSettings.MaxIterations);
+        TestEqual(TEXT("Distances should match the reference search regardless of MaxIterations"), Mismatched, 0);
+    }
+
+    return true;
+}
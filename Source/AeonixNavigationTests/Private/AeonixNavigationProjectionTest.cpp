@@ -0,0 +1,149 @@
+#include "Data/AeonixData.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_ProjectionTest,
+    "AeonixNavigation.Pathfinding.Projection",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace
+{
+    FBox GetBounds(const FAeonixData& NavData, int32 Layer, mortoncode_t Code)
+    {
+        FVector Position;
+        NavData.GetNodePosition(Layer, Code, Position);
+        const FVector HalfSize(NavData.GetVoxelSize(Layer) * 0.5f);
+        return FBox(Position - HalfSize, Position + HalfSize);
+    }
+
+    // Distance from Position to the nearest free subnode or free node anywhere in the volume
+    float GetBruteForceDistance(const FAeonixData& NavData, const FVector& Position)
+    {
+        const FAeonixOctreeData& OctreeData = NavData.OctreeData;
+        const float SubnodeSize = NavData.GetVoxelSize(0) * 0.25f;
+        float Best = FLT_MAX;
+        for (int32 Layer = 0; Layer < OctreeData.Layers.Num(); ++Layer)
+        {
+            for (const AeonixNode& Node : OctreeData.Layers[Layer])
+            {
+                const FBox Bounds = GetBounds(NavData, Layer, Node.Code);
+                if (!Node.HasChildren())
+                {
+                    Best = FMath::Min(Best, FMath::Sqrt(Bounds.ComputeSquaredDistanceToPoint(Position)));
+                }
+                else if (Layer == 0)
+                {
+                    const uint64 Grid = OctreeData.LeafNodes[Node.FirstChild.GetNodeIndex()].VoxelGrid;
+                    for (int32 Subnode = 0; Subnode < 64; ++Subnode)
+                    {
+                        if (Grid & (1ULL << Subnode))
+                        {
+                            continue;
+                        }
+                        uint_fast32_t X = 0, Y = 0, Z = 0;
+                        morton3D_64_decode(Subnode, X, Y, Z);
+                        const FVector Min = Bounds.Min + FVector(X, Y, Z) * SubnodeSize;
+                        Best = FMath::Min(Best, FMath::Sqrt(FBox(Min, Min + FVector(SubnodeSize)).ComputeSquaredDistanceToPoint(Position)));
+                    }
+                }
+            }
+        }
+        return Best;
+    }
+
+    bool IsLinkFree(const FAeonixData& NavData, const AeonixLink& Link)
+    {
+        const AeonixNode& Node = NavData.OctreeData.GetNode(Link);
+        if (!Node.HasChildren())
+        {
+            return true;
+        }
+        return Link.GetLayerIndex() == 0 && !NavData.OctreeData.GetLeafNode(Node.FirstChild.GetNodeIndex()).GetNode(Link.GetSubnodeIndex());
+    }
+}
+
+bool FAeonixNavigation_ProjectionTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Navigation Projection Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    // TEST 1: A point inside the wall comes out at the nearest free space, and no further
+    const FVector InWall(0, -200, 0);
+    {
+        AeonixLink Link;
+        FVector Projected;
+        if (TestTrue(TEXT("Point in the wall should project"), NavData.FindNearestNavigablePosition(InWall, 200.f, Link, Projected)))
+        {
+            const float Expected = GetBruteForceDistance(NavData, InWall);
+            UE_LOG(LogTemp, Display, TEXT("Projected %s to %s, nearest free space is %.2f away"), *InWall.ToString(), *Projected.ToString(), Expected);
+
+            TestTrue(TEXT("Projected link should be free"), IsLinkFree(NavData, Link));
+            TestTrue(TEXT("Projected point should be outside the wall"), FMath::Abs(Projected.X) > 25.f);
+            TestTrue(TEXT("Projected point should be the nearest free space"), FMath::IsNearlyEqual(FVector::Dist(InWall, Projected), Expected, 0.5f));
+
+            FBox LinkBounds = GetBounds(NavData, Link.GetLayerIndex(), NavData.OctreeData.GetNode(Link).Code);
+            if (NavData.OctreeData.GetNode(Link).HasChildren())
+            {
+                const float SubnodeSize = NavData.GetVoxelSize(0) * 0.25f;
+                uint_fast32_t X = 0, Y = 0, Z = 0;
+                morton3D_64_decode(Link.GetSubnodeIndex(), X, Y, Z);
+                const FVector Min = LinkBounds.Min + FVector(X, Y, Z) * SubnodeSize;
+                LinkBounds = FBox(Min, Min + FVector(SubnodeSize));
+            }
+            TestTrue(TEXT("Projected point should lie in the projected link"), LinkBounds.IsInside(Projected));
+        }
+    }
+
+    // TEST 2: A free point stays where it is
+    {
+        const FVector Free(-300, -200, 0);
+        AeonixLink Link;
+        FVector Projected;
+        if (TestTrue(TEXT("Free point should project"), NavData.FindNearestNavigablePosition(Free, 200.f, Link, Projected)))
+        {
+            TestTrue(TEXT("Free point should not move"), Projected.Equals(Free, 0.1f));
+            TestTrue(TEXT("Free point's link should be free"), IsLinkFree(NavData, Link));
+        }
+    }
+
+    // TEST 3: Nothing free within the radius is a failure
+    {
+        AeonixLink Link;
+        FVector Projected;
+        TestFalse(TEXT("Point deep in the wall should not project a short way"), NavData.FindNearestNavigablePosition(InWall, 1.f, Link, Projected));
+    }
+
+    // TEST 4: A point just outside the volume comes in through its boundary
+    {
+        const FVector Outside(-520, -200, 0);
+        AeonixLink Link;
+        FVector Projected;
+        if (TestTrue(TEXT("Point just outside should project"), NavData.FindNearestNavigablePosition(Outside, 50.f, Link, Projected)))
+        {
+            TestTrue(TEXT("Projected point should be inside the volume"), FBox(Params.Origin - Params.Extents, Params.Origin + Params.Extents).IsInside(Projected));
+            TestTrue(TEXT("Projected point should be near the boundary"), FMath::IsNearlyEqual(Projected.X, -500.f, 0.5f));
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,174 @@
+#include "Data/AeonixData.h"
+#include "Data/AeonixFreeVolume.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_RandomPointTest,
+    "AeonixNavigation.Pathfinding.RandomPoint",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace
+{
+    // The free subnode or node the link refers to, or an invalid box if it's blocked
+    FBox GetFreeLinkBounds(const FAeonixData& NavData, const AeonixLink& Link)
+    {
+        const AeonixNode& Node = NavData.OctreeData.GetNode(Link);
+        FVector Position;
+        NavData.GetNodePosition(Link.GetLayerIndex(), Node.Code, Position);
+        const FVector HalfSize(NavData.GetVoxelSize(Link.GetLayerIndex()) * 0.5f);
+        if (!Node.HasChildren())
+        {
+            return FBox(Position - HalfSize, Position + HalfSize);
+        }
+
+        if (Link.GetLayerIndex() != 0 || NavData.OctreeData.GetLeafNode(Node.FirstChild.GetNodeIndex()).GetNode(Link.GetSubnodeIndex()))
+        {
+            return FBox(ForceInit);
+        }
+
+        const float SubnodeSize = NavData.GetVoxelSize(0) * 0.25f;
+        uint_fast32_t X = 0, Y = 0, Z = 0;
+        morton3D_64_decode(Link.GetSubnodeIndex(), X, Y, Z);
+        const FVector Min = Position - HalfSize + FVector(X, Y, Z) * SubnodeSize;
+        return FBox(Min, Min + FVector(SubnodeSize));
+    }
+}
+
+bool FAeonixNavigation_RandomPointTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Random Navigable Point Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    const FAeonixFreeVolume& FreeVolume = NavData.GetFreeVolume();
+    if (!TestTrue(TEXT("Free volume should be valid after generation"), FreeVolume.IsValid()))
+    {
+        return false;
+    }
+
+    // TEST 1: The totals count every free subnode once, and the components share them all
+    {
+        uint64 Expected = 0;
+        for (int32 Layer = 0; Layer < NavData.OctreeData.Layers.Num(); ++Layer)
+        {
+            for (const AeonixNode& Node : NavData.OctreeData.Layers[Layer])
+            {
+                if (!Node.HasChildren())
+                {
+                    Expected += 64ull << (3 * Layer);
+                }
+                else if (Layer == 0)
+                {
+                    Expected += 64 - FMath::CountBits(NavData.OctreeData.LeafNodes[Node.FirstChild.GetNodeIndex()].VoxelGrid);
+                }
+            }
+        }
+        TestEqual(TEXT("Total free subnodes should match a count of the octree"), FreeVolume.GetTotalSubnodes(), Expected);
+
+        uint64 ComponentTotal = 0;
+        for (int32 Component = 0; Component < NavData.GetConnectivity().GetNumComponents(); ++Component)
+        {
+            ComponentTotal += FreeVolume.GetComponentSubnodes(Component);
+        }
+        TestEqual(TEXT("Components should account for all the free subnodes"), ComponentTotal, Expected);
+    }
+
+    FRandomStream Random(1234);
+    const int32 NumSamples = 4000;
+
+    // TEST 2: Every point lies in the free voxel it's reported in, and the halves either side of the symmetric walls are hit equally often
+    {
+        int32 Misplaced = 0;
+        int32 NegativeY = 0;
+        for (int32 i = 0; i < NumSamples; ++i)
+        {
+            AeonixLink Link;
+            FVector Point;
+            if (!TestTrue(TEXT("Should draw a point"), NavData.GetRandomNavigablePoint(Random, Link, Point)))
+            {
+                return false;
+            }
+
+            const FBox Bounds = GetFreeLinkBounds(NavData, Link);
+            if (!Bounds.IsValid || !Bounds.ExpandBy(KINDA_SMALL_NUMBER).IsInside(Point))
+            {
+                Misplaced++;
+            }
+            NegativeY += Point.Y < 0.f ? 1 : 0;
+        }
+
+        const float Fraction = static_cast<float>(NegativeY) / NumSamples;
+        UE_LOG(LogTemp, Display, TEXT("%.3f of %d points below Y = 0"), Fraction, NumSamples);
+        TestEqual(TEXT("Every point should be in free space"), Misplaced, 0);
+        TestTrue(TEXT("Points should be spread evenly by volume"), FMath::Abs(Fraction - 0.5f) < 0.05f);
+    }
+
+    // TEST 3: Reachable points stay in the origin's component
+    {
+        AeonixLink Origin;
+        FString LogMsg;
+        if (TestTrue(TEXT("Found valid origin link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, FVector(-300, -200, 0), Origin, LogMsg)))
+        {
+            const int32 OriginComponent = NavData.GetConnectivity().GetComponent(NavData.OctreeData, Origin);
+            int32 Stray = 0;
+            for (int32 i = 0; i < 500; ++i)
+            {
+                AeonixLink Link;
+                FVector Point;
+                if (!NavData.GetRandomReachablePoint(Origin, Random, Link, Point) || NavData.GetConnectivity().GetComponent(NavData.OctreeData, Link) != OriginComponent)
+                {
+                    Stray++;
+                }
+            }
+            TestEqual(TEXT("Reachable points should share the origin's component"), Stray, 0);
+        }
+    }
+
+    // TEST 4: Box restricted points stay in the box and in free space, even where the box cuts the wall
+    {
+        const FBox Box(FVector(-100, -250, -100), FVector(100, -150, 100));
+        int32 Misplaced = 0;
+        for (int32 i = 0; i < 500; ++i)
+        {
+            AeonixLink Link;
+            FVector Point;
+            if (!TestTrue(TEXT("Should draw a point in the box"), NavData.GetRandomNavigablePointInBox(Box, Random, Link, Point)))
+            {
+                return false;
+            }
+
+            const FBox Bounds = GetFreeLinkBounds(NavData, Link);
+            if (!Box.IsInsideOrOn(Point) || !Bounds.IsValid || !Bounds.ExpandBy(KINDA_SMALL_NUMBER).IsInside(Point))
+            {
+                Misplaced++;
+            }
+        }
+        TestEqual(TEXT("Box points should be free and inside the box"), Misplaced, 0);
+
+        AeonixLink Link;
+        FVector Point;
+        TestFalse(TEXT("A box outside the volume should draw nothing"), NavData.GetRandomNavigablePointInBox(FBox(FVector(900), FVector(1000)), Random, Link, Point));
+    }
+
+    return true;
+}
@@ -0,0 +1,109 @@
+#include "Data/AeonixData.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_RaycastTest,
+    "AeonixNavigation.Pathfinding.Raycast",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAeonixNavigation_RaycastTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Navigation Raycast Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    const float SubnodeSize = NavData.GetVoxelSize(0) * 0.25f;
+
+    // TEST 1: A segment through the wall hits it on the near side
+    const FVector LeftOfWall(-300, -200, 0);
+    const FVector RightOfWall(300, -200, 0);
+    FAeonixNavRaycastHit Hit;
+    if (TestTrue(TEXT("Segment through the wall should hit"), NavData.RaycastNav(LeftOfWall, RightOfWall, Hit)))
+    {
+        TestTrue(TEXT("Hit should be on the near side of the wall"), Hit.Location.X < 0.f && Hit.Location.X > LeftOfWall.X);
+        TestTrue(TEXT("Hit location should be at the hit time along the segment"), Hit.Location.Equals(FMath::Lerp(LeftOfWall, RightOfWall, Hit.Time), 0.1f));
+        TestFalse(TEXT("Segment through the wall should not be clear"), NavData.IsSegmentClear(LeftOfWall, RightOfWall));
+
+        // Everything short of the hit is clear, so the hit really is the first blocked subnode
+        const FVector JustBefore = FMath::Lerp(LeftOfWall, RightOfWall, FMath::Max(Hit.Time - SubnodeSize * 0.25f / FVector::Dist(LeftOfWall, RightOfWall), 0.f));
+        TestTrue(TEXT("Segment up to the hit should be clear"), NavData.IsSegmentClear(LeftOfWall, JustBefore));
+    }
+
+    // TEST 2: The same segment the other way round hits the far side
+    FAeonixNavRaycastHit ReverseHit;
+    if (TestTrue(TEXT("Reversed segment should hit"), NavData.RaycastNav(RightOfWall, LeftOfWall, ReverseHit)))
+    {
+        TestTrue(TEXT("Reversed hit should be on the other side of the wall"), ReverseHit.Location.X > 0.f);
+    }
+
+    // TEST 3: A segment in open space misses
+    const FVector OpenStart(-400, -200, 0);
+    const FVector OpenEnd(-300, 300, 100);
+    FAeonixNavRaycastHit Miss;
+    TestFalse(TEXT("Segment in open space should not hit"), NavData.RaycastNav(OpenStart, OpenEnd, Miss));
+    TestEqual(TEXT("Miss should report the whole segment"), Miss.Time, 1.f);
+    TestTrue(TEXT("Segment in open space should be clear"), NavData.IsSegmentClear(OpenStart, OpenEnd));
+
+    // TEST 4: Leaving the volume is a hit at the boundary
+    {
+        const FVector InsideStart(-400, 300, 0);
+        const FVector OutsideEnd(-900, 300, 0);
+        FAeonixNavRaycastHit BoundaryHit;
+        TestTrue(TEXT("Segment leaving the volume should hit"), NavData.RaycastNav(InsideStart, OutsideEnd, BoundaryHit));
+        TestTrue(TEXT("Boundary hit should be where the segment leaves"), FMath::IsNearlyEqual(BoundaryHit.Location.X, -500.f, 0.1f));
+        TestFalse(TEXT("Segment leaving the volume should not be clear"), NavData.IsSegmentClear(InsideStart, OutsideEnd));
+
+        FAeonixNavRaycastHit OutsideHit;
+        TestTrue(TEXT("Segment starting outside should hit"), NavData.RaycastNav(OutsideEnd, InsideStart, OutsideHit));
+        TestEqual(TEXT("Segment starting outside should hit at its start"), OutsideHit.Time, 0.f);
+    }
+
+    // TEST 5: Batches give the same answers as single queries
+    {
+        const TArray<TPair<FVector, FVector>> Segments = {
+            { LeftOfWall, RightOfWall },
+            { RightOfWall, LeftOfWall },
+            { OpenStart, OpenEnd },
+            { FVector(-300, 200, 100), FVector(300, 250, -100) },
+            { FVector(200, 0, 0), FVector(400, 100, 50) },
+        };
+
+        TArray<bool> Clear;
+        TArray<FAeonixNavRaycastHit> Hits;
+        NavData.IsSegmentClearBatch(Segments, Clear);
+        NavData.RaycastNavBatch(Segments, Hits);
+
+        if (TestEqual(TEXT("Batch should answer every segment"), Clear.Num(), Segments.Num()) && TestEqual(TEXT("Batch should hit test every segment"), Hits.Num(), Segments.Num()))
+        {
+            for (int32 i = 0; i < Segments.Num(); ++i)
+            {
+                FAeonixNavRaycastHit SingleHit;
+                const bool bSingleHit = NavData.RaycastNav(Segments[i].Key, Segments[i].Value, SingleHit);
+                TestEqual(FString::Printf(TEXT("Batch clear %d should match a single query"), i), Clear[i], NavData.IsSegmentClear(Segments[i].Key, Segments[i].Value));
+                TestEqual(FString::Printf(TEXT("Batch hit %d should match a single query"), i), Hits[i].bBlockingHit, bSingleHit);
+                TestEqual(FString::Printf(TEXT("Batch hit time %d should match a single query"), i), Hits[i].Time, SingleHit.Time);
+                TestEqual(FString::Printf(TEXT("Segment %d should be clear exactly when it doesn't hit"), i), Clear[i], !Hits[i].bBlockingHit);
+            }
+        }
+    }
+
+    return true;
+}
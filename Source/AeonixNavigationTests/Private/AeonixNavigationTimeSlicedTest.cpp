@@ -0,0 +1,149 @@
+#include "Data/AeonixData.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_TimeSlicedTest,
+    "AeonixNavigation.Pathfinding.TimeSliced",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAeonixNavigation_TimeSlicedTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Time Sliced Pathfinding Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    const FVector StartPos(-300, -200, 0);
+    const FVector TargetPos(300, -200, 0);
+
+    AeonixLink StartLink;
+    AeonixLink TargetLink;
+    FString LogMsg;
+    if (!TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, StartPos, StartLink, LogMsg)) ||
+        !TestTrue(TEXT("Found valid target navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, TargetPos, TargetLink, LogMsg)))
+    {
+        return false;
+    }
+
+    FAeonixPathFinderSettings PathSettings;
+    PathSettings.MaxIterations = 10000;
+
+    // Reference path, searched in one go
+    FAeonixNavigationPath FullPath;
+    int32 FullIterations = 0;
+    {
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        if (!TestTrue(TEXT("Full search should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, FullPath)))
+        {
+            return false;
+        }
+        FullIterations = PathFinder.GetLastIterationCount();
+    }
+
+    // TEST 1: Small slices need several calls and end up with the same path
+    {
+        const int32 SliceBudget = 8;
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        PathFinder.BeginPath(StartLink, { TargetLink }, StartPos, { TargetPos });
+
+        FAeonixNavigationPath SlicedPath;
+        EAeonixPathFindStatus Status = EAeonixPathFindStatus::InProgress;
+        int32 NumSlices = 0;
+        int32 PreviousIterations = 0;
+        while (Status == EAeonixPathFindStatus::InProgress && NumSlices < 10000)
+        {
+            Status = PathFinder.StepPath(SliceBudget, SlicedPath);
+            NumSlices++;
+
+            TestTrue(TEXT("A slice should not run past its budget"), PathFinder.GetLastIterationCount() - PreviousIterations <= SliceBudget);
+            PreviousIterations = PathFinder.GetLastIterationCount();
+        }
+
+        TestTrue(TEXT("Sliced search should complete"), Status == EAeonixPathFindStatus::Complete);
+        TestTrue(TEXT("Sliced search should take more than one slice"), NumSlices > 1);
+        TestEqual(TEXT("Sliced search should take as many iterations as the full search"), PathFinder.GetLastIterationCount(), FullIterations);
+        TestEqual(TEXT("Sliced search should reach the only goal"), PathFinder.GetReachedGoalIndex(), 0);
+
+        if (TestEqual(TEXT("Sliced path should have as many points as the full path"), SlicedPath.GetNumPoints(), FullPath.GetNumPoints()))
+        {
+            for (int32 i = 0; i < SlicedPath.GetNumPoints(); ++i)
+            {
+                TestTrue(FString::Printf(TEXT("Sliced path point %d should match the full path"), i), SlicedPath.GetPathPoints()[i].Position.Equals(FullPath.GetPathPoints()[i].Position));
+            }
+        }
+    }
+
+    // TEST 2: MaxIterations still bounds the search as a whole, however it is sliced
+    {
+        FAeonixPathFinderSettings LimitedSettings = PathSettings;
+        LimitedSettings.MaxIterations = FullIterations / 2;
+
+        AeonixPathFinder PathFinder(NavData, LimitedSettings);
+        PathFinder.BeginPath(StartLink, { TargetLink }, StartPos, { TargetPos });
+
+        FAeonixNavigationPath SlicedPath;
+        FAeonixPathFailureInfo FailureInfo;
+        EAeonixPathFindStatus Status = EAeonixPathFindStatus::InProgress;
+        for (int32 NumSlices = 0; Status == EAeonixPathFindStatus::InProgress && NumSlices < 10000; ++NumSlices)
+        {
+            Status = PathFinder.StepPath(4, SlicedPath, &FailureInfo);
+        }
+
+        TestTrue(TEXT("Sliced search over the iteration limit should fail"), Status == EAeonixPathFindStatus::Failed);
+        TestTrue(TEXT("Failure should be reported as hitting the iteration limit"), FailureInfo.bFailedDueToMaxIterations);
+    }
+
+    // TEST 3: A search cut short reports which leaves it has reached, and can still hand back a partial path
+    {
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        PathFinder.BeginPath(StartLink, { TargetLink }, StartPos, { TargetPos });
+
+        FAeonixNavigationPath SlicedPath;
+        TestTrue(TEXT("A couple of small slices should leave the search running"),
+            PathFinder.StepPath(8, SlicedPath) == EAeonixPathFindStatus::InProgress && PathFinder.StepPath(8, SlicedPath) == EAeonixPathFindStatus::InProgress);
+
+        TestFalse(TEXT("No changed leaves can't have been reached"), PathFinder.HasSearchReachedLeaves(TSet<nodeindex_t>()));
+        if (StartLink.GetLayerIndex() == 0)
+        {
+            TestTrue(TEXT("The start's own leaf has been reached"), PathFinder.HasSearchReachedLeaves(TSet<nodeindex_t>({ StartLink.GetNodeIndex() })));
+        }
+
+        FAeonixNavigationPath PartialPath;
+        const EAeonixPathFindStatus Status = PathFinder.EndPathPartial(TSet<nodeindex_t>(), PartialPath);
+        TestTrue(TEXT("Ending early should give a partial path"), Status == EAeonixPathFindStatus::Partial);
+        TestTrue(TEXT("Path ended early should be flagged partial"), PartialPath.IsPartial());
+        TestTrue(TEXT("Partial path should start at the start position"), PartialPath.GetNumPoints() > 0 && PartialPath.GetPathPoints()[0].Position.Equals(StartPos));
+        TestEqual(TEXT("Partial path reaches none of the goals"), PathFinder.GetReachedGoalIndex(), (int32)INDEX_NONE);
+    }
+
+    // TEST 4: A search with no goals fails rather than running
+    {
+        AeonixPathFinder PathFinder(NavData, PathSettings);
+        PathFinder.BeginPath(StartLink, {}, StartPos, {});
+
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Search without goals should fail"), PathFinder.StepPath(100, Path) == EAeonixPathFindStatus::Failed);
+    }
+
+    return true;
+}
@@ -0,0 +1,172 @@
+#include "Data/AeonixData.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_VectorizedExpansionTest,
+    "AeonixNavigation.Pathfinding.VectorizedExpansion",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace
+{
+    float GetPathLength(const FAeonixNavigationPath& Path)
+    {
+        float Length = 0.f;
+        const TArray<FAeonixPathPoint>& Points = Path.GetPathPoints();
+        for (int32 i = 1; i < Points.Num(); ++i)
+        {
+            Length += FVector::Dist(Points[i - 1].Position, Points[i].Position);
+        }
+        return Length;
+    }
+}
+
+bool FAeonixNavigation_VectorizedExpansionTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Vectorized Neighbour Expansion Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    const FVector StartPos(-300, -200, 0);
+    const FVector TargetPos(300, -200, 0);
+
+    AeonixLink StartLink;
+    AeonixLink TargetLink;
+    FString LogMsg;
+    if (!TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, StartPos, StartLink, LogMsg)) ||
+        !TestTrue(TEXT("Found valid target navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, TargetPos, TargetLink, LogMsg)))
+    {
+        return false;
+    }
+
+    auto RunBoth = [&](const FString& Name, FAeonixPathFinderSettings PathSettings, FAeonixNavigationPath& OutScalarPath, FAeonixNavigationPath& OutVectorPath) -> bool
+    {
+        PathSettings.MaxIterations = 20000;
+
+        PathSettings.bVectorizeNeighbourExpansion = false;
+        AeonixPathFinder ScalarPathFinder(NavData, PathSettings);
+        const bool bScalarFound = ScalarPathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, OutScalarPath);
+
+        FAeonixPathFinderSettings VectorSettings = PathSettings;
+        VectorSettings.bVectorizeNeighbourExpansion = true;
+        AeonixPathFinder VectorPathFinder(NavData, VectorSettings);
+        const bool bVectorFound = VectorPathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, OutVectorPath);
+
+        TestTrue(FString::Printf(TEXT("%s: scalar search should find a path"), *Name), bScalarFound);
+        TestTrue(FString::Printf(TEXT("%s: vectorized search should find a path"), *Name), bVectorFound);
+
+        UE_LOG(LogTemp, Display, TEXT("%s: scalar %d iterations, vectorized %d iterations"), *Name, ScalarPathFinder.GetLastIterationCount(), VectorPathFinder.GetLastIterationCount());
+        return bScalarFound && bVectorFound;
+    };
+
+    // TEST 1: Optimal search over raw node positions finds a path of the same length either way
+    {
+        FAeonixPathFinderSettings PathSettings;
+        PathSettings.HeuristicSettings.NodeSizeWeight = 0.f;
+        PathSettings.HeuristicSettings.GlobalWeight = 1.f;
+        PathSettings.bOptimizePath = false;
+        PathSettings.bUseStringPulling = false;
+        PathSettings.bSmoothPositions = false;
+
+        FAeonixNavigationPath ScalarPath;
+        FAeonixNavigationPath VectorPath;
+        if (RunBoth(TEXT("Optimal"), PathSettings, ScalarPath, VectorPath))
+        {
+            TestTrue(TEXT("Optimal path lengths should match"), FMath::IsNearlyEqual(GetPathLength(ScalarPath), GetPathLength(VectorPath), 1.f));
+        }
+    }
+
+    // TEST 2: The default weighted heuristic, with the node size weight, reaches the target either way
+    {
+        FAeonixNavigationPath ScalarPath;
+        FAeonixNavigationPath VectorPath;
+        if (RunBoth(TEXT("Default"), FAeonixPathFinderSettings(), ScalarPath, VectorPath))
+        {
+            TestTrue(TEXT("Vectorized path should reach the target"), VectorPath.GetNumPoints() > 0 && VectorPath.GetPathPoints().Last().Position.Equals(TargetPos));
+            TestTrue(TEXT("Default path lengths should be close"), FMath::Abs(GetPathLength(ScalarPath) - GetPathLength(VectorPath)) <= GetPathLength(ScalarPath) * 0.1f);
+        }
+    }
+
+    // TEST 3: Velocity and unit cost heuristics are scored the same way in lanes
+    {
+        FAeonixPathFinderSettings VelocitySettings;
+        VelocitySettings.HeuristicSettings.VelocityWeight = 1.f;
+
+        FAeonixNavigationPath ScalarPath;
+        FAeonixNavigationPath VectorPath;
+        if (RunBoth(TEXT("Velocity"), VelocitySettings, ScalarPath, VectorPath))
+        {
+            TestTrue(TEXT("Velocity path should reach the target"), VectorPath.GetNumPoints() > 0 && VectorPath.GetPathPoints().Last().Position.Equals(TargetPos));
+        }
+
+        FAeonixPathFinderSettings UnitCostSettings;
+        UnitCostSettings.bUseUnitCost = true;
+
+        ScalarPath.ResetForRepath();
+        VectorPath.ResetForRepath();
+        if (RunBoth(TEXT("UnitCost"), UnitCostSettings, ScalarPath, VectorPath))
+        {
+            TestTrue(TEXT("Unit cost path should reach the target"), VectorPath.GetNumPoints() > 0 && VectorPath.GetPathPoints().Last().Position.Equals(TargetPos));
+        }
+    }
+
+    // TEST 4: Several goals still end at the nearest
+    {
+        const TArray<FVector> GoalPositions{ FVector(300, -200, 0), FVector(-300, 200, 0) };
+        TArray<AeonixLink> GoalLinks;
+        for (const FVector& GoalPosition : GoalPositions)
+        {
+            AeonixLink GoalLink;
+            if (!TestTrue(TEXT("Found valid goal navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, GoalPosition, GoalLink, LogMsg)))
+            {
+                return false;
+            }
+            GoalLinks.Add(GoalLink);
+        }
+
+        FAeonixPathFinderSettings PathSettings;
+        PathSettings.MaxIterations = 20000;
+
+        int32 ScalarGoal = INDEX_NONE;
+        int32 VectorGoal = INDEX_NONE;
+        FAeonixNavigationPath ScalarPath;
+        FAeonixNavigationPath VectorPath;
+
+        PathSettings.bVectorizeNeighbourExpansion = false;
+        {
+            AeonixPathFinder PathFinder(NavData, PathSettings);
+            TestTrue(TEXT("Scalar nearest goal search should find a path"), PathFinder.FindPathToNearestGoal(StartLink, GoalLinks, StartPos, GoalPositions, ScalarPath, ScalarGoal));
+        }
+
+        FAeonixPathFinderSettings VectorSettings = PathSettings;
+        VectorSettings.bVectorizeNeighbourExpansion = true;
+        {
+            AeonixPathFinder PathFinder(NavData, VectorSettings);
+            TestTrue(TEXT("Vectorized nearest goal search should find a path"), PathFinder.FindPathToNearestGoal(StartLink, GoalLinks, StartPos, GoalPositions, VectorPath, VectorGoal));
+        }
+
+        TestEqual(TEXT("Both searches should reach the same goal"), VectorGoal, ScalarGoal);
+    }
+
+    return true;
+}
@@ -0,0 +1,130 @@
+#include "Data/AeonixData.h"
+#include "Data/AeonixLink.h"
+#include "Data/AeonixVisibilityField.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_VisibilityFieldTest,
+    "AeonixNavigation.Pathfinding.VisibilityField",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAeonixNavigation_VisibilityFieldTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Visibility Field Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    // Off the voxel grid, so no line of sight runs exactly along the edge of a voxel
+    const FVector Target(-301.3f, -197.7f, 3.1f);
+    const float Radius = 450.f;
+    const TSharedPtr<FAeonixVisibilityField> Field = MakeShared<FAeonixVisibilityField>();
+    Field->Build(NavData, Target, Radius);
+
+    if (!TestTrue(TEXT("Field should be valid"), Field->IsValid() && Field->Num() > 0))
+    {
+        return false;
+    }
+
+    // TEST 1: Every voxel in the field agrees with a trace through the octree, and the wall hides what's behind it
+    {
+        int32 Mismatched = 0;
+        int32 HiddenBehindWall = 0;
+        int32 NumVisible = 0;
+        for (int32 i = 0; i < Field->Num(); ++i)
+        {
+            const FVector& Position = Field->GetPosition(i);
+            Mismatched += FVector::Dist(Position, Target) <= Radius ? 0 : 1;
+            Mismatched += Field->IsVisible(i) == NavData.IsSegmentClear(Target, Position) ? 0 : 1;
+            Mismatched += Field->GetLinkVisibility(Field->GetLink(i)) == (Field->IsVisible(i) ? EAeonixVisibility::Visible : EAeonixVisibility::Hidden) ? 0 : 1;
+
+            NumVisible += Field->IsVisible(i) ? 1 : 0;
+            if (!Field->IsVisible(i) && Position.X > 25.f && Position.Y < -100.f)
+            {
+                HiddenBehindWall++;
+            }
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("%d voxels in the field, %d visible"), Field->Num(), NumVisible);
+        TestEqual(TEXT("Field should match per voxel traces"), Mismatched, 0);
+        TestEqual(TEXT("Visible count should match"), Field->GetNumVisible(), NumVisible);
+        TestTrue(TEXT("Some voxels should be visible"), NumVisible > 0);
+        TestTrue(TEXT("Voxels behind the wall should be hidden"), HiddenBehindWall > 0);
+
+        AeonixLink FarLink;
+        FString LogMsg;
+        if (FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, FVector(400, 400, 400), FarLink, LogMsg))
+        {
+            TestTrue(TEXT("Voxel beyond the radius should be unknown"), Field->GetLinkVisibility(FarLink) == EAeonixVisibility::Unknown);
+        }
+    }
+
+    // TEST 2: Weighting visible voxels makes the same search cost more
+    {
+        AeonixLink StartLink;
+        FString LogMsg;
+        if (TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, FVector(-100, -200, 0), StartLink, LogMsg)))
+        {
+            int32 VisibleIndex = INDEX_NONE;
+            for (int32 i = 0; i < Field->Num() && VisibleIndex == INDEX_NONE; ++i)
+            {
+                if (Field->IsVisible(i) && FVector::Dist(Field->GetPosition(i), Target) < 100.f)
+                {
+                    VisibleIndex = i;
+                }
+            }
+
+            if (TestTrue(TEXT("Found a visible voxel near the target"), VisibleIndex != INDEX_NONE))
+            {
+                const TArray<AeonixLink> Targets = { Field->GetLink(VisibleIndex) };
+
+                FAeonixPathFinderSettings PlainSettings;
+                PlainSettings.MaxIterations = 100000;
+                AeonixPathFinder PlainFinder(NavData, PlainSettings);
+                TArray<float> PlainDistances;
+                PlainFinder.FindPathDistances(StartLink, 5000.f, Targets, PlainDistances);
+
+                FAeonixPathFinderSettings WeightedSettings = PlainSettings;
+                WeightedSettings.VisibleCostMultiplier = 4.f;
+                WeightedSettings.VisibilityField = Field;
+                AeonixPathFinder WeightedFinder(NavData, WeightedSettings);
+                TArray<float> WeightedDistances;
+                WeightedFinder.FindPathDistances(StartLink, 5000.f, Targets, WeightedDistances);
+
+                UE_LOG(LogTemp, Display, TEXT("Path cost %.1f plain, %.1f weighted"), PlainDistances[0], WeightedDistances[0]);
+                TestTrue(TEXT("Visible voxel should be reachable"), PlainDistances[0] > 0.f);
+                TestTrue(TEXT("Weighted cost should be higher through visible voxels"), WeightedDistances[0] > PlainDistances[0]);
+
+                // A regen that rewrites leaves can open or close lines of sight, so the field no longer applies
+                TestTrue(TEXT("Field should be current before any regen"), Field->IsCurrent(NavData));
+                NavData.RecordLeafChanges(TArray<nodeindex_t>{ 0 });
+                TestFalse(TEXT("Field should be stale once leaves change"), Field->IsCurrent(NavData));
+
+                AeonixPathFinder StaleFinder(NavData, WeightedSettings);
+                TArray<float> StaleDistances;
+                StaleFinder.FindPathDistances(StartLink, 5000.f, Targets, StaleDistances);
+                TestEqual(TEXT("A stale field should not weight the search"), StaleDistances[0], PlainDistances[0]);
+            }
+        }
+    }
+
+    return true;
+}
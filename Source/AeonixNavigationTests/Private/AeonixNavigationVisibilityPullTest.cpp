@@ -0,0 +1,151 @@
+#include "Data/AeonixData.h"
+#include "Pathfinding/AeonixPathFinder.h"
+#include "Pathfinding/AeonixNavigationPath.h"
+#include "Data/AeonixLink.h"
+#include "Engine/World.h"
+#include "Engine/EngineTypes.h"
+#include "Misc/AutomationTest.h"
+#include "../Public/AeonixNavigationTestMocks.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeonixNavigation_VisibilityPullTest,
+    "AeonixNavigation.Pathfinding.VisibilityStringPulling",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace
+{
+    float GetPathLength(const TArray<FAeonixPathPoint>& Points)
+    {
+        float Length = 0.f;
+        for (int32 i = 1; i < Points.Num(); ++i)
+        {
+            Length += FVector::Dist(Points[i - 1].Position, Points[i].Position);
+        }
+        return Length;
+    }
+}
+
+bool FAeonixNavigation_VisibilityPullTest::RunTest(const FString& Parameters)
+{
+    UE_LOG(LogTemp, Display, TEXT("=== Visibility String Pulling Test ==="));
+
+    FTestPartialObstacleCollisionQueryInterface ObstacleCollision;
+    FTestDebugDrawInterface DebugDraw;
+    FAeonixData NavData;
+
+    FAeonixGenerationParameters Params;
+    Params.Origin = FVector::ZeroVector;
+    Params.Extents = FVector(500, 500, 500);
+    Params.OctreeDepth = 4;
+    Params.CollisionChannel = ECollisionChannel::ECC_WorldStatic;
+    Params.AgentRadius = 34.f;
+    Params.ShowLeafVoxels = false;
+    Params.ShowMortonCodes = false;
+
+    NavData.UpdateGenerationParameters(Params);
+
+    UWorld* DummyWorld = nullptr;
+    NavData.Generate(*DummyWorld, ObstacleCollision, DebugDraw);
+
+    const FVector StartPos(-300, -200, 0);
+    const FVector TargetPos(300, -200, 0);
+
+    AeonixLink StartLink;
+    AeonixLink TargetLink;
+    FString LogMsg;
+    if (!TestTrue(TEXT("Found valid start navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, StartPos, StartLink, LogMsg)) ||
+        !TestTrue(TEXT("Found valid target navigation link"), FAeonixNavigationTestUtils::FindLinkAtPosition(NavData, TargetPos, TargetLink, LogMsg)))
+    {
+        return false;
+    }
+
+    // Raw node positions, exactly what the pulling pass starts from
+    FAeonixPathFinderSettings RawSettings;
+    RawSettings.MaxIterations = 20000;
+    RawSettings.bOptimizePath = false;
+    RawSettings.bUseStringPulling = false;
+    RawSettings.bSmoothPositions = false;
+
+    FAeonixNavigationPath RawPath;
+    {
+        AeonixPathFinder PathFinder(NavData, RawSettings);
+        if (!TestTrue(TEXT("Raw search should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, RawPath)))
+        {
+            return false;
+        }
+    }
+
+    FAeonixPathFinderSettings PullSettings = RawSettings;
+    PullSettings.bUseStringPulling = true;
+    PullSettings.bUseVisibilityStringPulling = true;
+    PullSettings.bSmoothPositions = true;
+
+    FAeonixNavigationPath PulledPath;
+    int32 VisibilityTests = 0;
+    {
+        AeonixPathFinder PathFinder(NavData, PullSettings);
+        if (!TestTrue(TEXT("Pulled search should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, PulledPath)))
+        {
+            return false;
+        }
+        VisibilityTests = PathFinder.GetLastVisibilityTestCount();
+    }
+
+    const TArray<FAeonixPathPoint>& RawPoints = RawPath.GetPathPoints();
+    const TArray<FAeonixPathPoint>& PulledPoints = PulledPath.GetPathPoints();
+    UE_LOG(LogTemp, Display, TEXT("Raw path %d points, pulled path %d points, %d visibility tests"), RawPoints.Num(), PulledPoints.Num(), VisibilityTests);
+
+    // TEST 1: The pulled path has fewer points than the raw path, and is no longer
+    TestTrue(TEXT("Pulled path should have fewer points"), PulledPoints.Num() < RawPoints.Num());
+    TestTrue(TEXT("Pulled path should start at the start"), PulledPoints.Num() > 0 && PulledPoints[0].Position.Equals(StartPos));
+    TestTrue(TEXT("Pulled path should end at the target"), PulledPoints.Num() > 0 && PulledPoints.Last().Position.Equals(TargetPos));
+    TestTrue(TEXT("Pulled path should be no longer than the raw path"), GetPathLength(PulledPoints) <= GetPathLength(RawPoints) + KINDA_SMALL_NUMBER);
+
+    // TEST 2: Every segment of the pulled path is clear, none are taken on trust
+    for (int32 i = 1; i < PulledPoints.Num(); ++i)
+    {
+        TestTrue(FString::Printf(TEXT("Segment %d should be clear"), i), NavData.IsSegmentClear(PulledPoints[i - 1].Position, PulledPoints[i].Position));
+    }
+
+    // TEST 3: Each kept point costs the test of the last point and a binary search. The pull also steps through the goal's parent, which the raw path
+    // drops, and both end voxels' centres
+    {
+        const int32 TestsPerPoint = FMath::CeilLogTwo(RawPoints.Num() + 3) + 1;
+        TestTrue(TEXT("Visibility tests should be bounded by n log n"), VisibilityTests <= (PulledPoints.Num() - 1) * TestsPerPoint);
+    }
+
+    // TEST 4: Off by default, the threshold pulling runs and tests nothing
+    {
+        FAeonixPathFinderSettings ThresholdSettings = RawSettings;
+        ThresholdSettings.bUseStringPulling = true;
+
+        AeonixPathFinder PathFinder(NavData, ThresholdSettings);
+        FAeonixNavigationPath Path;
+        TestTrue(TEXT("Threshold pulled search should find a path"), PathFinder.FindPath(StartLink, TargetLink, StartPos, TargetPos, Path));
+        TestEqual(TEXT("Threshold pulling should make no visibility tests"), PathFinder.GetLastVisibilityTestCount(), 0);
+        TestNotEqual(TEXT("Visibility pulling should change the settings hash"), GetTypeHash(ThresholdSettings), GetTypeHash(PullSettings));
+    }
+
+    // TEST 5: Visibility that isn't monotonic along the points. From the first point the next two are behind the wall, the fourth is in sight and the last is not,
+    // so the binary search ends at the next point, which can't be seen. That step is never kept, the pull fails and leaves the points alone
+    {
+        TArray<FAeonixPathPoint> Points;
+        Points.Add(FAeonixPathPoint(FVector(-300, -200, 0), 0));
+        Points.Add(FAeonixPathPoint(FVector(200, -200, 0), 0));
+        Points.Add(FAeonixPathPoint(FVector(300, -200, 200), 0));
+        Points.Add(FAeonixPathPoint(FVector(-300, -200, 450), 0));
+        Points.Add(FAeonixPathPoint(FVector(300, -200, 450), 0));
+
+        TestFalse(TEXT("First point should not see the next"), NavData.IsSegmentClear(Points[0].Position, Points[1].Position));
+        TestFalse(TEXT("First point should not see the third"), NavData.IsSegmentClear(Points[0].Position, Points[2].Position));
+        TestTrue(TEXT("First point should see the fourth"), NavData.IsSegmentClear(Points[0].Position, Points[3].Position));
+        TestFalse(TEXT("First point should not see the last"), NavData.IsSegmentClear(Points[0].Position, Points[4].Position));
+
+        AeonixPathFinder PathFinder(NavData, PullSettings);
+        TestFalse(TEXT("Pulling should fail on a blocked step"), PathFinder.VisibilityPullPath(Points));
+        TestEqual(TEXT("A failed pull should leave every point"), Points.Num(), 5);
+        TestTrue(TEXT("A failed pull should leave the points where they were"), Points.Num() == 5 && Points[1].Position.Equals(FVector(200, -200, 0)));
+
+    }
+
+    return true;
+}